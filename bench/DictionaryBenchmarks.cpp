@@ -0,0 +1,145 @@
+/**
+ * @file DictionaryBenchmarks.cpp
+ * @brief Casos de benchmark de los diccionarios.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include "Harness.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/BSTDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/PersistentAVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Dictionaries/SplayDictionary.h"
+#include "Structures/Implementations/Dictionaries/UnsortedArrayDictionary.h"
+
+/**
+ * @brief Máscara de las distribuciones en que insertar en un arreglo ordenado desplaza elementos.
+ */
+const int NOT_ASCENDING = ALWAYS_QUADRATIC & ~(1 << SEQUENTIAL);
+
+/**
+ * @brief Máscara de las distribuciones en que eliminar de un arreglo ordenado desplaza elementos.
+ */
+const int NOT_DESCENDING = ALWAYS_QUADRATIC & ~(1 << DESCENDING);
+
+/**
+ * @brief Inserta todas las claves en un diccionario, con la clave como valor.
+ */
+void fillDictionary(Dictionary<int, int>* dictionary, const Workload& work) {
+    for (int i = 0; i < work.size; i++)
+        dictionary->insert(work.inserts[i], work.inserts[i]);
+}
+
+/**
+ * @brief Registra insert, getValue, forEach y remove de un diccionario construido por la función dada.
+ *
+ * remove elimina las claves en el orden en que se insertaron.
+ */
+template <typename Make>
+void addDictionary(Suite& suite, const string& name, Make make, int insertQuadratic, int removeQuadratic) {
+    suite.add("Dictionary", name, "insert", [make](const Workload& work) {
+        Dictionary<int, int>* dictionary = make();
+        Measurement m = timed(work.size, [&]() { fillDictionary(dictionary, work); });
+        delete dictionary;
+        return m;
+    }, insertQuadratic);
+
+    suite.add("Dictionary", name, "getValue", [make](const Workload& work) {
+        Dictionary<int, int>* dictionary = make();
+        fillDictionary(dictionary, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += dictionary->getValue(work.lookups[i]);
+        });
+        doNotOptimize(sum);
+        delete dictionary;
+        return m;
+    }, insertQuadratic);
+
+    suite.add("Dictionary", name, "forEach", [make](const Workload& work) {
+        Dictionary<int, int>* dictionary = make();
+        fillDictionary(dictionary, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            dictionary->forEach([&sum](const int& key, int& value) { sum += key + value; });
+        });
+        doNotOptimize(sum);
+        delete dictionary;
+        return m;
+    }, insertQuadratic);
+
+    suite.add("Dictionary", name, "remove", [make](const Workload& work) {
+        Dictionary<int, int>* dictionary = make();
+        fillDictionary(dictionary, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += dictionary->remove(work.inserts[i]);
+        });
+        doNotOptimize(sum);
+        delete dictionary;
+        return m;
+    }, insertQuadratic | removeQuadratic);
+}
+
+/**
+ * @brief Registra los casos de todos los diccionarios.
+ */
+void registerDictionaryBenchmarks(Suite& suite) {
+    addDictionary(suite, "UnsortedArrayDictionary", []() -> Dictionary<int, int>* {
+        return new UnsortedArrayDictionary<int, int>();
+    }, ALWAYS_QUADRATIC, ALWAYS_QUADRATIC);
+    addDictionary(suite, "SortedArrayDictionary", []() -> Dictionary<int, int>* {
+        return new SortedArrayDictionary<int, int>();
+    }, NOT_ASCENDING, NOT_DESCENDING);
+    addDictionary(suite, "BSTDictionary", []() -> Dictionary<int, int>* {
+        return new BSTDictionary<int, int>();
+    }, ORDERED_INPUT, 0);
+    addDictionary(suite, "AVLDictionary", []() -> Dictionary<int, int>* {
+        return new AVLDictionary<int, int>();
+    }, 0, 0);
+    addDictionary(suite, "SplayDictionary", []() -> Dictionary<int, int>* {
+        return new SplayDictionary<int, int>();
+    }, ORDERED_INPUT, 0);
+    addDictionary(suite, "HashTable", []() -> Dictionary<int, int>* {
+        return new HashTable<int, int>();
+    }, 0, 0);
+
+    suite.add("Dictionary", "PersistentAVLDictionary", "insert", [](const Workload& work) {
+        PersistentAVLDictionary<int, int> dictionary;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                dictionary = dictionary.insert(work.inserts[i], work.inserts[i]);
+        });
+        doNotOptimize(dictionary.getSize());
+        return m;
+    });
+
+    suite.add("Dictionary", "PersistentAVLDictionary", "getValue", [](const Workload& work) {
+        PersistentAVLDictionary<int, int> dictionary;
+        for (int i = 0; i < work.size; i++)
+            dictionary = dictionary.insert(work.inserts[i], work.inserts[i]);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += dictionary.getValue(work.lookups[i]);
+        });
+        doNotOptimize(sum);
+        return m;
+    });
+
+    suite.add("Dictionary", "PersistentAVLDictionary", "remove", [](const Workload& work) {
+        PersistentAVLDictionary<int, int> dictionary;
+        for (int i = 0; i < work.size; i++)
+            dictionary = dictionary.insert(work.inserts[i], work.inserts[i]);
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                dictionary = dictionary.remove(work.inserts[i]);
+        });
+        doNotOptimize(dictionary.getSize());
+        return m;
+    });
+}
@@ -0,0 +1,203 @@
+/**
+ * @file Harness.h
+ * @brief Infraestructura del conjunto unificado de benchmarks.
+ *
+ * Define las distribuciones de claves, los datos de entrada de cada caso, el registro de
+ * casos y la ejecución con repeticiones, con salida en tabla y en JSON. El cronómetro y
+ * doNotOptimize son los de los programas de benchmark (ver src/Benchmarks/Benchmark.h).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <random>
+#include <vector>
+#include "../src/Benchmarks/Benchmark.h"
+
+/**
+ * @brief Distribuciones de claves con las que se ejecuta cada caso.
+ */
+enum Distribution {
+    SEQUENTIAL,  ///< Claves 0, 1, ..., n - 1 en orden ascendente.
+    RANDOM,      ///< Permutación aleatoria de 0, ..., n - 1.
+    ZIPF,        ///< Accesos con distribución de Zipf (s = 0.99) sobre claves dispersas.
+    DESCENDING   ///< Claves n - 1, ..., 0 en orden descendente.
+};
+
+const int DISTRIBUTION_COUNT = 4; ///< Cantidad de distribuciones.
+
+/**
+ * @brief Obtiene el nombre de una distribución, tal como aparece en los resultados.
+ */
+inline const char* distributionName(Distribution distribution) {
+    switch (distribution) {
+    case SEQUENTIAL: return "sequential";
+    case RANDOM: return "random";
+    case ZIPF: return "zipf";
+    default: return "descending";
+    }
+}
+
+/**
+ * @brief Datos de entrada de un caso para un tamaño y una distribución.
+ *
+ * inserts siempre tiene claves distintas (para diccionarios y árboles); con ZIPF es una
+ * permutación aleatoria, porque la asimetría está en los accesos. values puede repetir
+ * claves y se usa como contenido de listas, pilas, colas y como prioridades. lookups es
+ * la secuencia de consultas sobre las claves insertadas.
+ *
+ * La distribución descendente (DESCENDING) es el peor caso de varias estructuras: los
+ * árboles sin balancear degeneran en listas, los arreglos ordenados desplazan todo el
+ * arreglo en cada inserción y cada inserción en un heap sube hasta la raíz. No lo es para
+ * HashTable, cuyas claves se reparten entre las cubetas igual que con las otras
+ * distribuciones.
+ */
+struct Workload {
+    Distribution distribution; ///< Distribución con que se generó.
+    int size;                  ///< Cantidad de claves.
+    std::vector<int> inserts;  ///< Claves distintas, en el orden en que se insertan.
+    std::vector<int> values;   ///< Valores, posiblemente repetidos.
+    std::vector<int> lookups;  ///< Claves consultadas, todas presentes en inserts.
+
+    /**
+     * @brief Genera los datos de una distribución con una semilla fija.
+     */
+    Workload(Distribution distribution, int size) : distribution(distribution), size(size) {
+        std::mt19937 rng(20240501u + (unsigned)size * 7u + (unsigned)distribution);
+        inserts.resize(size);
+        for (int i = 0; i < size; i++)
+            inserts[i] = i;
+        if (distribution == DESCENDING)
+            std::reverse(inserts.begin(), inserts.end());
+        else if (distribution != SEQUENTIAL)
+            std::shuffle(inserts.begin(), inserts.end(), rng);
+
+        if (distribution == ZIPF) {
+            // El rango r (0 es el más frecuente) se asocia con la clave inserts[r].
+            std::vector<double> cdf(size);
+            double total = 0;
+            for (int r = 0; r < size; r++) {
+                total += 1.0 / std::pow((double)(r + 1), 0.99);
+                cdf[r] = total;
+            }
+            std::uniform_real_distribution<double> uniform(0.0, total);
+            values.resize(size);
+            for (int i = 0; i < size; i++) {
+                int rank = (int)(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+                values[i] = inserts[rank < size ? rank : size - 1];
+            }
+            lookups = values;
+        } else {
+            values = inserts;
+            lookups = inserts;
+            if (distribution == RANDOM)
+                std::shuffle(lookups.begin(), lookups.end(), rng);
+        }
+    }
+};
+
+/**
+ * @brief Resultado de una ejecución de un caso.
+ */
+struct Measurement {
+    double ms;            ///< Tiempo medido en milisegundos.
+    long long operations; ///< Cantidad de operaciones realizadas durante la medición.
+};
+
+/**
+ * @brief Mide el tiempo de una operación.
+ *
+ * @param operations Cantidad de operaciones que realiza.
+ * @param operation Función sin parámetros a medir.
+ */
+template <typename F>
+Measurement timed(long long operations, F operation) {
+    Measurement result = { measure(operation), operations };
+    return result;
+}
+
+/**
+ * @brief Caso de benchmark: una operación de un contenedor sobre una distribución.
+ */
+struct BenchmarkCase {
+    string family;                 ///< Interfaz del contenedor (List, Stack, Queue, ...).
+    string container;              ///< Clase medida.
+    string operation;              ///< Operación medida.
+    Distribution distribution;     ///< Distribución de las claves.
+    int maxSize;                   ///< Tamaño máximo con que se ejecuta (para casos cuadráticos).
+    std::function<Measurement(const Workload&)> run; ///< Prepara el contenedor y mide la operación.
+
+    /**
+     * @brief Nombre completo del caso: familia/contenedor/operación/distribución.
+     */
+    string name() const {
+        return family + "/" + container + "/" + operation + "/" + distributionName(distribution);
+    }
+};
+
+/**
+ * @brief Tamaño máximo de los casos con costo cuadrático.
+ */
+const int QUADRATIC_LIMIT = 10000;
+
+/**
+ * @brief Conjunto de casos registrados.
+ */
+class Suite {
+private:
+    std::vector<BenchmarkCase> cases; ///< Casos registrados.
+
+public:
+    /**
+     * @brief Registra una operación para las cuatro distribuciones.
+     *
+     * @param family Interfaz del contenedor.
+     * @param container Clase medida.
+     * @param operation Operación medida.
+     * @param run Función que recibe los datos de entrada y retorna la medición.
+     * @param quadraticIn Distribuciones en las que el caso es cuadrático y se limita a
+     * QUADRATIC_LIMIT (máscara de bits indexada por Distribution; -1 para todas).
+     */
+    void add(const string& family, const string& container, const string& operation,
+             std::function<Measurement(const Workload&)> run, int quadraticIn = 0) {
+        for (int d = 0; d < DISTRIBUTION_COUNT; d++) {
+            BenchmarkCase c;
+            c.family = family;
+            c.container = container;
+            c.operation = operation;
+            c.distribution = (Distribution)d;
+            c.maxSize = (quadraticIn & (1 << d)) != 0 ? QUADRATIC_LIMIT : 0x7FFFFFFF;
+            c.run = run;
+            cases.push_back(c);
+        }
+    }
+
+    /**
+     * @brief Retorna los casos registrados.
+     */
+    const std::vector<BenchmarkCase>& getCases() const {
+        return cases;
+    }
+};
+
+/**
+ * @brief Máscara de distribuciones en las que un árbol sin balancear degenera.
+ */
+const int ORDERED_INPUT = (1 << SEQUENTIAL) | (1 << DESCENDING);
+
+/**
+ * @brief Máscara que marca un caso como cuadrático en todas las distribuciones.
+ */
+const int ALWAYS_QUADRATIC = -1;
+
+void registerListBenchmarks(Suite& suite);
+void registerStackQueueBenchmarks(Suite& suite);
+void registerPriorityQueueBenchmarks(Suite& suite);
+void registerDictionaryBenchmarks(Suite& suite);
+void registerTreeBenchmarks(Suite& suite);
@@ -0,0 +1,176 @@
+/**
+ * @file ListBenchmarks.cpp
+ * @brief Casos de benchmark de las listas.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include "Harness.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Lists/CircleList.h"
+#include "Structures/Implementations/Lists/DCircleList.h"
+#include "Structures/Implementations/Lists/DLinkedList.h"
+#include "Structures/Implementations/Lists/LinkedList.h"
+#include "Structures/Implementations/Lists/OrderedArrayList.h"
+#include "Structures/Implementations/Lists/PersistentList.h"
+#include "Structures/Implementations/Lists/SortedArrayList.h"
+
+/**
+ * @brief Cantidad máxima de búsquedas lineales por repetición.
+ */
+const int LINEAR_LOOKUPS = 200;
+
+/**
+ * @brief Máscara de las distribuciones en que insertar en una lista ordenada desplaza elementos.
+ */
+const int UNSORTED_INPUT = (1 << RANDOM) | (1 << ZIPF) | (1 << DESCENDING);
+
+/**
+ * @brief Agrega todos los valores a una lista.
+ */
+template <typename L>
+void fillList(L& list, const Workload& work) {
+    for (int i = 0; i < work.size; i++)
+        list.append(work.values[i]);
+}
+
+/**
+ * @brief Registra los casos comunes a las implementaciones de List.
+ *
+ * @param sorted Indica si la lista se mantiene ordenada (append inserta en orden).
+ * @param frontQuadratic Indica si insertar o eliminar al inicio desplaza todos los elementos.
+ */
+template <typename L>
+void addList(Suite& suite, const string& name, bool sorted, bool frontQuadratic) {
+    suite.add("List", name, "append", [](const Workload& work) {
+        L list;
+        return timed(work.size, [&]() { fillList(list, work); });
+    }, sorted ? UNSORTED_INPUT : 0);
+
+    if (!sorted) {
+        suite.add("List", name, "insertFront", [](const Workload& work) {
+            L list;
+            return timed(work.size, [&]() {
+                for (int i = 0; i < work.size; i++) {
+                    list.goToStart();
+                    list.insert(work.values[i]);
+                }
+            });
+        }, frontQuadratic ? ALWAYS_QUADRATIC : 0);
+    }
+
+    suite.add("List", name, "traverse", [](const Workload& work) {
+        L list;
+        fillList(list, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (list.goToStart(); !list.atEnd(); list.next())
+                sum += list.getElement();
+        });
+        doNotOptimize(sum);
+        return m;
+    }, sorted ? UNSORTED_INPUT : 0);
+
+    suite.add("List", name, "contains", [](const Workload& work) {
+        L list;
+        fillList(list, work);
+        int lookups = work.size < LINEAR_LOOKUPS ? work.size : LINEAR_LOOKUPS;
+        int found = 0;
+        Measurement m = timed(lookups, [&]() {
+            for (int i = 0; i < lookups; i++)
+                found += list.contains(work.lookups[i]);
+        });
+        doNotOptimize(found);
+        return m;
+    }, sorted ? UNSORTED_INPUT : 0);
+
+    suite.add("List", name, "removeFront", [](const Workload& work) {
+        L list;
+        fillList(list, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            list.goToStart();
+            while (list.getSize() > 0)
+                sum += list.remove();
+        });
+        doNotOptimize(sum);
+        return m;
+    }, (frontQuadratic ? ALWAYS_QUADRATIC : 0) | (sorted ? UNSORTED_INPUT : 0));
+}
+
+/**
+ * @brief Registra los casos de las listas circulares, que no implementan List.
+ */
+template <typename L>
+void addCircleList(Suite& suite, const string& name) {
+    suite.add("List", name, "insert", [](const Workload& work) {
+        L list;
+        return timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                list.insert(work.values[i]);
+        });
+    });
+
+    suite.add("List", name, "traverse", [](const Workload& work) {
+        L list;
+        for (int i = 0; i < work.size; i++)
+            list.insert(work.values[i]);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++) {
+                sum += list.getFront();
+                list.next();
+            }
+        });
+        doNotOptimize(sum);
+        return m;
+    });
+
+    suite.add("List", name, "contains", [](const Workload& work) {
+        L list;
+        for (int i = 0; i < work.size; i++)
+            list.insert(work.values[i]);
+        int lookups = work.size < LINEAR_LOOKUPS ? work.size : LINEAR_LOOKUPS;
+        int found = 0;
+        Measurement m = timed(lookups, [&]() {
+            for (int i = 0; i < lookups; i++)
+                found += list.contains(work.lookups[i]);
+        });
+        doNotOptimize(found);
+        return m;
+    });
+}
+
+/**
+ * @brief Registra los casos de todas las listas.
+ */
+void registerListBenchmarks(Suite& suite) {
+    addList<ArrayList<int>>(suite, "ArrayList", false, true);
+    addList<LinkedList<int>>(suite, "LinkedList", false, false);
+    addList<DLinkedList<int>>(suite, "DLinkedList", false, false);
+    addList<SortedArrayList<int>>(suite, "SortedArrayList", true, true);
+    addList<OrderedArrayList<int>>(suite, "OrderedArrayList", true, true);
+    addCircleList<CircleList<int>>(suite, "CircleList");
+    addCircleList<DCircleList<int>>(suite, "DCircleList");
+
+    suite.add("List", "PersistentList", "append", [](const Workload& work) {
+        PersistentList<int> list;
+        return timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                list = list.append(work.values[i]);
+        });
+    });
+
+    suite.add("List", "PersistentList", "get", [](const Workload& work) {
+        PersistentList<int> list;
+        for (int i = 0; i < work.size; i++)
+            list = list.append(work.values[i]);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += list.get(work.lookups[i]);
+        });
+        doNotOptimize(sum);
+        return m;
+    });
+}
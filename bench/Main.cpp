@@ -0,0 +1,212 @@
+/**
+ * @file Main.cpp
+ * @brief Programa principal del conjunto unificado de benchmarks.
+ *
+ * Ejecuta los casos registrados para cada tamaño y distribución, repitiendo cada uno
+ * varias veces, e imprime la mediana y el mínimo. Opcionalmente guarda los resultados
+ * en JSON para compararlos entre versiones.
+ *
+ * Opciones:
+ *   --filter=TEXTO      sólo los casos cuyo nombre contiene TEXTO
+ *   --sizes=N1,N2,...   tamaños a medir (por defecto 1000,10000,100000)
+ *   --repetitions=N     repeticiones por caso (por defecto 3)
+ *   --json=ARCHIVO      guarda los resultados en ARCHIVO
+ *   --list              sólo lista los casos registrados
+ *   --help              muestra las opciones
+ *
+ * Cualquier otro argumento muestra las opciones y termina con error.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include "Harness.h"
+
+/**
+ * @brief Resultado agregado de un caso para un tamaño.
+ */
+struct Result {
+    const BenchmarkCase* benchmark; ///< Caso medido.
+    int size;                       ///< Tamaño de la entrada.
+    long long operations;           ///< Operaciones por repetición.
+    int repetitions;                ///< Repeticiones realizadas.
+    double minMs;                   ///< Tiempo mínimo.
+    double medianMs;                ///< Tiempo mediano.
+};
+
+/**
+ * @brief Obtiene el valor de una opción --nombre=valor, o "" si no está presente.
+ */
+string option(int argc, char** argv, const string& name) {
+    string prefix = "--" + name + "=";
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        if (argument.compare(0, prefix.size(), prefix) == 0)
+            return argument.substr(prefix.size());
+    }
+    return "";
+}
+
+/**
+ * @brief Verifica si se recibió una opción sin valor.
+ */
+bool flag(int argc, char** argv, const string& name) {
+    for (int i = 1; i < argc; i++)
+        if (string(argv[i]) == "--" + name)
+            return true;
+    return false;
+}
+
+/**
+ * @brief Muestra las opciones del programa.
+ */
+void usage(std::ostream& out, const char* program) {
+    out << "Uso: " << program << " [opciones]\n"
+        << "  --filter=TEXTO      sólo los casos cuyo nombre contiene TEXTO\n"
+        << "  --sizes=N1,N2,...   tamaños a medir (por defecto 1000,10000,100000)\n"
+        << "  --repetitions=N     repeticiones por caso (por defecto 3)\n"
+        << "  --json=ARCHIVO      guarda los resultados en ARCHIVO\n"
+        << "  --list              sólo lista los casos registrados\n"
+        << "  --help              muestra estas opciones" << endl;
+}
+
+/**
+ * @brief Busca el primer argumento que no es una opción reconocida.
+ *
+ * @return El argumento, o "" si todos son válidos.
+ */
+string unknownArgument(int argc, char** argv) {
+    const char* const valued[] = { "--filter=", "--sizes=", "--repetitions=", "--json=" };
+    for (int i = 1; i < argc; i++) {
+        string argument = argv[i];
+        bool known = argument == "--list" || argument == "--help";
+        for (size_t j = 0; j < sizeof(valued) / sizeof(valued[0]) && !known; j++)
+            known = argument.compare(0, strlen(valued[j]), valued[j]) == 0;
+        if (!known)
+            return argument;
+    }
+    return "";
+}
+
+/**
+ * @brief Escribe los resultados en formato JSON.
+ */
+void writeJson(const string& path, const std::vector<Result>& results, int repetitions) {
+    std::ofstream out(path.c_str());
+    char date[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+    out << "{\n  \"context\": {\n"
+        << "    \"date\": \"" << date << "\",\n"
+#if defined(__VERSION__)
+        << "    \"compiler\": \"" << __VERSION__ << "\",\n"
+#endif
+#if defined(NDEBUG)
+        << "    \"assertions\": false,\n"
+#else
+        << "    \"assertions\": true,\n"
+#endif
+        << "    \"repetitions\": " << repetitions << "\n  },\n  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const Result& r = results[i];
+        out << "    {\"name\": \"" << r.benchmark->name() << "/" << r.size << "\""
+            << ", \"family\": \"" << r.benchmark->family << "\""
+            << ", \"container\": \"" << r.benchmark->container << "\""
+            << ", \"operation\": \"" << r.benchmark->operation << "\""
+            << ", \"distribution\": \"" << distributionName(r.benchmark->distribution) << "\""
+            << ", \"size\": " << r.size
+            << ", \"operations\": " << r.operations
+            << ", \"repetitions\": " << r.repetitions
+            << std::fixed << std::setprecision(6)
+            << ", \"min_ms\": " << r.minMs
+            << ", \"median_ms\": " << r.medianMs
+            << ", \"ns_per_op\": " << (r.operations > 0 ? r.medianMs * 1e6 / (double)r.operations : 0.0)
+            << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+}
+
+/**
+ * @brief Función principal del conjunto de benchmarks.
+ */
+int main(int argc, char** argv) {
+    string unknown = unknownArgument(argc, argv);
+    if (!unknown.empty()) {
+        std::cerr << "Opción no reconocida: " << unknown << endl;
+        usage(std::cerr, argv[0]);
+        return 1;
+    }
+    if (flag(argc, argv, "help")) {
+        usage(cout, argv[0]);
+        return 0;
+    }
+
+    Suite suite;
+    registerListBenchmarks(suite);
+    registerStackQueueBenchmarks(suite);
+    registerPriorityQueueBenchmarks(suite);
+    registerDictionaryBenchmarks(suite);
+    registerTreeBenchmarks(suite);
+
+    string filter = option(argc, argv, "filter");
+    std::vector<int> sizes;
+    std::stringstream sizeList(option(argc, argv, "sizes").empty() ? "1000,10000,100000" : option(argc, argv, "sizes"));
+    for (string item; std::getline(sizeList, item, ',');)
+        if (atoi(item.c_str()) > 0)
+            sizes.push_back(atoi(item.c_str()));
+    int repetitions = option(argc, argv, "repetitions").empty() ? 3 : atoi(option(argc, argv, "repetitions").c_str());
+    if (repetitions < 1)
+        repetitions = 1;
+
+    if (flag(argc, argv, "list")) {
+        for (size_t i = 0; i < suite.getCases().size(); i++)
+            if (suite.getCases()[i].name().find(filter) != string::npos)
+                cout << suite.getCases()[i].name() << endl;
+        return 0;
+    }
+
+    std::map<std::pair<int, int>, Workload*> workloads;
+    std::vector<Result> results;
+    cout << std::left << std::setw(64) << "Caso" << std::right << std::setw(10) << "n"
+         << std::setw(14) << "mediana ms" << std::setw(14) << "mínimo ms" << std::setw(12) << "ns/op" << endl;
+    for (size_t s = 0; s < sizes.size(); s++) {
+        for (size_t i = 0; i < suite.getCases().size(); i++) {
+            const BenchmarkCase& benchmark = suite.getCases()[i];
+            int size = sizes[s];
+            if (size > benchmark.maxSize || benchmark.name().find(filter) == string::npos)
+                continue;
+            std::pair<int, int> key((int)benchmark.distribution, size);
+            if (workloads.find(key) == workloads.end())
+                workloads[key] = new Workload(benchmark.distribution, size);
+
+            std::vector<double> times;
+            long long operations = 0;
+            for (int r = 0; r < repetitions; r++) {
+                Measurement m = benchmark.run(*workloads[key]);
+                times.push_back(m.ms);
+                operations = m.operations;
+            }
+            std::sort(times.begin(), times.end());
+            Result result = { &benchmark, size, operations, repetitions, times[0], times[times.size() / 2] };
+            results.push_back(result);
+            cout << std::left << std::setw(64) << benchmark.name() << std::right << std::setw(10) << size
+                 << std::fixed << std::setprecision(3) << std::setw(14) << result.medianMs
+                 << std::setw(14) << result.minMs << std::setprecision(1)
+                 << std::setw(12) << (operations > 0 ? result.medianMs * 1e6 / (double)operations : 0.0) << endl;
+        }
+    }
+    for (std::map<std::pair<int, int>, Workload*>::iterator it = workloads.begin(); it != workloads.end(); ++it)
+        delete it->second;
+
+    string json = option(argc, argv, "json");
+    if (!json.empty()) {
+        writeJson(json, results, repetitions);
+        cout << "Resultados guardados en " << json << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,82 @@
+/**
+ * @file PriorityQueueBenchmarks.cpp
+ * @brief Casos de benchmark de las colas de prioridad.
+ *
+ * Las prioridades se toman de los valores de la distribución módulo PRIORITIES, para que
+ * las colas con un rango fijo de prioridades (LinkedPriorityQueue y BucketPriorityQueue)
+ * puedan medirse con los mismos datos que los heaps.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include "Harness.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Implementations/Queues/BucketPriorityQueue.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/IndexedHeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/LinkedPriorityQueue.h"
+#include "Structures/Implementations/Queues/MultiQueuePriorityQueue.h"
+#include "Structures/Implementations/Queues/PairingHeapPriorityQueue.h"
+
+/**
+ * @brief Cantidad de prioridades distintas.
+ */
+const int PRIORITIES = 1024;
+
+/**
+ * @brief Inserta todos los valores en una cola de prioridad.
+ */
+void fillQueue(PriorityQueue<int>* queue, const Workload& work) {
+    for (int i = 0; i < work.size; i++)
+        queue->insert(work.values[i], work.values[i] % PRIORITIES);
+}
+
+/**
+ * @brief Registra insert y removeMin de una cola construida por la función dada.
+ */
+template <typename Q, typename Make>
+void addPriorityQueue(Suite& suite, const string& name, Make make) {
+    suite.add("PriorityQueue", name, "insert", [make](const Workload& work) {
+        Q* queue = make(work.size);
+        Measurement m = timed(work.size, [&]() { fillQueue(queue, work); });
+        destroy(defaultResource(), queue);
+        return m;
+    });
+
+    suite.add("PriorityQueue", name, "removeMin", [make](const Workload& work) {
+        Q* queue = make(work.size);
+        fillQueue(queue, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += queue->removeMin();
+        });
+        doNotOptimize(sum);
+        destroy(defaultResource(), queue);
+        return m;
+    });
+}
+
+/**
+ * @brief Registra los casos de todas las colas de prioridad.
+ */
+void registerPriorityQueueBenchmarks(Suite& suite) {
+    addPriorityQueue<HeapPriorityQueue<int>>(suite, "HeapPriorityQueue", [](int size) {
+        return create<HeapPriorityQueue<int>>(defaultResource(), size);
+    });
+    addPriorityQueue<IndexedHeapPriorityQueue<int>>(suite, "IndexedHeapPriorityQueue", [](int size) {
+        return create<IndexedHeapPriorityQueue<int>>(defaultResource(), size);
+    });
+    addPriorityQueue<PairingHeapPriorityQueue<int>>(suite, "PairingHeapPriorityQueue", [](int) {
+        return create<PairingHeapPriorityQueue<int>>(defaultResource());
+    });
+    addPriorityQueue<LinkedPriorityQueue<int>>(suite, "LinkedPriorityQueue", [](int) {
+        return create<LinkedPriorityQueue<int>>(defaultResource(), PRIORITIES);
+    });
+    addPriorityQueue<BucketPriorityQueue<int>>(suite, "BucketPriorityQueue", [](int) {
+        return create<BucketPriorityQueue<int>>(defaultResource(), PRIORITIES);
+    });
+    addPriorityQueue<MultiQueuePriorityQueue<int>>(suite, "MultiQueuePriorityQueue", [](int) {
+        return create<MultiQueuePriorityQueue<int>>(defaultResource(), 1, true);
+    });
+}
@@ -0,0 +1,95 @@
+/**
+ * @file StackQueueBenchmarks.cpp
+ * @brief Casos de benchmark de las pilas y las colas.
+ *
+ * Las colas concurrentes se miden con un solo hilo, para comparar el costo base de sus
+ * operaciones atómicas con el de las colas secuenciales.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include "Harness.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Implementations/Queues/ArrayQueue.h"
+#include "Structures/Implementations/Queues/ChunkedDeque.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+#include "Structures/Implementations/Queues/LockFreeQueue.h"
+#include "Structures/Implementations/Queues/MPMCQueue.h"
+#include "Structures/Implementations/Queues/SPSCQueue.h"
+#include "Structures/Implementations/Stacks/ArrayStack.h"
+#include "Structures/Implementations/Stacks/LinkedStack.h"
+
+/**
+ * @brief Registra push y pop de una pila construida por la función dada.
+ */
+template <typename S, typename Make>
+void addStack(Suite& suite, const string& name, Make make) {
+    suite.add("Stack", name, "push", [make](const Workload& work) {
+        S* stack = make(work.size);
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                stack->push(work.values[i]);
+        });
+        destroy(defaultResource(), stack);
+        return m;
+    });
+
+    suite.add("Stack", name, "pop", [make](const Workload& work) {
+        S* stack = make(work.size);
+        for (int i = 0; i < work.size; i++)
+            stack->push(work.values[i]);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += stack->pop();
+        });
+        doNotOptimize(sum);
+        destroy(defaultResource(), stack);
+        return m;
+    });
+}
+
+/**
+ * @brief Registra enqueue y dequeue de una cola construida por la función dada.
+ */
+template <typename Q, typename Make>
+void addQueue(Suite& suite, const string& name, Make make) {
+    suite.add("Queue", name, "enqueue", [make](const Workload& work) {
+        Q* queue = make(work.size);
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                queue->enqueue(work.values[i]);
+        });
+        destroy(defaultResource(), queue);
+        return m;
+    });
+
+    suite.add("Queue", name, "dequeue", [make](const Workload& work) {
+        Q* queue = make(work.size);
+        for (int i = 0; i < work.size; i++)
+            queue->enqueue(work.values[i]);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += queue->dequeue();
+        });
+        doNotOptimize(sum);
+        destroy(defaultResource(), queue);
+        return m;
+    });
+}
+
+/**
+ * @brief Registra los casos de todas las pilas y colas.
+ */
+void registerStackQueueBenchmarks(Suite& suite) {
+    addStack<ArrayStack<int>>(suite, "ArrayStack", [](int) { return create<ArrayStack<int>>(defaultResource(), DEFAULT_MAX, true); });
+    addStack<LinkedStack<int>>(suite, "LinkedStack", [](int) { return create<LinkedStack<int>>(defaultResource()); });
+
+    addQueue<ArrayQueue<int>>(suite, "ArrayQueue", [](int) { return create<ArrayQueue<int>>(defaultResource(), DEFAULT_MAX, true); });
+    addQueue<LinkedQueue<int>>(suite, "LinkedQueue", [](int) { return create<LinkedQueue<int>>(defaultResource()); });
+    addQueue<ChunkedDeque<int>>(suite, "ChunkedDeque", [](int) { return create<ChunkedDeque<int>>(defaultResource()); });
+    addQueue<LockFreeQueue<int>>(suite, "LockFreeQueue", [](int) { return create<LockFreeQueue<int>>(defaultResource()); });
+    addQueue<MPMCQueue<int>>(suite, "MPMCQueue", [](int size) { return create<MPMCQueue<int>>(defaultResource(), size < 2 ? 2 : size); });
+    addQueue<SPSCQueue<int>>(suite, "SPSCQueue", [](int size) { return create<SPSCQueue<int>>(defaultResource(), size); });
+}
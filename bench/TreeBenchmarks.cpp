@@ -0,0 +1,70 @@
+/**
+ * @file TreeBenchmarks.cpp
+ * @brief Casos de benchmark de los árboles de búsqueda.
+ *
+ * Con claves ordenadas (SEQUENTIAL y DESCENDING) el BSTree degenera en una lista y el
+ * SplayTree queda como una rama de altura n antes del primer acceso, por lo que esos casos
+ * se limitan a QUADRATIC_LIMIT (sus operaciones recursivas no soportan alturas mayores).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include "Harness.h"
+#include "Structures/Implementations/Trees/AVLTree.h"
+#include "Structures/Implementations/Trees/BSTree.h"
+#include "Structures/Implementations/Trees/SplayTree.h"
+
+/**
+ * @brief Inserta todas las claves en un árbol.
+ */
+template <typename T>
+void fillTree(T& tree, const Workload& work) {
+    for (int i = 0; i < work.size; i++)
+        tree.insert(work.inserts[i]);
+}
+
+/**
+ * @brief Registra insert, contains y remove de un árbol.
+ *
+ * @param degenerateIn Distribuciones en las que el árbol alcanza altura lineal.
+ */
+template <typename T>
+void addTree(Suite& suite, const string& name, int degenerateIn) {
+    suite.add("Tree", name, "insert", [](const Workload& work) {
+        T tree;
+        return timed(work.size, [&]() { fillTree(tree, work); });
+    }, degenerateIn);
+
+    suite.add("Tree", name, "contains", [](const Workload& work) {
+        T tree;
+        fillTree(tree, work);
+        int found = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                found += tree.contains(work.lookups[i]);
+        });
+        doNotOptimize(found);
+        return m;
+    }, degenerateIn);
+
+    suite.add("Tree", name, "remove", [](const Workload& work) {
+        T tree;
+        fillTree(tree, work);
+        long long sum = 0;
+        Measurement m = timed(work.size, [&]() {
+            for (int i = 0; i < work.size; i++)
+                sum += tree.remove(work.inserts[i]);
+        });
+        doNotOptimize(sum);
+        return m;
+    }, degenerateIn);
+}
+
+/**
+ * @brief Registra los casos de todos los árboles.
+ */
+void registerTreeBenchmarks(Suite& suite) {
+    addTree<BSTree<int>>(suite, "BSTree", ORDERED_INPUT);
+    addTree<AVLTree<int>>(suite, "AVLTree", 0);
+    addTree<SplayTree<int>>(suite, "SplayTree", ORDERED_INPUT);
+}
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <utility>
 #include "Structures/Abstract/List.h"
 
 /**
@@ -35,6 +36,12 @@ private:
     // Operador de asignación privado para evitar asignaciones no deseadas.
     void operator=(const Dictionary<K, V>& other) {}
 
+    /**
+     * @brief Visitante que delega cada par en una función.
+     */
+    template <typename F>
+    class FunctionVisitor;
+
 public:
     /**
      * @brief Constructor por defecto.
@@ -53,18 +60,56 @@ public:
     /**
      * @brief Inserta un par clave-valor en el diccionario.
      *
+     * La clave y el valor se reciben por valor y se mueven al diccionario: se copian sólo
+     * si el llamador pasa un lvalue, y cualquier combinación de temporales, lvalues y
+     * std::move evita las copias innecesarias sin requerir una sobrecarga por cada una.
+     *
      * @param key La clave a insertar.
      * @param value El valor asociado a la clave.
      */
     virtual void insert(K key, V value) = 0;
 
+    /**
+     * @brief Construye el valor a partir de sus argumentos y lo inserta con una clave.
+     *
+     * El valor se construye una sola vez y se mueve al diccionario, sin copias.
+     *
+     * @param key La clave a insertar.
+     * @param args Argumentos del constructor de V.
+     */
+    template <typename... Args>
+    void emplace(K key, Args&&... args) {
+        insert(std::move(key), V(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Intenta insertar un par clave-valor, sin lanzar excepciones si la clave ya existe.
+     *
+     * Pensado para los caminos en que una clave repetida es normal: informa el resultado
+     * sin el costo de lanzar y capturar una excepción.
+     *
+     * @param key La clave a insertar.
+     * @param value El valor asociado a la clave.
+     * @return true si se insertó, false si la clave ya existía; en ese caso el diccionario no cambia.
+     */
+    virtual bool tryInsert(K key, V value) = 0;
+
     /**
      * @brief Elimina un elemento del diccionario usando la clave.
      *
      * @param key La clave del elemento a eliminar.
      * @return El valor asociado a la clave eliminada.
      */
-    virtual V remove(K key) = 0;
+    virtual V remove(const K& key) = 0;
+
+    /**
+     * @brief Intenta eliminar un elemento usando la clave, sin lanzar excepciones si no existe.
+     *
+     * @param key La clave del elemento a eliminar.
+     * @param value Se asigna el valor eliminado; no cambia si la clave no existe.
+     * @return true si se eliminó, false si la clave no existía.
+     */
+    virtual bool tryRemove(const K& key, V& value) = 0;
 
     /**
      * @brief Recupera el valor asociado a una clave.
@@ -72,17 +117,64 @@ public:
      * @param key La clave cuyo valor se desea obtener.
      * @return El valor asociado a la clave.
      */
-    virtual V getValue(K key) = 0;
+    virtual V getValue(const K& key) = 0;
+
+    /**
+     * @brief Intenta recuperar el valor asociado a una clave, sin lanzar excepciones si no existe.
+     *
+     * Se apoya en find(), por lo que una clave ausente cuesta lo mismo que una búsqueda.
+     *
+     * @param key La clave cuyo valor se desea obtener.
+     * @param value Se asigna una copia del valor; no cambia si la clave no existe.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    bool tryGet(const K& key, V& value) {
+        const V* found = find(key);
+        if (found == nullptr)
+            return false;
+        value = *found;
+        return true;
+    }
 
     /**
-     * @brief Establece o actualiza el valor asociado a una clave.
+     * @brief Obtiene una referencia al valor asociado a una clave, sin copiarlo.
      *
-     * Si la clave ya existe, su valor se actualiza. Si no existe, se inserta un nuevo par.
+     * El valor puede modificarse a través de la referencia, que es válida hasta la
+     * siguiente inserción o eliminación.
      *
-     * @param key La clave cuyo valor se desea establecer o actualizar.
-     * @param value El nuevo valor a asociar con la clave.
+     * @param key La clave cuyo valor se desea obtener.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error Si la clave no existe.
      */
-    virtual void setValue(K key, V value) = 0;
+    virtual V& at(const K& key) = 0;
+
+    /**
+     * @brief Busca el valor asociado a una clave sin copiarlo y sin lanzar excepciones.
+     *
+     * El puntero es válido hasta la siguiente inserción o eliminación.
+     *
+     * @param key La clave a buscar.
+     * @return Puntero al valor, o nullptr si la clave no existe.
+     */
+    virtual const V* find(const K& key) = 0;
+
+    /**
+     * @brief Actualiza el valor asociado a una clave existente.
+     *
+     * @param key La clave cuyo valor se desea actualizar.
+     * @param value El nuevo valor a asociar con la clave, que se copia.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    virtual void setValue(const K& key, const V& value) = 0;
+
+    /**
+     * @brief Establece el valor asociado a una clave moviéndolo.
+     *
+     * @param key La clave cuyo valor se desea actualizar.
+     * @param value El nuevo valor, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    virtual void setValue(const K& key, V&& value) = 0;
 
     /**
      * @brief Verifica si el diccionario contiene una clave específica.
@@ -90,7 +182,48 @@ public:
      * @param key La clave a verificar.
      * @return true si la clave existe, false en caso contrario.
      */
-    virtual bool contains(K key) = 0;
+    virtual bool contains(const K& key) = 0;
+
+    /**
+     * @brief Visitante que recibe los pares del diccionario durante un recorrido.
+     */
+    class Visitor {
+    public:
+        virtual ~Visitor() {}
+
+        /**
+         * @brief Procesa un par del diccionario.
+         *
+         * @param key Referencia a la clave guardada.
+         * @param value Referencia al valor guardado, que puede modificarse.
+         */
+        virtual void visit(const K& key, V& value) = 0;
+    };
+
+    /**
+     * @brief Recorre todos los pares del diccionario sin copiarlos ni reservar memoria.
+     *
+     * Cada implementación lo recorre directamente sobre su estructura interna. No debe
+     * insertarse ni eliminarse en el diccionario durante el recorrido.
+     *
+     * @param visitor Visitante que recibe cada par.
+     */
+    virtual void accept(Visitor& visitor) = 0;
+
+    /**
+     * @brief Aplica una función a cada par del diccionario, sin copiarlos.
+     *
+     * Adapta la función a un Visitor que vive en la pila y llama a accept(). Las
+     * implementaciones definen su propio forEach, que recorre su estructura sin llamadas
+     * virtuales cuando se usa el tipo concreto.
+     *
+     * @param visit Función que recibe (const K& clave, V& valor).
+     */
+    template <typename F>
+    void forEach(F visit) {
+        FunctionVisitor<F> visitor(visit);
+        accept(visitor);
+    }
 
     /**
      * @brief Recupera una lista de todas las claves en el diccionario.
@@ -119,4 +252,18 @@ public:
      * Este método debe ser implementado para mostrar el estado del diccionario.
      */
     virtual void print() = 0;
+};
+
+template <typename K, typename V>
+template <typename F>
+class Dictionary<K, V>::FunctionVisitor : public Dictionary<K, V>::Visitor {
+private:
+    F& function; ///< Función que recibe cada par.
+
+public:
+    FunctionVisitor(F& function) : function(function) {}
+
+    void visit(const K& key, V& value) {
+        function(key, value);
+    }
 };
\ No newline at end of file
@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Clase abstracta que define la interfaz para una lista genérica.
  *
@@ -49,25 +51,68 @@ public:
     /**
      * @brief Inserta un elemento al principio de la lista.
      *
-     * @param element El elemento a insertar.
+     * @param element El elemento a insertar, que se copia.
      */
-    virtual void insert(E element) = 0;
+    virtual void insert(const E& element) = 0;
+
+    /**
+     * @brief Inserta un elemento al principio de la lista moviéndolo.
+     *
+     * @param element El elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    virtual void insert(E&& element) = 0;
 
     /**
      * @brief Agrega un elemento al final de la lista.
      *
-     * @param element El elemento a añadir.
+     * @param element El elemento a añadir, que se copia.
+     */
+    virtual void append(const E& element) = 0;
+
+    /**
+     * @brief Agrega un elemento al final de la lista moviéndolo.
+     *
+     * @param element El elemento a añadir, que queda en un estado válido pero no especificado.
+     */
+    virtual void append(E&& element) = 0;
+
+    /**
+     * @brief Construye un elemento a partir de sus argumentos y lo inserta en la posición actual.
+     *
+     * El elemento se construye una sola vez y se mueve a la lista, sin copias.
+     *
+     * @param args Argumentos del constructor de E.
      */
-    virtual void append(E element) = 0;
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        insert(E(std::forward<Args>(args)...));
+    }
+
+    /**
+     * @brief Construye un elemento a partir de sus argumentos y lo agrega al final de la lista.
+     *
+     * @param args Argumentos del constructor de E.
+     */
+    template <typename... Args>
+    void emplaceBack(Args&&... args) {
+        append(E(std::forward<Args>(args)...));
+    }
 
     /**
      * @brief Establece el elemento en la posición actual.
      *
      * Reemplaza el elemento en la posición actual del cursor con el nuevo elemento.
      *
-     * @param element El nuevo elemento a establecer.
+     * @param element El nuevo elemento a establecer, que se copia.
      */
-    virtual void set(E element) = 0;
+    virtual void set(const E& element) = 0;
+
+    /**
+     * @brief Establece el elemento en la posición actual moviéndolo.
+     *
+     * @param element El nuevo elemento a establecer, que queda en un estado válido pero no especificado.
+     */
+    virtual void set(E&& element) = 0;
 
     /**
      * @brief Elimina y devuelve el elemento en la posición actual.
@@ -83,6 +128,19 @@ public:
      */
     virtual E getElement() = 0;
 
+    /**
+     * @brief Obtiene una referencia al elemento en una posición, sin copiarlo ni mover el cursor.
+     *
+     * La referencia es válida hasta la siguiente modificación de la lista. Igual que con
+     * set(), en las listas ordenadas el elemento no debe modificarse de forma que cambie
+     * su orden.
+     *
+     * @param pos Posición del elemento.
+     * @return Referencia al elemento.
+     * @throw runtime_error Si la posición está fuera de los límites.
+     */
+    virtual E& at(int pos) = 0;
+
     /**
      * @brief Limpia todos los elementos de la lista.
      *
@@ -161,7 +219,7 @@ public:
      * @param start La posición desde donde comenzar la búsqueda.
      * @return El índice del elemento si se encuentra, -1 en caso contrario.
      */
-    virtual int indexOf(E element, int start) = 0;
+    virtual int indexOf(const E& element, int start) = 0;
 
     /**
      * @brief Verifica si la lista contiene un elemento específico.
@@ -169,7 +227,7 @@ public:
      * @param element El elemento a buscar.
      * @return true si el elemento está en la lista, false en caso contrario.
      */
-    virtual bool contains(E element) = 0;
+    virtual bool contains(const E& element) = 0;
 
     /**
      * @brief Invierte el orden de los elementos en la lista.
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Interfaz para una cola de prioridad genérica.
  *
@@ -63,10 +65,29 @@ public:
      * Inserta el elemento con la prioridad especificada. Los elementos con menor valor
      * de prioridad tienen mayor precedencia.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad asociada al elemento.
+     */
+    virtual void insert(const E& element, int priority) = 0;
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad asociada al elemento.
+     */
+    virtual void insert(E&& element, int priority) = 0;
+
+    /**
+     * @brief Construye un elemento a partir de sus argumentos y lo inserta con una prioridad.
+     *
      * @param priority Prioridad asociada al elemento.
+     * @param args Argumentos del constructor de E.
      */
-    virtual void insert(E element, int priority) = 0;
+    template <typename... Args>
+    void emplace(int priority, Args&&... args) {
+        insert(E(std::forward<Args>(args)...), priority);
+    }
 
     /**
      * @brief Obtiene el elemento con la mínima prioridad.
@@ -75,6 +96,16 @@ public:
      */
     virtual E min() = 0;
 
+    /**
+     * @brief Obtiene una referencia al elemento con la mínima prioridad, sin copiarlo.
+     *
+     * La referencia es válida hasta la siguiente modificación de la cola.
+     *
+     * @return Referencia constante al elemento con la mínima prioridad.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    virtual const E& peek() = 0;
+
     /**
      * @brief Elimina y retorna el elemento con la mínima prioridad.
      *
@@ -82,6 +113,19 @@ public:
      */
     virtual E removeMin() = 0;
 
+    /**
+     * @brief Intenta eliminar el elemento con la mínima prioridad, sin lanzar excepciones si la cola está vacía.
+     *
+     * @param element Se asigna el elemento eliminado; no cambia si la cola está vacía.
+     * @return true si se eliminó un elemento, false si la cola estaba vacía.
+     */
+    virtual bool tryRemoveMin(E& element) {
+        if (isEmpty())
+            return false;
+        element = removeMin();
+        return true;
+    }
+
     /**
      * @brief Elimina todos los elementos de la cola.
      *
@@ -11,6 +11,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Interfaz para una cola genérica.
  *
@@ -63,9 +65,26 @@ public:
     /**
      * @brief Inserta un elemento al final de la cola.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     */
+    virtual void enqueue(const E& element) = 0; // Insertar un elemento al final de la cola
+
+    /**
+     * @brief Inserta un elemento al final de la cola moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    virtual void enqueue(E&& element) = 0;
+
+    /**
+     * @brief Construye un elemento a partir de sus argumentos y lo inserta al final de la cola.
+     *
+     * @param args Argumentos del constructor de E.
      */
-    virtual void enqueue(E element) = 0; // Insertar un elemento al final de la cola
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        enqueue(E(std::forward<Args>(args)...));
+    }
 
     /**
      * @brief Elimina y retorna el elemento que se encuentra al frente de la cola.
@@ -74,6 +93,19 @@ public:
      */
     virtual E dequeue() = 0; // Eliminar y retornar el elemento al frente de la cola
 
+    /**
+     * @brief Intenta eliminar el elemento al frente de la cola, sin lanzar excepciones si está vacía.
+     *
+     * @param element Se asigna el elemento eliminado; no cambia si la cola está vacía.
+     * @return true si se eliminó un elemento, false si la cola estaba vacía.
+     */
+    virtual bool tryDequeue(E& element) {
+        if (isEmpty())
+            return false;
+        element = dequeue();
+        return true;
+    }
+
     /**
      * @brief Retorna el elemento que se encuentra al frente de la cola sin eliminarlo.
      *
@@ -81,6 +113,16 @@ public:
      */
     virtual E frontValue() = 0; // Retornar el elemento en el frente de la cola
 
+    /**
+     * @brief Retorna una referencia al elemento al frente de la cola, sin copiarlo.
+     *
+     * La referencia es válida hasta la siguiente modificación de la cola.
+     *
+     * @return Referencia al elemento en el frente de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    virtual E& front() = 0;
+
     /**
      * @brief Remueve todos los elementos de la cola.
      *
@@ -114,9 +156,16 @@ public:
     /**
      * @brief Inserta un elemento al frente de la cola.
      *
-     * @param element Elemento a insertar en la parte frontal.
+     * @param element Elemento a insertar en la parte frontal, que se copia.
      */
-    virtual void enqueueFront(E element) = 0; // Insertar un elemento al frente de la cola
+    virtual void enqueueFront(const E& element) = 0; // Insertar un elemento al frente de la cola
+
+    /**
+     * @brief Inserta un elemento al frente de la cola moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    virtual void enqueueFront(E&& element) = 0;
 
     /**
      * @brief Elimina y retorna el elemento que se encuentra al final de la cola.
@@ -131,4 +180,14 @@ public:
      * @return El elemento en el final de la cola.
      */
     virtual E backValue() = 0; // Retornar el elemento en el final de la cola
+
+    /**
+     * @brief Retorna una referencia al elemento al final de la cola, sin copiarlo.
+     *
+     * La referencia es válida hasta la siguiente modificación de la cola.
+     *
+     * @return Referencia al elemento en el final de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    virtual E& back() = 0;
 };
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Interfaz para una pila (Stack) genérica.
  *
@@ -59,9 +61,26 @@ public:
     /**
      * @brief Inserta un elemento en la cima de la pila.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     */
+    virtual void push(const E& element) = 0;
+
+    /**
+     * @brief Inserta un elemento en la cima de la pila moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    virtual void push(E&& element) = 0;
+
+    /**
+     * @brief Construye un elemento a partir de sus argumentos y lo inserta en la cima.
+     *
+     * @param args Argumentos del constructor de E.
      */
-    virtual void push(E element) = 0;
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        push(E(std::forward<Args>(args)...));
+    }
 
     /**
      * @brief Elimina y retorna el elemento en la cima de la pila.
@@ -70,6 +89,19 @@ public:
      */
     virtual E pop() = 0;
 
+    /**
+     * @brief Intenta eliminar el elemento en la cima, sin lanzar excepciones si la pila está vacía.
+     *
+     * @param element Se asigna el elemento eliminado; no cambia si la pila está vacía.
+     * @return true si se eliminó un elemento, false si la pila estaba vacía.
+     */
+    virtual bool tryPop(E& element) {
+        if (isEmpty())
+            return false;
+        element = pop();
+        return true;
+    }
+
     /**
      * @brief Retorna el elemento en la cima de la pila sin eliminarlo.
      *
@@ -77,6 +109,16 @@ public:
      */
     virtual E topValue() = 0;
 
+    /**
+     * @brief Retorna una referencia al elemento en la cima, sin copiarlo.
+     *
+     * La referencia es válida hasta la siguiente modificación de la pila.
+     *
+     * @return Referencia al elemento en la cima de la pila.
+     * @throw runtime_error Si la pila está vacía.
+     */
+    virtual E& top() = 0;
+
     /**
      * @brief Elimina todos los elementos de la pila.
      *
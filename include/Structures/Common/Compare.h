@@ -0,0 +1,88 @@
+/**
+ * @file Compare.h
+ * @brief Comparación de tres vías para las estructuras ordenadas.
+ *
+ * Los árboles y las listas ordenadas reciben un comparador como parámetro de plantilla.
+ * Un comparador es un objeto función que recibe dos claves a y b y retorna un entero
+ * negativo si a va antes que b, cero si son equivalentes y positivo si a va después,
+ * de modo que cada nodo o posición visitada se resuelve con una sola comparación en
+ * lugar de probar == y luego <.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+/**
+ * @brief Compara dos valores con el operador <.
+ *
+ * Es la comparación por defecto para los tipos que no tienen una sobrecarga más
+ * directa. Para los tipos numéricos el compilador la reduce a una sola comparación.
+ *
+ * @param a Primer valor.
+ * @param b Segundo valor.
+ * @return Negativo si a < b, positivo si b < a y cero si son equivalentes.
+ */
+template <typename A, typename B>
+inline int threeWayCompare(const A& a, const B& b) {
+    if (a < b)
+        return -1;
+    if (b < a)
+        return 1;
+    return 0;
+}
+
+/**
+ * @brief Compara dos cadenas recorriéndolas una sola vez con string::compare.
+ */
+inline int threeWayCompare(const std::string& a, const std::string& b) {
+    return a.compare(b);
+}
+
+/**
+ * @brief Compara una cadena con una cadena de C sin construir un string.
+ */
+inline int threeWayCompare(const std::string& a, const char* b) {
+    return a.compare(b);
+}
+
+/**
+ * @brief Compara una cadena de C con una cadena sin construir un string.
+ */
+inline int threeWayCompare(const char* a, const std::string& b) {
+    int result = b.compare(a);
+    return result < 0 ? 1 : (result > 0 ? -1 : 0);
+}
+
+/**
+ * @brief Comparador por defecto de las estructuras ordenadas: el orden natural de las claves.
+ *
+ * Usa threeWayCompare, que puede sobrecargarse para otros tipos con una comparación
+ * de tres vías propia.
+ */
+struct DefaultCompare {
+    /**
+     * @brief Compara dos claves.
+     *
+     * @return Negativo, cero o positivo según a vaya antes, sea equivalente o vaya después de b.
+     */
+    template <typename A, typename B>
+    int operator()(const A& a, const B& b) const {
+        return threeWayCompare(a, b);
+    }
+};
+
+/**
+ * @brief Indica si un comparador ordena las claves según su orden natural (el operador <).
+ *
+ * Las instantáneas marcadas como ordenadas (ver Snapshot.h) están en orden natural; las
+ * estructuras con otro comparador las guardan sin esa marca y verifican su orden con
+ * el comparador al cargarlas. Puede especializarse para comparadores equivalentes.
+ *
+ * @tparam C Tipo del comparador.
+ */
+template <typename C>
+struct NaturalOrder : std::is_same<C, DefaultCompare> {};
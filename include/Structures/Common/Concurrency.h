@@ -0,0 +1,40 @@
+/**
+ * @file Concurrency.h
+ * @brief Utilidades comunes para las estructuras concurrentes.
+ *
+ * Define el tamaño de línea de caché utilizado para separar datos escritos por hilos
+ * distintos y una pausa para los ciclos de espera activa.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <thread>
+
+/**
+ * @brief Tamaño de una línea de caché en bytes.
+ *
+ * Los datos que modifican hilos distintos se alinean a este tamaño para que no
+ * compartan línea de caché (false sharing).
+ */
+const std::size_t CACHE_LINE_SIZE = 64;
+
+/**
+ * @brief Pausa breve dentro de un ciclo de espera activa.
+ *
+ * Después de unos cuantos intentos cede el procesador con std::this_thread::yield()
+ * para no acaparar un núcleo cuando hay más hilos que núcleos.
+ *
+ * @param attempt Cantidad de intentos fallidos hasta el momento.
+ */
+inline void spinWait(int attempt) {
+    if (attempt < 16) {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        __builtin_ia32_pause();
+#endif
+    } else {
+        std::this_thread::yield();
+    }
+}
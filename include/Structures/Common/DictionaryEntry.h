@@ -0,0 +1,151 @@
+/**
+ * @file DictionaryEntry.h
+ * @brief Entradas e iteradores para recorrer los diccionarios sin copiar sus pares.
+ *
+ * Cada diccionario expone un iterador cuyos elementos son DictionaryEntry: referencias a
+ * la clave y al valor guardados, sin importar si el diccionario los almacena juntos en un
+ * KVPair o en arreglos separados. KeyIterator y ValueIterator proyectan ese iterador a
+ * sólo las claves o sólo los valores, y Range permite recorrerlos con un for de rango.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include "Structures/Common/KVPair.h"
+
+/**
+ * @brief Referencias a la clave y al valor de un par guardado en un diccionario.
+ *
+ * La clave es constante porque cambiarla desordenaría el diccionario; el valor puede
+ * modificarse. Las referencias son válidas hasta la siguiente inserción o eliminación.
+ *
+ * @tparam K Tipo de las claves.
+ * @tparam V Tipo de los valores.
+ */
+template <typename K, typename V>
+struct DictionaryEntry {
+    const K& key; ///< Clave del par.
+    V& value;     ///< Valor asociado a la clave.
+};
+
+/**
+ * @brief Adapta un iterador sobre KVPair<K, V> a uno sobre DictionaryEntry<K, V>.
+ *
+ * @tparam I Tipo del iterador adaptado; al desreferenciarlo debe producir KVPair<K, V>&.
+ * @tparam K Tipo de las claves.
+ * @tparam V Tipo de los valores.
+ */
+template <typename I, typename K, typename V>
+class PairIterator {
+private:
+    I current; ///< Iterador adaptado.
+
+public:
+    explicit PairIterator(const I& current) : current(current) {}
+
+    DictionaryEntry<K, V> operator*() {
+        KVPair<K, V>& pair = *current;
+        return DictionaryEntry<K, V>{ pair.key, pair.value };
+    }
+
+    PairIterator<I, K, V>& operator++() {
+        ++current;
+        return *this;
+    }
+
+    bool operator==(const PairIterator<I, K, V>& other) const {
+        return current == other.current;
+    }
+
+    bool operator!=(const PairIterator<I, K, V>& other) const {
+        return !(current == other.current);
+    }
+};
+
+/**
+ * @brief Iterador que entrega sólo las claves de un iterador de entradas.
+ *
+ * @tparam I Tipo del iterador de entradas.
+ * @tparam K Tipo de las claves.
+ */
+template <typename I, typename K>
+class KeyIterator {
+private:
+    I current; ///< Iterador de entradas.
+
+public:
+    explicit KeyIterator(const I& current) : current(current) {}
+
+    const K& operator*() {
+        return (*current).key;
+    }
+
+    KeyIterator<I, K>& operator++() {
+        ++current;
+        return *this;
+    }
+
+    bool operator==(const KeyIterator<I, K>& other) const {
+        return current == other.current;
+    }
+
+    bool operator!=(const KeyIterator<I, K>& other) const {
+        return !(current == other.current);
+    }
+};
+
+/**
+ * @brief Iterador que entrega sólo los valores de un iterador de entradas.
+ *
+ * @tparam I Tipo del iterador de entradas.
+ * @tparam V Tipo de los valores.
+ */
+template <typename I, typename V>
+class ValueIterator {
+private:
+    I current; ///< Iterador de entradas.
+
+public:
+    explicit ValueIterator(const I& current) : current(current) {}
+
+    V& operator*() {
+        return (*current).value;
+    }
+
+    ValueIterator<I, V>& operator++() {
+        ++current;
+        return *this;
+    }
+
+    bool operator==(const ValueIterator<I, V>& other) const {
+        return current == other.current;
+    }
+
+    bool operator!=(const ValueIterator<I, V>& other) const {
+        return !(current == other.current);
+    }
+};
+
+/**
+ * @brief Par de iteradores que puede recorrerse con un for de rango.
+ *
+ * @tparam I Tipo de los iteradores.
+ */
+template <typename I>
+class Range {
+private:
+    I first; ///< Inicio del recorrido.
+    I last;  ///< Fin del recorrido.
+
+public:
+    Range(const I& first, const I& last) : first(first), last(last) {}
+
+    I begin() const {
+        return first;
+    }
+
+    I end() const {
+        return last;
+    }
+};
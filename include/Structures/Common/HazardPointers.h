@@ -0,0 +1,219 @@
+/**
+ * @file HazardPointers.h
+ * @brief Liberación segura de memoria para estructuras sin bloqueos (hazard pointers).
+ *
+ * Un hilo que va a leer un nodo compartido lo publica primero en uno de sus punteros
+ * de riesgo; un nodo retirado sólo se libera cuando ningún hilo lo tiene publicado.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+#include "Structures/Common/Concurrency.h"
+
+using std::runtime_error;
+
+/**
+ * @brief Cantidad máxima de hilos que pueden usar punteros de riesgo a la vez.
+ */
+const int HAZARD_MAX_THREADS = 128;
+
+/**
+ * @brief Cantidad de punteros de riesgo de cada hilo.
+ */
+const int HAZARDS_PER_THREAD = 2;
+
+/**
+ * @brief Cantidad de nodos retirados que acumula un hilo antes de intentar liberarlos.
+ */
+const int HAZARD_SCAN_THRESHOLD = 2 * HAZARD_MAX_THREADS * HAZARDS_PER_THREAD;
+
+/**
+ * @brief Punteros de riesgo de un hilo, en su propia línea de caché.
+ */
+struct alignas(CACHE_LINE_SIZE) HazardRecord {
+    std::atomic<bool> active;                         ///< Indica si algún hilo usa el registro.
+    std::atomic<void*> hazards[HAZARDS_PER_THREAD];   ///< Punteros publicados por el hilo.
+};
+
+/**
+ * @brief Nodo retirado a la espera de que nadie lo esté leyendo.
+ */
+struct RetiredPointer {
+    void* pointer;               ///< Nodo retirado.
+    void (*deleter)(void*);      ///< Función que lo libera.
+};
+
+/**
+ * @brief Dominio global de punteros de riesgo compartido por todas las estructuras.
+ *
+ * Cada hilo toma un HazardRecord la primera vez que lo necesita y lo devuelve al
+ * terminar. Los nodos retirados se acumulan en una lista propia del hilo; al superar
+ * HAZARD_SCAN_THRESHOLD se revisan todos los punteros publicados y se liberan los que
+ * no aparezcan. Lo que un hilo no pudo liberar al terminar pasa a una lista global que
+ * revisa el siguiente hilo que haga una revisión, y se libera al terminar el programa.
+ */
+class HazardPointers {
+private:
+    /**
+     * @brief Estado global: registros de todos los hilos y nodos huérfanos.
+     */
+    struct Domain {
+        HazardRecord records[HAZARD_MAX_THREADS];  ///< Registros de los hilos.
+        std::vector<RetiredPointer> orphans;       ///< Nodos retirados por hilos que ya terminaron.
+        std::mutex orphansMutex;                   ///< Protege orphans.
+
+        Domain() {
+            for (int i = 0; i < HAZARD_MAX_THREADS; i++) {
+                records[i].active.store(false);
+                for (int j = 0; j < HAZARDS_PER_THREAD; j++)
+                    records[i].hazards[j].store(nullptr);
+            }
+        }
+
+        ~Domain() {
+            for (size_t i = 0; i < orphans.size(); i++)
+                orphans[i].deleter(orphans[i].pointer);
+        }
+    };
+
+    /**
+     * @brief Estado de un hilo: su registro y los nodos que ha retirado.
+     */
+    struct ThreadState {
+        HazardRecord* record;                ///< Registro tomado por el hilo.
+        std::vector<RetiredPointer> retired; ///< Nodos retirados pendientes de liberar.
+
+        ThreadState() {
+            Domain& d = domain();
+            record = nullptr;
+            for (int i = 0; i < HAZARD_MAX_THREADS && record == nullptr; i++) {
+                bool expected = false;
+                if (!d.records[i].active.load(std::memory_order_relaxed) &&
+                    d.records[i].active.compare_exchange_strong(expected, true))
+                    record = &d.records[i];
+            }
+            if (record == nullptr)
+                throw runtime_error("Too many threads.");
+        }
+
+        ~ThreadState() {
+            for (int j = 0; j < HAZARDS_PER_THREAD; j++)
+                record->hazards[j].store(nullptr, std::memory_order_release);
+            scan(retired);
+            if (!retired.empty()) {
+                Domain& d = domain();
+                std::lock_guard<std::mutex> lock(d.orphansMutex);
+                d.orphans.insert(d.orphans.end(), retired.begin(), retired.end());
+            }
+            record->active.store(false, std::memory_order_release);
+        }
+    };
+
+    /**
+     * @brief Obtiene el dominio global.
+     */
+    static Domain& domain() {
+        static Domain instance;
+        return instance;
+    }
+
+    /**
+     * @brief Obtiene el estado del hilo actual, creándolo la primera vez.
+     */
+    static ThreadState& local() {
+        thread_local ThreadState state;
+        return state;
+    }
+
+    /**
+     * @brief Libera los nodos de una lista que ningún hilo tenga publicados.
+     *
+     * @param retired Lista de nodos retirados; quedan en ella los que no se liberaron.
+     */
+    static void scan(std::vector<RetiredPointer>& retired) {
+        Domain& d = domain();
+        {
+            std::unique_lock<std::mutex> lock(d.orphansMutex, std::try_to_lock);
+            if (lock.owns_lock() && !d.orphans.empty()) {
+                retired.insert(retired.end(), d.orphans.begin(), d.orphans.end());
+                d.orphans.clear();
+            }
+        }
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::vector<void*> published;
+        for (int i = 0; i < HAZARD_MAX_THREADS; i++) {
+            if (!d.records[i].active.load(std::memory_order_acquire))
+                continue;
+            for (int j = 0; j < HAZARDS_PER_THREAD; j++) {
+                void* pointer = d.records[i].hazards[j].load(std::memory_order_acquire);
+                if (pointer != nullptr)
+                    published.push_back(pointer);
+            }
+        }
+        std::sort(published.begin(), published.end());
+        size_t kept = 0;
+        for (size_t i = 0; i < retired.size(); i++) {
+            if (std::binary_search(published.begin(), published.end(), retired[i].pointer))
+                retired[kept++] = retired[i];
+            else
+                retired[i].deleter(retired[i].pointer);
+        }
+        retired.resize(kept);
+    }
+
+public:
+    /**
+     * @brief Lee un puntero compartido y lo publica como puntero de riesgo.
+     *
+     * Repite la lectura hasta que el valor publicado coincida con el actual, de modo
+     * que el nodo retornado no puede liberarse mientras siga publicado.
+     *
+     * @param index Puntero de riesgo a utilizar (0 a HAZARDS_PER_THREAD - 1).
+     * @param source Puntero compartido a leer.
+     * @return El valor leído, ya protegido.
+     */
+    template <typename T>
+    static T* protect(int index, const std::atomic<T*>& source) {
+        std::atomic<void*>& hazard = local().record->hazards[index];
+        T* pointer = source.load(std::memory_order_relaxed);
+        while (true) {
+            hazard.store(pointer, std::memory_order_seq_cst);
+            T* current = source.load(std::memory_order_seq_cst);
+            if (current == pointer)
+                return pointer;
+            pointer = current;
+        }
+    }
+
+    /**
+     * @brief Deja de publicar un puntero de riesgo.
+     *
+     * @param index Puntero de riesgo a limpiar.
+     */
+    static void clear(int index) {
+        local().record->hazards[index].store(nullptr, std::memory_order_release);
+    }
+
+    /**
+     * @brief Retira un nodo que ya no es alcanzable desde la estructura.
+     *
+     * Se liberará con delete cuando ningún hilo lo tenga publicado.
+     *
+     * @param pointer Nodo retirado.
+     */
+    template <typename T>
+    static void retire(T* pointer) {
+        ThreadState& state = local();
+        RetiredPointer retired = { pointer, [](void* p) { delete static_cast<T*>(p); } };
+        state.retired.push_back(retired);
+        if ((int)state.retired.size() >= HAZARD_SCAN_THRESHOLD)
+            scan(state.retired);
+    }
+};
@@ -0,0 +1,437 @@
+/**
+ * @file Instrumentation.h
+ * @brief Instrumentación opcional de las operaciones de los contenedores.
+ *
+ * Los contenedores instrumentados tienen un miembro Instrumentation<O, C>, donde O es la
+ * cantidad de tipos de operación y C la cantidad de contadores. Si se compila con
+ * STRUCTURES_INSTRUMENTATION definido, Instrumentation es ActiveInstrumentation, que
+ * registra por operación la cantidad de llamadas, un histograma de latencia en
+ * nanosegundos y un histograma del trabajo hecho (sondeos, desplazamientos, niveles),
+ * además de contadores sueltos. Si no, es NullInstrumentation, cuyos métodos están vacíos
+ * y el compilador elimina por completo.
+ *
+ * Uso dentro de un contenedor:
+ * @code
+ * void insert(E element) {
+ *     typename Instrumentation<2, 1>::Scope scope(instrumentation, INSERT);
+ *     ...
+ *     scope.addWork(shifted);
+ * }
+ * @endcode
+ *
+ * Cada contenedor expone stats(), que retorna un Stats con los nombres de sus operaciones
+ * y contadores; Stats::toJson() lo convierte a JSON.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using std::string;
+
+/**
+ * @brief Histograma log-lineal de valores enteros no negativos, al estilo HDR.
+ *
+ * Los valores menores que SUB_BUCKETS tienen una cubeta cada uno; los demás se agrupan
+ * por potencia de dos y cada potencia se divide en SUB_BUCKETS cubetas iguales. Así el
+ * error relativo de los percentiles es a lo sumo 1 / SUB_BUCKETS (6.25%) en todo el rango
+ * de 64 bits, con memoria fija y registro en O(1).
+ */
+class Histogram {
+private:
+    static const int SUB_BITS = 4;                             ///< Bits de precisión por potencia de dos.
+    static const int SUB_BUCKETS = 1 << SUB_BITS;              ///< Cubetas por potencia de dos.
+    static const int BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS; ///< Cantidad total de cubetas.
+
+    unsigned long long counts[BUCKETS]; ///< Cantidad de valores en cada cubeta.
+    unsigned long long total;           ///< Cantidad de valores registrados.
+    unsigned long long sum;             ///< Suma de los valores registrados.
+    unsigned long long minimum;         ///< Menor valor registrado.
+    unsigned long long maximum;         ///< Mayor valor registrado.
+
+    /**
+     * @brief Obtiene la cubeta de un valor.
+     */
+    static int bucketOf(unsigned long long value) {
+        if (value < (unsigned long long)SUB_BUCKETS)
+            return (int)value;
+        int magnitude = 63 - __builtin_clzll(value);
+        int sub = (int)(value >> (magnitude - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return (magnitude - SUB_BITS + 1) * SUB_BUCKETS + sub;
+    }
+
+    /**
+     * @brief Obtiene el mayor valor que cae en una cubeta.
+     */
+    static unsigned long long highestIn(int bucket) {
+        if (bucket < SUB_BUCKETS)
+            return (unsigned long long)bucket;
+        int shift = bucket / SUB_BUCKETS - 1;
+        unsigned long long lowest = (unsigned long long)(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+        return lowest + ((1ULL << shift) - 1);
+    }
+
+public:
+    /**
+     * @brief Constructor de un histograma vacío.
+     */
+    Histogram() {
+        clear();
+    }
+
+    /**
+     * @brief Registra un valor.
+     *
+     * @param value Valor a registrar.
+     */
+    void record(unsigned long long value) {
+        counts[bucketOf(value)]++;
+        if (total == 0 || value < minimum)
+            minimum = value;
+        if (value > maximum)
+            maximum = value;
+        total++;
+        sum += value;
+    }
+
+    /**
+     * @brief Obtiene un percentil.
+     *
+     * @param percent Percentil entre 0 y 100.
+     * @return El mayor valor de la cubeta que contiene el percentil (0 si está vacío).
+     */
+    unsigned long long percentile(double percent) const {
+        if (total == 0)
+            return 0;
+        unsigned long long rank = (unsigned long long)(percent / 100.0 * (double)total + 0.5);
+        if (rank < 1)
+            rank = 1;
+        if (rank > total)
+            rank = total;
+        unsigned long long seen = 0;
+        for (int i = 0; i < BUCKETS; i++) {
+            seen += counts[i];
+            if (seen >= rank)
+                return highestIn(i) < maximum ? highestIn(i) : maximum;
+        }
+        return maximum;
+    }
+
+    /**
+     * @brief Obtiene la cantidad de valores registrados.
+     */
+    unsigned long long getCount() const {
+        return total;
+    }
+
+    /**
+     * @brief Obtiene el menor valor registrado (0 si está vacío).
+     */
+    unsigned long long getMin() const {
+        return minimum;
+    }
+
+    /**
+     * @brief Obtiene el mayor valor registrado (0 si está vacío).
+     */
+    unsigned long long getMax() const {
+        return maximum;
+    }
+
+    /**
+     * @brief Obtiene el promedio de los valores registrados (0 si está vacío).
+     */
+    double getMean() const {
+        return total == 0 ? 0.0 : (double)sum / (double)total;
+    }
+
+    /**
+     * @brief Elimina todos los valores registrados.
+     */
+    void clear() {
+        for (int i = 0; i < BUCKETS; i++)
+            counts[i] = 0;
+        total = sum = minimum = maximum = 0;
+    }
+
+    /**
+     * @brief Convierte el resumen del histograma a JSON.
+     *
+     * @return Objeto con count, min, max, mean, p50, p90, p99 y p999.
+     */
+    string toJson() const {
+        std::ostringstream out;
+        out << "{\"count\": " << total << ", \"min\": " << minimum << ", \"max\": " << maximum
+            << ", \"mean\": " << getMean() << ", \"p50\": " << percentile(50)
+            << ", \"p90\": " << percentile(90) << ", \"p99\": " << percentile(99)
+            << ", \"p999\": " << percentile(99.9) << "}";
+        return out.str();
+    }
+};
+
+/**
+ * @brief Instantánea de la instrumentación de un contenedor.
+ */
+class Stats {
+public:
+    /**
+     * @brief Mediciones de un tipo de operación.
+     */
+    struct Operation {
+        string name;              ///< Nombre de la operación.
+        unsigned long long calls; ///< Cantidad de llamadas.
+        Histogram latency;        ///< Latencia de cada llamada, en nanosegundos.
+        Histogram work;           ///< Trabajo de cada llamada (sólo si la operación lo reporta).
+    };
+
+    /**
+     * @brief Contador con nombre.
+     */
+    struct Counter {
+        string name;              ///< Nombre del contador.
+        unsigned long long value; ///< Valor acumulado.
+    };
+
+    bool enabled;                      ///< Indica si la instrumentación estaba compilada.
+    std::vector<Operation> operations; ///< Mediciones por tipo de operación.
+    std::vector<Counter> counters;     ///< Contadores.
+
+    /**
+     * @brief Constructor de una instantánea vacía.
+     *
+     * @param enabled Indica si la instrumentación estaba compilada.
+     */
+    Stats(bool enabled = false) : enabled(enabled) {}
+
+    /**
+     * @brief Convierte la instantánea a JSON.
+     *
+     * Las operaciones sin llamadas se omiten, igual que el histograma de trabajo de las
+     * operaciones que no lo reportan.
+     *
+     * @return Objeto con enabled, operations y counters.
+     */
+    string toJson() const {
+        std::ostringstream out;
+        out << "{\"enabled\": " << (enabled ? "true" : "false") << ", \"operations\": {";
+        bool first = true;
+        for (size_t i = 0; i < operations.size(); i++) {
+            const Operation& operation = operations[i];
+            if (operation.calls == 0)
+                continue;
+            out << (first ? "" : ", ") << "\"" << operation.name << "\": {\"calls\": " << operation.calls
+                << ", \"latency_ns\": " << operation.latency.toJson();
+            if (operation.work.getCount() > 0)
+                out << ", \"work\": " << operation.work.toJson();
+            out << "}";
+            first = false;
+        }
+        out << "}, \"counters\": {";
+        for (size_t i = 0; i < counters.size(); i++)
+            out << (i == 0 ? "" : ", ") << "\"" << counters[i].name << "\": " << counters[i].value;
+        out << "}}";
+        return out.str();
+    }
+};
+
+/**
+ * @brief Política de instrumentación que registra las mediciones.
+ *
+ * @tparam O Cantidad de tipos de operación.
+ * @tparam C Cantidad de contadores.
+ */
+template <int O, int C>
+class ActiveInstrumentation {
+private:
+    /**
+     * @brief Mediciones acumuladas de un tipo de operación.
+     */
+    struct Record {
+        unsigned long long calls; ///< Cantidad de llamadas.
+        Histogram latency;        ///< Latencia en nanosegundos.
+        Histogram work;           ///< Trabajo reportado.
+    };
+
+    Record* records;                    ///< Mediciones por operación (en el heap por su tamaño).
+    unsigned long long counters[C > 0 ? C : 1]; ///< Contadores.
+
+public:
+    /**
+     * @brief Mide una llamada desde su construcción hasta su destrucción.
+     *
+     * Si la operación lanza una excepción, la llamada se registra igual al destruirse.
+     */
+    class Scope {
+    private:
+        ActiveInstrumentation& owner;                 ///< Instrumentación donde se registra.
+        int operation;                                ///< Tipo de operación.
+        std::chrono::steady_clock::time_point start;  ///< Inicio de la llamada.
+        unsigned long long work;                      ///< Trabajo reportado.
+        bool hasWork;                                 ///< Indica si se reportó trabajo.
+
+        // Una medición no se copia
+        Scope(const Scope& other);
+        void operator =(const Scope& other);
+
+    public:
+        /**
+         * @brief Inicia la medición de una llamada.
+         *
+         * @param owner Instrumentación del contenedor.
+         * @param operation Tipo de operación, entre 0 y O - 1.
+         */
+        Scope(ActiveInstrumentation& owner, int operation)
+            : owner(owner), operation(operation), start(std::chrono::steady_clock::now()), work(0), hasWork(false) {}
+
+        /**
+         * @brief Suma trabajo a la llamada actual.
+         *
+         * @param amount Cantidad de trabajo (sondeos, desplazamientos, niveles...).
+         */
+        void addWork(long long amount) {
+            work += (unsigned long long)(amount > 0 ? amount : 0);
+            hasWork = true;
+        }
+
+        /**
+         * @brief Termina la medición y la registra.
+         */
+        ~Scope() {
+            std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+            Record& record = owner.records[operation];
+            record.calls++;
+            record.latency.record((unsigned long long)elapsed.count());
+            if (hasWork)
+                record.work.record(work);
+        }
+    };
+
+    /**
+     * @brief Constructor con todas las mediciones en cero.
+     */
+    ActiveInstrumentation() {
+        records = new Record[O > 0 ? O : 1];
+        reset();
+    }
+
+    /**
+     * @brief Constructor de copia; copia también las mediciones.
+     */
+    ActiveInstrumentation(const ActiveInstrumentation& other) {
+        records = new Record[O > 0 ? O : 1];
+        *this = other;
+    }
+
+    /**
+     * @brief Asignación; copia las mediciones.
+     */
+    ActiveInstrumentation& operator =(const ActiveInstrumentation& other) {
+        for (int i = 0; i < O; i++)
+            records[i] = other.records[i];
+        for (int i = 0; i < C; i++)
+            counters[i] = other.counters[i];
+        return *this;
+    }
+
+    /**
+     * @brief Destructor que libera las mediciones.
+     */
+    ~ActiveInstrumentation() {
+        delete[] records;
+    }
+
+    /**
+     * @brief Incrementa un contador.
+     *
+     * @param counter Contador, entre 0 y C - 1.
+     * @param amount Cantidad a sumar.
+     */
+    void count(int counter, unsigned long long amount = 1) {
+        counters[counter] += amount;
+    }
+
+    /**
+     * @brief Pone todas las mediciones en cero.
+     */
+    void reset() {
+        for (int i = 0; i < O; i++) {
+            records[i].calls = 0;
+            records[i].latency.clear();
+            records[i].work.clear();
+        }
+        for (int i = 0; i < C; i++)
+            counters[i] = 0;
+    }
+
+    /**
+     * @brief Toma una instantánea de las mediciones.
+     *
+     * @param operationNames Nombres de las O operaciones.
+     * @param counterNames Nombres de los C contadores.
+     * @return La instantánea.
+     */
+    Stats snapshot(const char* const* operationNames, const char* const* counterNames) const {
+        Stats result(true);
+        for (int i = 0; i < O; i++) {
+            Stats::Operation operation;
+            operation.name = operationNames[i];
+            operation.calls = records[i].calls;
+            operation.latency = records[i].latency;
+            operation.work = records[i].work;
+            result.operations.push_back(operation);
+        }
+        for (int i = 0; i < C; i++) {
+            Stats::Counter counter = { counterNames[i], counters[i] };
+            result.counters.push_back(counter);
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Política de instrumentación vacía: no mide nada y no cuesta nada.
+ *
+ * @tparam O Cantidad de tipos de operación.
+ * @tparam C Cantidad de contadores.
+ */
+template <int O, int C>
+class NullInstrumentation {
+public:
+    /**
+     * @brief Medición vacía de una llamada.
+     */
+    class Scope {
+    public:
+        Scope(NullInstrumentation&, int) {}
+        void addWork(long long) {}
+    };
+
+    void count(int, unsigned long long = 1) {}
+    void reset() {}
+
+    /**
+     * @brief Retorna una instantánea vacía, marcada como deshabilitada.
+     */
+    Stats snapshot(const char* const*, const char* const*) const {
+        return Stats(false);
+    }
+};
+
+#if defined(STRUCTURES_INSTRUMENTATION)
+/**
+ * @brief Política de instrumentación seleccionada al compilar (activa).
+ */
+template <int O, int C>
+using Instrumentation = ActiveInstrumentation<O, C>;
+#else
+/**
+ * @brief Política de instrumentación seleccionada al compilar (vacía).
+ */
+template <int O, int C>
+using Instrumentation = NullInstrumentation<O, C>;
+#endif
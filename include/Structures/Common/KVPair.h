@@ -10,6 +10,7 @@
 #pragma once
 
 #include <iostream>
+#include <utility>
 
 using std::ostream;
 
@@ -20,6 +21,10 @@ using std::ostream;
  * para la comparación de pares y sobrecarga de operadores para facilitar su uso
  * en estructuras de datos como diccionarios o mapas.
  *
+ * Los seis operadores de comparación comparan sólo las claves y se derivan de == y <,
+ * de modo que K sólo necesita esos dos operadores. Los árboles no los usan: comparan
+ * las claves directamente con su comparador de tres vías (ver Compare.h y keyOf).
+ *
  * @tparam K Tipo de la clave.
  * @tparam V Tipo del valor asociado.
  */
@@ -37,22 +42,22 @@ public:
     /**
      * @brief Constructor que inicializa solo la clave.
      *
+     * La clave se recibe por valor y se mueve al par: se copia una sola vez si el
+     * argumento es un lvalue y ninguna si es un temporal.
+     *
      * @param key La clave a inicializar.
      */
-    KVPair(K key) {
-        this->key = key;
-    }
+    KVPair(K key) : key(std::move(key)), value() {}
 
     /**
      * @brief Constructor que inicializa el par clave-valor.
      *
+     * La clave y el valor se reciben por valor y se mueven al par.
+     *
      * @param key La clave a inicializar.
      * @param value El valor asociado a la clave.
      */
-    KVPair(K key, V value) {
-        this->key = key;
-        this->value = value;
-    }
+    KVPair(K key, V value) : key(std::move(key)), value(std::move(value)) {}
 
     /**
      * @brief Constructor de copia.
@@ -61,6 +66,13 @@ public:
      */
     KVPair(const KVPair<K, V>& other) : key(other.key), value(other.value) {}
 
+    /**
+     * @brief Constructor de movimiento.
+     *
+     * @param other El par clave-valor a mover.
+     */
+    KVPair(KVPair<K, V>&& other) : key(std::move(other.key)), value(std::move(other.value)) {}
+
     /**
      * @brief Operador de asignación.
      *
@@ -75,6 +87,20 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Operador de asignación por movimiento.
+     *
+     * @param other El par clave-valor a mover.
+     * @return Referencia a este objeto.
+     */
+    KVPair<K, V>& operator=(KVPair<K, V>&& other) {
+        if (this != &other) {
+            this->key = std::move(other.key);
+            this->value = std::move(other.value);
+        }
+        return *this;
+    }
+
     /**
      * @brief Comparador de igualdad.
      *
@@ -95,8 +121,8 @@ public:
      * @param other El par clave-valor a comparar.
      * @return true si las claves son diferentes, false en caso contrario.
      */
-    bool operator!=(const KVPair<K, V>& other) {
-        return this->key != other.key;
+    bool operator!=(const KVPair<K, V>& other) const {
+        return !(this->key == other.key);
     }
 
     /**
@@ -107,7 +133,7 @@ public:
      * @param other El par clave-valor a comparar.
      * @return true si la clave de este par es menor que la clave del otro par.
      */
-    bool operator<(const KVPair<K, V>& other) {
+    bool operator<(const KVPair<K, V>& other) const {
         return this->key < other.key;
     }
 
@@ -119,8 +145,8 @@ public:
      * @param other El par clave-valor a comparar.
      * @return true si la clave de este par es menor o igual que la clave del otro par.
      */
-    bool operator<=(const KVPair<K, V>& other) {
-        return this->key <= other.key;
+    bool operator<=(const KVPair<K, V>& other) const {
+        return !(other.key < this->key);
     }
 
     /**
@@ -131,8 +157,8 @@ public:
      * @param other El par clave-valor a comparar.
      * @return true si la clave de este par es mayor que la clave del otro par.
      */
-    bool operator>(const KVPair<K, V>& other) {
-        return this->key > other.key;
+    bool operator>(const KVPair<K, V>& other) const {
+        return other.key < this->key;
     }
 
     /**
@@ -143,8 +169,8 @@ public:
      * @param other El par clave-valor a comparar.
      * @return true si la clave de este par es mayor o igual que la clave del otro par.
      */
-    bool operator>=(const KVPair<K, V>& other) {
-        return this->key >= other.key;
+    bool operator>=(const KVPair<K, V>& other) const {
+        return !(this->key < other.key);
     }
 };
 
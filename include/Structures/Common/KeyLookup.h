@@ -0,0 +1,63 @@
+/**
+ * @file KeyLookup.h
+ * @brief Búsquedas por clave sin construir elementos temporales.
+ *
+ * Los contenedores comparan la clave buscada directamente con la clave de cada elemento
+ * guardado (keyOf), en lugar de construir un KVPair con la clave buscada. Además, los
+ * diccionarios aceptan búsquedas con tipos distintos de K cuando TransparentKey lo
+ * permite, como const char* para las claves string, sin construir un string.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include "Structures/Common/KVPair.h"
+
+/**
+ * @brief Obtiene la clave de un elemento: el propio elemento, si no es un par.
+ */
+template <typename E>
+inline const E& keyOf(const E& element) {
+    return element;
+}
+
+/**
+ * @brief Obtiene la clave de un par clave-valor.
+ */
+template <typename K, typename V>
+inline const K& keyOf(const KVPair<K, V>& pair) {
+    return pair.key;
+}
+
+/**
+ * @brief Indica si un tipo Q puede usarse para buscar claves de tipo K sin convertirlo.
+ *
+ * Q debe compararse con K mediante == y < con el mismo resultado que la clave K
+ * equivalente y, para HashTable, producir el mismo código hash. Por defecto sólo se
+ * habilitan las cadenas de C para las claves string; otros tipos pueden habilitarse
+ * especializando esta plantilla. Los tipos no habilitados se convierten a K como antes.
+ *
+ * @tparam K Tipo de las claves guardadas.
+ * @tparam Q Tipo de la clave buscada.
+ */
+template <typename K, typename Q>
+struct TransparentKey : std::false_type {};
+
+template <>
+struct TransparentKey<std::string, const char*> : std::true_type {};
+
+template <>
+struct TransparentKey<std::string, char*> : std::true_type {};
+
+template <std::size_t N>
+struct TransparentKey<std::string, char[N]> : std::true_type {};
+
+/**
+ * @brief Tipo de retorno R de una búsqueda heterogénea, habilitada sólo si Q es transparente para K.
+ */
+template <typename K, typename Q, typename R>
+struct TransparentLookup : std::enable_if<TransparentKey<K, Q>::value, R> {};
@@ -0,0 +1,202 @@
+/**
+ * @file LevelBitmap.h
+ * @brief Mapa de bits jerárquico para encontrar rápidamente la primera posición marcada.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include "Structures/Common/MemoryResource.h"
+
+using std::runtime_error;
+
+/**
+ * @brief Mapa de bits de varios niveles sobre palabras de 64 bits.
+ *
+ * El nivel 0 tiene un bit por posición. Cada bit del nivel l + 1 indica si la palabra
+ * correspondiente del nivel l tiene algún bit marcado, y el último nivel cabe en una
+ * sola palabra. Así, encontrar la primera posición marcada (o la primera a partir de
+ * otra) cuesta un __builtin_ctzll por nivel: a lo sumo cuatro para 16 millones de
+ * posiciones, sin importar cuántas estén vacías.
+ */
+class LevelBitmap {
+private:
+    static const int MAX_LEVELS = 6; ///< Niveles suficientes para cualquier cantidad int de posiciones.
+
+    uint64_t* levels[MAX_LEVELS]; ///< Palabras de cada nivel, del más fino al más grueso.
+    int words[MAX_LEVELS];        ///< Cantidad de palabras de cada nivel.
+    int depth;                    ///< Cantidad de niveles.
+    int bits;                     ///< Cantidad de posiciones.
+    MemoryResource* resource;     ///< Recurso del que se obtienen las palabras.
+
+    /**
+     * @brief Constructor de copia (eliminado).
+     */
+    LevelBitmap(const LevelBitmap& other) = delete;
+
+    /**
+     * @brief Operador de asignación (eliminado).
+     */
+    void operator=(const LevelBitmap& other) = delete;
+
+    /**
+     * @brief Baja desde una palabra no vacía de un nivel hasta la posición marcada más baja.
+     *
+     * @param level Nivel de la palabra.
+     * @param index Índice de la palabra dentro de su nivel.
+     * @return La primera posición marcada bajo esa palabra.
+     */
+    int descend(int level, int index) const {
+        for (int l = level; l >= 0; l--)
+            index = (index << 6) + __builtin_ctzll(levels[l][index]);
+        return index;
+    }
+
+public:
+    /**
+     * @brief Constructor que crea un mapa con todas las posiciones desmarcadas.
+     *
+     * @param bits Cantidad de posiciones.
+     * @param resource Recurso del que se obtienen las palabras (ver MemoryResource.h).
+     * @throws runtime_error Si la cantidad es menor que 1.
+     */
+    LevelBitmap(int bits, MemoryResource* resource = defaultResource()) : resource(resource) {
+        if (bits < 1)
+            throw runtime_error("Invalid size.");
+        this->bits = bits;
+        depth = 0;
+        int count = bits;
+        do {
+            count = (count + 63) / 64;
+            words[depth] = count;
+            levels[depth] = createArray<uint64_t>(resource, count, (uint64_t)0);
+            depth++;
+        } while (count > 1);
+    }
+
+    /**
+     * @brief Destructor que libera las palabras de todos los niveles.
+     */
+    ~LevelBitmap() {
+        for (int l = 0; l < depth; l++)
+            destroyArray(resource, levels[l], words[l]);
+    }
+
+    /**
+     * @brief Marca una posición.
+     *
+     * @param position Posición a marcar, entre 0 y getBits() - 1.
+     */
+    void set(int position) {
+        for (int l = 0; l < depth; l++) {
+            uint64_t& word = levels[l][position >> 6];
+            bool wasEmpty = word == 0;
+            word |= 1ULL << (position & 63);
+            if (!wasEmpty)
+                return;
+            position >>= 6;
+        }
+    }
+
+    /**
+     * @brief Desmarca una posición.
+     *
+     * @param position Posición a desmarcar, entre 0 y getBits() - 1.
+     */
+    void reset(int position) {
+        for (int l = 0; l < depth; l++) {
+            uint64_t& word = levels[l][position >> 6];
+            word &= ~(1ULL << (position & 63));
+            if (word != 0)
+                return;
+            position >>= 6;
+        }
+    }
+
+    /**
+     * @brief Indica si una posición está marcada.
+     *
+     * @param position Posición a consultar, entre 0 y getBits() - 1.
+     * @return true si está marcada, false en caso contrario.
+     */
+    bool test(int position) const {
+        return (levels[0][position >> 6] >> (position & 63)) & 1;
+    }
+
+    /**
+     * @brief Indica si no hay ninguna posición marcada.
+     */
+    bool none() const {
+        return levels[depth - 1][0] == 0;
+    }
+
+    /**
+     * @brief Obtiene la primera posición marcada.
+     *
+     * @return La posición, o -1 si no hay ninguna.
+     */
+    int findFirst() const {
+        if (none())
+            return -1;
+        return descend(depth - 1, 0);
+    }
+
+    /**
+     * @brief Obtiene la primera posición marcada mayor o igual que una dada.
+     *
+     * Sube de nivel sólo mientras la palabra actual no tenga bits marcados a la derecha
+     * de la posición, y luego baja por la primera rama no vacía.
+     *
+     * @param from Posición desde la que se busca.
+     * @return La posición, o -1 si no hay ninguna.
+     */
+    int findNext(int from) const {
+        if (from < 0)
+            from = 0;
+        if (from >= bits)
+            return -1;
+        for (int l = 0; l < depth; l++) {
+            int index = from >> 6;
+            if (index >= words[l])
+                return -1;
+            uint64_t word = levels[l][index] & (~0ULL << (from & 63));
+            if (word != 0) {
+                int position = (index << 6) + __builtin_ctzll(word);
+                return l == 0 ? position : descend(l - 1, position);
+            }
+            from = index + 1;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Cuenta las posiciones marcadas con __builtin_popcountll.
+     *
+     * @return La cantidad de posiciones marcadas.
+     */
+    int count() const {
+        int total = 0;
+        for (int w = 0; w < words[0]; w++)
+            total += __builtin_popcountll(levels[0][w]);
+        return total;
+    }
+
+    /**
+     * @brief Desmarca todas las posiciones.
+     */
+    void clear() {
+        for (int l = 0; l < depth; l++)
+            for (int w = 0; w < words[l]; w++)
+                levels[l][w] = 0;
+    }
+
+    /**
+     * @brief Retorna la cantidad de posiciones del mapa.
+     */
+    int getBits() const {
+        return bits;
+    }
+};
@@ -0,0 +1,425 @@
+/**
+ * @file MemoryResource.h
+ * @brief Recursos de memoria intercambiables para los contenedores.
+ *
+ * Es el equivalente en C++11 de std::pmr::memory_resource: cada contenedor recibe en su
+ * constructor un MemoryResource del que obtiene toda la memoria de sus nodos y arreglos,
+ * de modo que puede dirigirse a una arena por solicitud, a un pool de páginas grandes o
+ * a memoria local de un nodo NUMA sin cambiar el tipo del contenedor. Si no se indica
+ * ninguno se usa defaultResource(), que por defecto es new/delete.
+ *
+ * El recurso debe vivir más que todos los contenedores que lo usan. Los contenedores no
+ * lo sincronizan: si varios hilos modifican contenedores que comparten un recurso, éste
+ * debe admitir llamadas concurrentes (newDeleteResource() las admite, MonotonicBuffer no).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Origen de la memoria de un contenedor.
+ *
+ * Las subclases implementan doAllocate y doDeallocate. deallocate recibe el mismo tamaño
+ * y alineamiento con que se pidió el bloque, por lo que un recurso no necesita guardarlos.
+ */
+class MemoryResource {
+public:
+    virtual ~MemoryResource() {}
+
+    /**
+     * @brief Obtiene un bloque de memoria.
+     *
+     * @param bytes Tamaño del bloque.
+     * @param alignment Alineamiento requerido, una potencia de 2.
+     * @return Puntero al bloque.
+     * @throws std::bad_alloc Si no hay memoria disponible.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        return doAllocate(bytes, alignment);
+    }
+
+    /**
+     * @brief Devuelve un bloque obtenido con allocate.
+     *
+     * @param pointer Bloque a devolver.
+     * @param bytes Tamaño con que se pidió.
+     * @param alignment Alineamiento con que se pidió.
+     */
+    void deallocate(void* pointer, std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        doDeallocate(pointer, bytes, alignment);
+    }
+
+    /**
+     * @brief Indica si la memoria obtenida de un recurso puede devolverse al otro.
+     */
+    bool isEqual(const MemoryResource& other) const noexcept {
+        return this == &other || doIsEqual(other);
+    }
+
+protected:
+    virtual void* doAllocate(std::size_t bytes, std::size_t alignment) = 0;
+    virtual void doDeallocate(void* pointer, std::size_t bytes, std::size_t alignment) = 0;
+    virtual bool doIsEqual(const MemoryResource&) const noexcept {
+        return false;
+    }
+};
+
+/**
+ * @brief Recurso que obtiene la memoria con ::operator new y la devuelve con ::operator delete.
+ *
+ * Los alineamientos mayores que el de std::max_align_t, que ::operator new no garantiza
+ * en C++11, se obtienen pidiendo un bloque más grande y guardando el original justo antes
+ * del bloque alineado.
+ */
+class NewDeleteResource : public MemoryResource {
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override {
+        if (alignment <= alignof(std::max_align_t))
+            return ::operator new(bytes);
+        void* original = ::operator new(bytes + alignment + sizeof(void*));
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(original) + sizeof(void*);
+        address = (address + alignment - 1) & ~(std::uintptr_t)(alignment - 1);
+        reinterpret_cast<void**>(address)[-1] = original;
+        return reinterpret_cast<void*>(address);
+    }
+
+    void doDeallocate(void* pointer, std::size_t, std::size_t alignment) override {
+        if (alignment <= alignof(std::max_align_t))
+            ::operator delete(pointer);
+        else
+            ::operator delete(static_cast<void**>(pointer)[-1]);
+    }
+
+    bool doIsEqual(const MemoryResource& other) const noexcept override {
+        return dynamic_cast<const NewDeleteResource*>(&other) != nullptr;
+    }
+};
+
+/**
+ * @brief Obtiene el recurso global de new/delete.
+ */
+inline MemoryResource* newDeleteResource() {
+    static NewDeleteResource resource;
+    return &resource;
+}
+
+/**
+ * @brief Recurso por defecto de los contenedores creados sin indicar uno.
+ */
+inline std::atomic<MemoryResource*>& defaultResourceSlot() {
+    static std::atomic<MemoryResource*> slot(newDeleteResource());
+    return slot;
+}
+
+/**
+ * @brief Obtiene el recurso que usan los contenedores creados sin indicar uno.
+ */
+inline MemoryResource* defaultResource() {
+    return defaultResourceSlot().load(std::memory_order_acquire);
+}
+
+/**
+ * @brief Cambia el recurso por defecto de los contenedores que se creen después.
+ *
+ * @param resource Nuevo recurso por defecto, o nullptr para volver a newDeleteResource().
+ * @return El recurso por defecto anterior.
+ */
+inline MemoryResource* setDefaultResource(MemoryResource* resource) {
+    if (resource == nullptr)
+        resource = newDeleteResource();
+    return defaultResourceSlot().exchange(resource, std::memory_order_acq_rel);
+}
+
+/**
+ * @brief Recurso monotónico: reparte memoria de bloques grandes y nunca la libera uno por uno.
+ *
+ * Obtener memoria es mover un puntero; devolverla no hace nada. Todo se libera de una vez
+ * con release() o al destruir el recurso, lo que conviene para estructuras de vida corta,
+ * como los diccionarios de una solicitud, que se crean, se usan y se descartan juntos.
+ * Los bloques se piden a un recurso superior y cada uno duplica el tamaño del anterior.
+ * Puede partir de un arreglo propio (por ejemplo en la pila) antes de pedir bloques.
+ *
+ * No es seguro usarlo desde varios hilos a la vez.
+ */
+class MonotonicBuffer : public MemoryResource {
+private:
+    /**
+     * @brief Encabezado de cada bloque obtenido del recurso superior.
+     */
+    struct Chunk {
+        Chunk* next;       ///< Bloque obtenido antes que éste.
+        std::size_t size;  ///< Tamaño total del bloque, incluido el encabezado.
+    };
+
+    static const std::size_t MIN_CHUNK_SIZE = 256; ///< Tamaño mínimo de un bloque.
+
+    MemoryResource* upstream;  ///< Recurso del que se obtienen los bloques.
+    Chunk* chunks;             ///< Bloques obtenidos, del más reciente al más antiguo.
+    char* current;             ///< Primer byte libre del bloque actual.
+    std::size_t available;     ///< Bytes libres del bloque actual.
+    char* initialBuffer;       ///< Arreglo inicial del usuario, o nullptr.
+    std::size_t initialSize;   ///< Tamaño del arreglo inicial.
+    std::size_t firstSize;     ///< Tamaño del primer bloque que se pide a upstream.
+    std::size_t nextSize;      ///< Tamaño del próximo bloque.
+
+    /**
+     * @brief Pide al recurso superior un bloque con espacio para al menos bytes alineados.
+     */
+    void grow(std::size_t bytes, std::size_t alignment) {
+        std::size_t needed = sizeof(Chunk) + bytes + alignment;
+        std::size_t size = nextSize < needed ? needed : nextSize;
+        Chunk* chunk = static_cast<Chunk*>(upstream->allocate(size, alignof(Chunk)));
+        chunk->next = chunks;
+        chunk->size = size;
+        chunks = chunk;
+        current = reinterpret_cast<char*>(chunk + 1);
+        available = size - sizeof(Chunk);
+        nextSize = size * 2;
+    }
+
+public:
+    /**
+     * @brief Crea un recurso cuyos bloques se piden a upstream.
+     *
+     * @param initialSize Tamaño del primer bloque.
+     * @param upstream Recurso del que se obtienen los bloques.
+     */
+    explicit MonotonicBuffer(std::size_t initialSize = 1024, MemoryResource* upstream = defaultResource())
+        : upstream(upstream), chunks(nullptr), current(nullptr), available(0), initialBuffer(nullptr), initialSize(0),
+          firstSize(initialSize < MIN_CHUNK_SIZE ? MIN_CHUNK_SIZE : initialSize), nextSize(firstSize) {}
+
+    /**
+     * @brief Crea un recurso que reparte primero el arreglo indicado.
+     *
+     * El arreglo no se libera; al agotarse se piden bloques a upstream.
+     *
+     * @param buffer Arreglo inicial.
+     * @param size Tamaño del arreglo.
+     * @param upstream Recurso del que se obtienen los bloques.
+     */
+    MonotonicBuffer(void* buffer, std::size_t size, MemoryResource* upstream = defaultResource())
+        : upstream(upstream), chunks(nullptr), current(static_cast<char*>(buffer)), available(size),
+          initialBuffer(static_cast<char*>(buffer)), initialSize(size),
+          firstSize(size < MIN_CHUNK_SIZE / 2 ? MIN_CHUNK_SIZE : size * 2), nextSize(firstSize) {}
+
+    MonotonicBuffer(const MonotonicBuffer& other) = delete;
+    MonotonicBuffer& operator=(const MonotonicBuffer& other) = delete;
+
+    /**
+     * @brief Destructor que devuelve todos los bloques al recurso superior.
+     */
+    ~MonotonicBuffer() {
+        release();
+    }
+
+    /**
+     * @brief Devuelve todos los bloques al recurso superior y vuelve al estado inicial.
+     *
+     * Invalida toda la memoria repartida hasta ahora: los contenedores que la usan deben
+     * haberse destruido antes.
+     */
+    void release() {
+        while (chunks != nullptr) {
+            Chunk* next = chunks->next;
+            upstream->deallocate(chunks, chunks->size, alignof(Chunk));
+            chunks = next;
+        }
+        current = initialBuffer;
+        available = initialSize;
+        nextSize = firstSize;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se piden los bloques.
+     */
+    MemoryResource* getUpstream() const {
+        return upstream;
+    }
+
+protected:
+    void* doAllocate(std::size_t bytes, std::size_t alignment) override {
+        std::uintptr_t address = reinterpret_cast<std::uintptr_t>(current);
+        std::size_t padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+        if (current == nullptr || padding + bytes > available) {
+            grow(bytes, alignment);
+            address = reinterpret_cast<std::uintptr_t>(current);
+            padding = (alignment - (address & (alignment - 1))) & (alignment - 1);
+        }
+        char* result = current + padding;
+        current = result + bytes;
+        available -= padding + bytes;
+        return result;
+    }
+
+    void doDeallocate(void*, std::size_t, std::size_t) override {}
+};
+
+/**
+ * @brief Construye un objeto con memoria de un recurso.
+ *
+ * @param resource Recurso del que se obtiene la memoria.
+ * @param args Argumentos del constructor.
+ * @return El objeto construido.
+ */
+template <typename T, typename... Args>
+T* create(MemoryResource* resource, Args&&... args) {
+    void* memory = resource->allocate(sizeof(T), alignof(T));
+    try {
+        return ::new (memory) T(std::forward<Args>(args)...);
+    } catch (...) {
+        resource->deallocate(memory, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+/**
+ * @brief Destruye un objeto creado con create y devuelve su memoria al recurso.
+ *
+ * @param resource Recurso con que se creó.
+ * @param object Objeto a destruir; si es nullptr no hace nada.
+ */
+template <typename T>
+void destroy(MemoryResource* resource, T* object) {
+    if (object == nullptr)
+        return;
+    object->~T();
+    resource->deallocate(object, sizeof(T), alignof(T));
+}
+
+/**
+ * @brief Construye un arreglo con memoria de un recurso.
+ *
+ * Sin argumentos, los elementos se inicializan como en new T[count]; con argumentos,
+ * cada elemento se construye con una copia de ellos.
+ *
+ * @param resource Recurso del que se obtiene la memoria.
+ * @param count Cantidad de elementos.
+ * @param args Argumentos del constructor de cada elemento.
+ * @return El arreglo construido.
+ */
+template <typename T, typename... Args>
+T* createArray(MemoryResource* resource, std::size_t count, const Args&... args) {
+    if (count > (std::size_t)-1 / sizeof(T))
+        throw std::bad_array_new_length();
+    T* array = static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    std::size_t built = 0;
+    try {
+        for (; built < count; built++)
+            ::new (static_cast<void*>(array + built)) T(args...);
+    } catch (...) {
+        while (built > 0)
+            array[--built].~T();
+        resource->deallocate(array, count * sizeof(T), alignof(T));
+        throw;
+    }
+    return array;
+}
+
+/**
+ * @brief Crea un arreglo de elementos inicializados por defecto (como new T[count]).
+ */
+template <typename T>
+T* createArray(MemoryResource* resource, std::size_t count) {
+    if (count > (std::size_t)-1 / sizeof(T))
+        throw std::bad_array_new_length();
+    T* array = static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    std::size_t built = 0;
+    try {
+        for (; built < count; built++)
+            ::new (static_cast<void*>(array + built)) T;
+    } catch (...) {
+        while (built > 0)
+            array[--built].~T();
+        resource->deallocate(array, count * sizeof(T), alignof(T));
+        throw;
+    }
+    return array;
+}
+
+/**
+ * @brief Destruye un arreglo creado con createArray y devuelve su memoria al recurso.
+ *
+ * @param resource Recurso con que se creó.
+ * @param array Arreglo a destruir; si es nullptr no hace nada.
+ * @param count Cantidad de elementos con que se creó.
+ */
+template <typename T>
+void destroyArray(MemoryResource* resource, T* array, std::size_t count) {
+    if (array == nullptr)
+        return;
+    for (std::size_t i = count; i > 0; i--)
+        array[i - 1].~T();
+    resource->deallocate(array, count * sizeof(T), alignof(T));
+}
+
+/**
+ * @brief Asignador estándar que obtiene la memoria de un MemoryResource.
+ *
+ * Equivale a std::pmr::polymorphic_allocator. Permite usar un recurso con las clases de
+ * la biblioteca estándar, por ejemplo std::allocate_shared en las estructuras persistentes
+ * o std::vector.
+ *
+ * @tparam T Tipo de los objetos que se asignan.
+ */
+template <typename T>
+class ResourceAllocator {
+private:
+    MemoryResource* resource; ///< Recurso del que se obtiene la memoria.
+
+    template <typename U>
+    friend class ResourceAllocator;
+
+public:
+    typedef T value_type; ///< Tipo de los objetos que se asignan.
+
+    /**
+     * @brief Crea un asignador sobre el recurso indicado.
+     */
+    ResourceAllocator(MemoryResource* resource = defaultResource()) noexcept : resource(resource) {}
+
+    /**
+     * @brief Crea un asignador sobre el mismo recurso que otro de distinto tipo.
+     */
+    template <typename U>
+    ResourceAllocator(const ResourceAllocator<U>& other) noexcept : resource(other.resource) {}
+
+    /**
+     * @brief Obtiene memoria para count objetos.
+     */
+    T* allocate(std::size_t count) {
+        if (count > (std::size_t)-1 / sizeof(T))
+            throw std::bad_array_new_length();
+        return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+    }
+
+    /**
+     * @brief Devuelve la memoria de count objetos.
+     */
+    void deallocate(T* pointer, std::size_t count) {
+        resource->deallocate(pointer, count * sizeof(T), alignof(T));
+    }
+
+    /**
+     * @brief Obtiene el recurso del asignador.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    template <typename U>
+    bool operator==(const ResourceAllocator<U>& other) const {
+        return resource->isEqual(*other.resource);
+    }
+
+    template <typename U>
+    bool operator!=(const ResourceAllocator<U>& other) const {
+        return !(*this == other);
+    }
+};
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <algorithm> // Para std::max
+#include <utility>
 
 using std::max;
 
@@ -38,7 +39,7 @@ public:
      * @param element El elemento que se almacenará en el nodo.
      */
     AVLNode(E element) {
-        this->element = element;
+        this->element = std::move(element);
         left = nullptr;
         right = nullptr;
         height = 1;
@@ -0,0 +1,40 @@
+/**
+ * @file AtomicNode.h
+ * @brief Clase que representa un nodo de una lista enlazada compartida entre hilos.
+ *
+ * Almacena un elemento y un puntero atómico al siguiente nodo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+
+/**
+ * @brief Nodo de una lista enlazada simple cuyo enlace puede modificarse desde varios hilos.
+ *
+ * Es el equivalente de Node para las estructuras sin bloqueos: el elemento se escribe
+ * antes de publicar el nodo y no cambia después, mientras que next se actualiza con
+ * operaciones atómicas.
+ *
+ * @tparam E Tipo de los elementos almacenados en el nodo.
+ */
+template <typename E>
+class AtomicNode {
+public:
+    E element; ///< El elemento almacenado en el nodo.
+    std::atomic<AtomicNode<E>*> next; ///< Puntero atómico al siguiente nodo.
+
+    /**
+     * @brief Constructor que inicializa un nodo con un elemento.
+     *
+     * @param element El elemento que se almacenará en el nodo.
+     */
+    AtomicNode(const E& element) : element(element), next(nullptr) {}
+
+    /**
+     * @brief Constructor que inicializa un nodo sin elemento (nodo centinela).
+     */
+    AtomicNode() : next(nullptr) {}
+};
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Clase que representa un nodo en un árbol de búsqueda binaria (BST).
  *
@@ -33,7 +35,7 @@ public:
      * @param element El elemento que se almacenará en el nodo.
      */
     BSTNode(E element) {
-        this->element = element;
+        this->element = std::move(element);
         left = nullptr;
         right = nullptr;
     }
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Clase que representa un nodo en una lista doblemente enlazada.
  *
@@ -33,7 +35,7 @@ public:
      * @param previous Puntero al nodo anterior.
      */
     DNode(E element, DNode<E>* next, DNode<E>* previous) {
-        this->element = element;
+        this->element = std::move(element);
         this->next = next;
         this->previous = previous;
     }
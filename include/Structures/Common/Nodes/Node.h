@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Clase que representa un nodo en una lista enlazada simple.
  *
@@ -31,7 +33,7 @@ public:
      * @param next Puntero al siguiente nodo (opcional, por defecto es nullptr).
      */
     Node(E element, Node<E>* next = nullptr) {
-        this->element = element;
+        this->element = std::move(element);
         this->next = next;
     }
 
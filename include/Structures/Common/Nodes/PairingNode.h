@@ -0,0 +1,44 @@
+/**
+ * @file PairingNode.h
+ * @brief Clase que representa un nodo de un pairing heap.
+ *
+ * Almacena un elemento, su prioridad y punteros al primer hijo, al siguiente hermano
+ * y al nodo anterior.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <utility>
+
+/**
+ * @brief Clase que representa un nodo de un pairing heap.
+ *
+ * Los hijos de un nodo forman una lista doblemente enlazada: child apunta al primer hijo,
+ * next al siguiente hermano y previous al hermano anterior o, para el primer hijo, al
+ * padre. Con previous se puede separar un subárbol en O(1).
+ *
+ * @tparam E Tipo de los elementos almacenados en el nodo.
+ */
+template <typename E>
+class PairingNode {
+public:
+    E element;                 ///< El elemento almacenado en el nodo.
+    int priority;              ///< Prioridad del elemento (menor valor, mayor precedencia).
+    PairingNode<E>* child;     ///< Primer hijo del nodo.
+    PairingNode<E>* next;      ///< Siguiente hermano del nodo.
+    PairingNode<E>* previous;  ///< Hermano anterior, o el padre si es el primer hijo.
+
+    /**
+     * @brief Constructor que inicializa un nodo sin hijos ni hermanos.
+     *
+     * @param element El elemento que se almacenará en el nodo.
+     * @param priority La prioridad del elemento.
+     */
+    PairingNode(E element, int priority) {
+        this->element = std::move(element);
+        this->priority = priority;
+        child = next = previous = nullptr;
+    }
+};
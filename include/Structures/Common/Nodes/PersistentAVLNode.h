@@ -0,0 +1,69 @@
+/**
+ * @file PersistentAVLNode.h
+ * @brief Clase que representa un nodo inmutable de un árbol AVL persistente.
+ *
+ * Almacena un elemento, la altura del nodo y punteros compartidos a sus hijos.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm> // Para std::max
+#include <memory>
+
+using std::max;
+using std::shared_ptr;
+
+/**
+ * @brief Clase que representa un nodo inmutable de un árbol AVL persistente.
+ *
+ * Los hijos se referencian con shared_ptr para que varias versiones del árbol puedan
+ * compartir los mismos subárboles. Un nodo no se modifica después de construirse; las
+ * operaciones del árbol crean nodos nuevos para el camino que cambia.
+ *
+ * @tparam E Tipo de los elementos almacenados en el nodo.
+ */
+template <typename E>
+class PersistentAVLNode {
+public:
+    typedef shared_ptr<const PersistentAVLNode<E>> Ptr; ///< Referencia compartida a un nodo.
+
+    E element; ///< El elemento almacenado en el nodo.
+    Ptr left;  ///< Hijo izquierdo del nodo.
+    Ptr right; ///< Hijo derecho del nodo.
+    int height; ///< La altura del nodo.
+
+    /**
+     * @brief Constructor que inicializa un nodo con su elemento y sus hijos.
+     *
+     * La altura se calcula a partir de la de los hijos.
+     *
+     * @param element El elemento que se almacenará en el nodo.
+     * @param left Hijo izquierdo.
+     * @param right Hijo derecho.
+     */
+    PersistentAVLNode(const E& element, const Ptr& left, const Ptr& right)
+        : element(element), left(left), right(right) {
+        height = max(heightOf(left), heightOf(right)) + 1;
+    }
+
+    /**
+     * @brief Obtiene la altura de un subárbol, que es 0 si está vacío.
+     *
+     * @param node Raíz del subárbol.
+     * @return La altura del subárbol.
+     */
+    static int heightOf(const Ptr& node) {
+        return node == nullptr ? 0 : node->height;
+    }
+
+    /**
+     * @brief Calcula la diferencia de altura entre los hijos izquierdo y derecho.
+     *
+     * @return El factor de balanceo del nodo.
+     */
+    int balanceFactor() const {
+        return heightOf(left) - heightOf(right);
+    }
+};
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <utility>
+
 /**
  * @brief Clase que representa un nodo en un árbol binario con enlaces a sus hijos y su padre.
  *
@@ -34,7 +36,7 @@ public:
      * @param element El elemento a almacenar en el nodo.
      */
     SNode(E element) {
-        this->element = element;
+        this->element = std::move(element);
         left = nullptr;
         right = nullptr;
         parent = nullptr;
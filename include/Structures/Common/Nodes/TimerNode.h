@@ -0,0 +1,54 @@
+/**
+ * @file TimerNode.h
+ * @brief Clase que representa un temporizador dentro de una rueda de tiempo.
+ *
+ * Almacena un elemento, el tick en que vence, la ranura de la rueda en que está y
+ * punteros a los nodos siguiente y anterior de esa ranura.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <utility>
+
+/**
+ * @brief Clase que representa un temporizador dentro de una rueda de tiempo.
+ *
+ * Los temporizadores de una misma ranura forman una lista circular doblemente enlazada
+ * con un nodo centinela, por lo que un temporizador puede quitarse de su ranura en O(1)
+ * sin recorrerla.
+ *
+ * @tparam E Tipo de los elementos almacenados en el nodo.
+ */
+template <typename E>
+class TimerNode {
+public:
+    E element;                   ///< El elemento asociado al temporizador.
+    unsigned long long deadline; ///< Tick en que vence el temporizador.
+    int slot;                    ///< Índice global de la ranura que lo contiene.
+    TimerNode<E>* next;          ///< Siguiente nodo de la ranura.
+    TimerNode<E>* previous;      ///< Nodo anterior de la ranura.
+
+    /**
+     * @brief Constructor de un nodo centinela, enlazado consigo mismo.
+     */
+    TimerNode() {
+        deadline = 0;
+        slot = -1;
+        next = previous = this;
+    }
+
+    /**
+     * @brief Constructor que inicializa un temporizador sin enlazar.
+     *
+     * @param element El elemento asociado al temporizador.
+     * @param deadline Tick en que vence el temporizador.
+     */
+    TimerNode(E element, unsigned long long deadline) {
+        this->element = std::move(element);
+        this->deadline = deadline;
+        slot = -1;
+        next = previous = nullptr;
+    }
+};
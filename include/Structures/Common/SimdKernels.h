@@ -0,0 +1,531 @@
+/**
+ * @file SimdKernels.h
+ * @brief Rutinas vectorizadas para recorrer arreglos contiguos de tipos aritméticos.
+ *
+ * Proporciona búsqueda, conteo, comparación, suma, mínimo y máximo sobre arreglos.
+ * Para int, float y uint64_t se utilizan instrucciones SSE2 o AVX2 según lo que
+ * soporte el procesador en tiempo de ejecución; para cualquier otro tipo, o en
+ * plataformas distintas de x86 con GCC/Clang, se utiliza la versión escalar.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_X86 0
+#endif
+
+using std::runtime_error;
+
+/**
+ * @brief Niveles de instrucciones vectoriales disponibles.
+ */
+enum SimdLevel {
+    SIMD_SCALAR = 0, ///< Sin instrucciones vectoriales.
+    SIMD_SSE2 = 1,   ///< Registros de 128 bits.
+    SIMD_AVX2 = 2    ///< Registros de 256 bits.
+};
+
+/**
+ * @brief Detecta el nivel de instrucciones vectoriales que soporta el procesador.
+ *
+ * @return El nivel más alto soportado.
+ */
+inline SimdLevel detectSimdLevel() {
+#if SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return SIMD_AVX2;
+    if (__builtin_cpu_supports("sse2"))
+        return SIMD_SSE2;
+#endif
+    return SIMD_SCALAR;
+}
+
+/**
+ * @brief Nivel de instrucciones vectoriales en uso, detectado en el primer acceso.
+ *
+ * @return Referencia al nivel activo.
+ */
+inline SimdLevel& activeSimdLevel() {
+    static SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+/**
+ * @brief Obtiene el nivel de instrucciones vectoriales en uso.
+ *
+ * @return El nivel activo.
+ */
+inline SimdLevel simdLevel() {
+    return activeSimdLevel();
+}
+
+/**
+ * @brief Limita el nivel de instrucciones vectoriales en uso.
+ *
+ * Útil para comparar las distintas versiones en pruebas y benchmarks.
+ *
+ * @param level Nivel a utilizar.
+ * @throw runtime_error si el procesador no soporta el nivel pedido.
+ */
+inline void setSimdLevel(SimdLevel level) {
+    if (level > detectSimdLevel())
+        throw runtime_error("SIMD level not supported.");
+    activeSimdLevel() = level;
+}
+
+// Versiones escalares, válidas para cualquier tipo.
+
+template <typename T>
+int scalarFind(const T* data, int n, const T& value) {
+    for (int i = 0; i < n; i++)
+        if (data[i] == value)
+            return i;
+    return -1;
+}
+
+template <typename T>
+int scalarCount(const T* data, int n, const T& value) {
+    int count = 0;
+    for (int i = 0; i < n; i++)
+        if (data[i] == value)
+            count++;
+    return count;
+}
+
+template <typename T>
+bool scalarEquals(const T* a, const T* b, int n) {
+    for (int i = 0; i < n; i++)
+        if (!(a[i] == b[i]))
+            return false;
+    return true;
+}
+
+template <typename T>
+T scalarSum(const T* data, int n) {
+    T result = T();
+    for (int i = 0; i < n; i++)
+        result = result + data[i];
+    return result;
+}
+
+template <typename T>
+T scalarMin(const T* data, int n) {
+    T result = data[0];
+    for (int i = 1; i < n; i++)
+        if (data[i] < result)
+            result = data[i];
+    return result;
+}
+
+template <typename T>
+T scalarMax(const T* data, int n) {
+    T result = data[0];
+    for (int i = 1; i < n; i++)
+        if (result < data[i])
+            result = data[i];
+    return result;
+}
+
+#if SIMD_X86
+
+#define SIMD_AVX2_TARGET __attribute__((target("avx2")))
+
+/*
+ * Cada estructura de operaciones describe un registro vectorial: su tipo, cuántos
+ * elementos caben (WIDTH) y las operaciones básicas. eqMask retorna un bit por
+ * elemento, de modo que las rutinas genéricas pueden usar ctz y contar bits.
+ */
+
+template <typename E>
+struct ScalarOps {
+    typedef E T;
+    typedef E V;
+    enum { WIDTH = 1 };
+    static V load(const T* p) { return *p; }
+    static V set1(T x) { return x; }
+    static void store(T* p, V v) { *p = v; }
+    static int eqMask(V a, V b) { return a == b ? 1 : 0; }
+    static V add(V a, V b) { return a + b; }
+    static V min(V a, V b) { return b < a ? b : a; }
+    static V max(V a, V b) { return a < b ? b : a; }
+};
+
+struct Sse2Int32 {
+    typedef int T;
+    typedef __m128i V;
+    enum { WIDTH = 4 };
+    static V load(const T* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static V set1(T x) { return _mm_set1_epi32(x); }
+    static void store(T* p, V v) { _mm_storeu_si128((__m128i*)p, v); }
+    static int eqMask(V a, V b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+    static V add(V a, V b) { return _mm_add_epi32(a, b); }
+    static V min(V a, V b) {
+        __m128i less = _mm_cmplt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(less, a), _mm_andnot_si128(less, b));
+    }
+    static V max(V a, V b) {
+        __m128i greater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(greater, a), _mm_andnot_si128(greater, b));
+    }
+};
+
+struct Sse2Float {
+    typedef float T;
+    typedef __m128 V;
+    enum { WIDTH = 4 };
+    static V load(const T* p) { return _mm_loadu_ps(p); }
+    static V set1(T x) { return _mm_set1_ps(x); }
+    static void store(T* p, V v) { _mm_storeu_ps(p, v); }
+    static int eqMask(V a, V b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+};
+
+struct Avx2Int32 {
+    typedef int T;
+    typedef __m256i V;
+    enum { WIDTH = 8 };
+    SIMD_AVX2_TARGET static V load(const T* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    SIMD_AVX2_TARGET static V set1(T x) { return _mm256_set1_epi32(x); }
+    SIMD_AVX2_TARGET static void store(T* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) {
+        return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+    }
+    SIMD_AVX2_TARGET static V add(V a, V b) { return _mm256_add_epi32(a, b); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+};
+
+struct Avx2Float {
+    typedef float T;
+    typedef __m256 V;
+    enum { WIDTH = 8 };
+    SIMD_AVX2_TARGET static V load(const T* p) { return _mm256_loadu_ps(p); }
+    SIMD_AVX2_TARGET static V set1(T x) { return _mm256_set1_ps(x); }
+    SIMD_AVX2_TARGET static void store(T* p, V v) { _mm256_storeu_ps(p, v); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    SIMD_AVX2_TARGET static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_max_ps(a, b); }
+};
+
+struct Avx2UInt64 {
+    typedef uint64_t T;
+    typedef __m256i V;
+    enum { WIDTH = 4 };
+    SIMD_AVX2_TARGET static V load(const T* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    SIMD_AVX2_TARGET static V set1(T x) { return _mm256_set1_epi64x((long long)x); }
+    SIMD_AVX2_TARGET static void store(T* p, V v) { _mm256_storeu_si256((__m256i*)p, v); }
+    SIMD_AVX2_TARGET static int eqMask(V a, V b) {
+        return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b)));
+    }
+    SIMD_AVX2_TARGET static V add(V a, V b) { return _mm256_add_epi64(a, b); }
+    // AVX2 sólo compara enteros con signo: se invierte el bit de signo para comparar sin signo.
+    SIMD_AVX2_TARGET static V less(V a, V b) {
+        __m256i bias = _mm256_set1_epi64x((long long)0x8000000000000000ULL);
+        return _mm256_cmpgt_epi64(_mm256_xor_si256(b, bias), _mm256_xor_si256(a, bias));
+    }
+    SIMD_AVX2_TARGET static V min(V a, V b) { return _mm256_blendv_epi8(b, a, less(a, b)); }
+    SIMD_AVX2_TARGET static V max(V a, V b) { return _mm256_blendv_epi8(b, a, less(b, a)); }
+};
+
+/**
+ * @brief Asocia a cada tipo soportado las operaciones para cada nivel.
+ */
+template <typename E>
+struct SimdTraits;
+
+template <>
+struct SimdTraits<int> {
+    typedef int T;
+    typedef Sse2Int32 Sse2;
+    typedef Avx2Int32 Avx2;
+};
+
+template <>
+struct SimdTraits<float> {
+    typedef float T;
+    typedef Sse2Float Sse2;
+    typedef Avx2Float Avx2;
+};
+
+template <>
+struct SimdTraits<uint64_t> {
+    typedef uint64_t T;
+    typedef ScalarOps<uint64_t> Sse2; // SSE2 no tiene comparaciones de 64 bits.
+    typedef Avx2UInt64 Avx2;
+};
+
+/*
+ * Rutinas genéricas. Se definen dos veces: una compilada para el conjunto base
+ * (SSE2 es obligatorio en x86-64) y otra con el atributo target("avx2"), ya que
+ * una función sin ese atributo no puede contener instrucciones AVX2.
+ */
+
+template <typename Ops>
+int findKernel(const typename Ops::T* data, int n, typename Ops::T value) {
+    typename Ops::V target = Ops::set1(value);
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+        int mask = Ops::eqMask(Ops::load(data + i), target);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    int rest = scalarFind(data + i, n - i, value);
+    return rest == -1 ? -1 : i + rest;
+}
+
+template <typename Ops>
+int countKernel(const typename Ops::T* data, int n, typename Ops::T value) {
+    typename Ops::V target = Ops::set1(value);
+    int count = 0;
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        for (int mask = Ops::eqMask(Ops::load(data + i), target); mask != 0; mask &= mask - 1)
+            count++;
+    return count + scalarCount(data + i, n - i, value);
+}
+
+template <typename Ops>
+bool equalsKernel(const typename Ops::T* a, const typename Ops::T* b, int n) {
+    const int full = (1 << Ops::WIDTH) - 1;
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        if (Ops::eqMask(Ops::load(a + i), Ops::load(b + i)) != full)
+            return false;
+    return scalarEquals(a + i, b + i, n - i);
+}
+
+template <typename Ops>
+typename Ops::T sumKernel(const typename Ops::T* data, int n) {
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V total = Ops::set1(0);
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        total = Ops::add(total, Ops::load(data + i));
+    Ops::store(lanes, total);
+    typename Ops::T result = scalarSum(lanes, (int)Ops::WIDTH);
+    return result + scalarSum(data + i, n - i);
+}
+
+template <typename Ops>
+typename Ops::T minKernel(const typename Ops::T* data, int n) {
+    if (n < Ops::WIDTH)
+        return scalarMin(data, n);
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V best = Ops::load(data);
+    int i = Ops::WIDTH;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        best = Ops::min(best, Ops::load(data + i));
+    Ops::store(lanes, best);
+    typename Ops::T result = scalarMin(lanes, (int)Ops::WIDTH);
+    return i < n ? ScalarOps<typename Ops::T>::min(result, scalarMin(data + i, n - i)) : result;
+}
+
+template <typename Ops>
+typename Ops::T maxKernel(const typename Ops::T* data, int n) {
+    if (n < Ops::WIDTH)
+        return scalarMax(data, n);
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V best = Ops::load(data);
+    int i = Ops::WIDTH;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        best = Ops::max(best, Ops::load(data + i));
+    Ops::store(lanes, best);
+    typename Ops::T result = scalarMax(lanes, (int)Ops::WIDTH);
+    return i < n ? ScalarOps<typename Ops::T>::max(result, scalarMax(data + i, n - i)) : result;
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET int findKernelAvx2(const typename Ops::T* data, int n, typename Ops::T value) {
+    typename Ops::V target = Ops::set1(value);
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH) {
+        int mask = Ops::eqMask(Ops::load(data + i), target);
+        if (mask != 0)
+            return i + __builtin_ctz(mask);
+    }
+    int rest = scalarFind(data + i, n - i, value);
+    return rest == -1 ? -1 : i + rest;
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET int countKernelAvx2(const typename Ops::T* data, int n, typename Ops::T value) {
+    typename Ops::V target = Ops::set1(value);
+    int count = 0;
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        for (int mask = Ops::eqMask(Ops::load(data + i), target); mask != 0; mask &= mask - 1)
+            count++;
+    return count + scalarCount(data + i, n - i, value);
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET bool equalsKernelAvx2(const typename Ops::T* a, const typename Ops::T* b, int n) {
+    const int full = (1 << Ops::WIDTH) - 1;
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        if (Ops::eqMask(Ops::load(a + i), Ops::load(b + i)) != full)
+            return false;
+    return scalarEquals(a + i, b + i, n - i);
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET typename Ops::T sumKernelAvx2(const typename Ops::T* data, int n) {
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V total = Ops::set1(0);
+    int i = 0;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        total = Ops::add(total, Ops::load(data + i));
+    Ops::store(lanes, total);
+    typename Ops::T result = scalarSum(lanes, (int)Ops::WIDTH);
+    return result + scalarSum(data + i, n - i);
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET typename Ops::T minKernelAvx2(const typename Ops::T* data, int n) {
+    if (n < Ops::WIDTH)
+        return scalarMin(data, n);
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V best = Ops::load(data);
+    int i = Ops::WIDTH;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        best = Ops::min(best, Ops::load(data + i));
+    Ops::store(lanes, best);
+    typename Ops::T result = scalarMin(lanes, (int)Ops::WIDTH);
+    return i < n ? ScalarOps<typename Ops::T>::min(result, scalarMin(data + i, n - i)) : result;
+}
+
+template <typename Ops>
+SIMD_AVX2_TARGET typename Ops::T maxKernelAvx2(const typename Ops::T* data, int n) {
+    if (n < Ops::WIDTH)
+        return scalarMax(data, n);
+    typename Ops::T lanes[Ops::WIDTH];
+    typename Ops::V best = Ops::load(data);
+    int i = Ops::WIDTH;
+    for (; i + Ops::WIDTH <= n; i += Ops::WIDTH)
+        best = Ops::max(best, Ops::load(data + i));
+    Ops::store(lanes, best);
+    typename Ops::T result = scalarMax(lanes, (int)Ops::WIDTH);
+    return i < n ? ScalarOps<typename Ops::T>::max(result, scalarMax(data + i, n - i)) : result;
+}
+
+// Selección de la rutina según el nivel activo.
+
+template <typename Traits>
+int dispatchFind(const typename Traits::T* data, int n, typename Traits::T value) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return findKernelAvx2<typename Traits::Avx2>(data, n, value);
+        case SIMD_SSE2: return findKernel<typename Traits::Sse2>(data, n, value);
+        default: return scalarFind(data, n, value);
+    }
+}
+
+template <typename Traits>
+int dispatchCount(const typename Traits::T* data, int n, typename Traits::T value) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return countKernelAvx2<typename Traits::Avx2>(data, n, value);
+        case SIMD_SSE2: return countKernel<typename Traits::Sse2>(data, n, value);
+        default: return scalarCount(data, n, value);
+    }
+}
+
+template <typename Traits>
+bool dispatchEquals(const typename Traits::T* a, const typename Traits::T* b, int n) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return equalsKernelAvx2<typename Traits::Avx2>(a, b, n);
+        case SIMD_SSE2: return equalsKernel<typename Traits::Sse2>(a, b, n);
+        default: return scalarEquals(a, b, n);
+    }
+}
+
+template <typename Traits>
+typename Traits::T dispatchSum(const typename Traits::T* data, int n) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return sumKernelAvx2<typename Traits::Avx2>(data, n);
+        case SIMD_SSE2: return sumKernel<typename Traits::Sse2>(data, n);
+        default: return scalarSum(data, n);
+    }
+}
+
+template <typename Traits>
+typename Traits::T dispatchMin(const typename Traits::T* data, int n) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return minKernelAvx2<typename Traits::Avx2>(data, n);
+        case SIMD_SSE2: return minKernel<typename Traits::Sse2>(data, n);
+        default: return scalarMin(data, n);
+    }
+}
+
+template <typename Traits>
+typename Traits::T dispatchMax(const typename Traits::T* data, int n) {
+    switch (simdLevel()) {
+        case SIMD_AVX2: return maxKernelAvx2<typename Traits::Avx2>(data, n);
+        case SIMD_SSE2: return maxKernel<typename Traits::Sse2>(data, n);
+        default: return scalarMax(data, n);
+    }
+}
+
+#endif
+
+/*
+ * Punto de entrada público. La plantilla general usa la versión escalar; las
+ * sobrecargas para int, float y uint64_t seleccionan la rutina vectorizada.
+ * minElement/maxElement requieren n > 0.
+ */
+
+template <typename T>
+int simdFind(const T* data, int n, const T& value) { return scalarFind(data, n, value); }
+
+template <typename T>
+int simdCount(const T* data, int n, const T& value) { return scalarCount(data, n, value); }
+
+template <typename T>
+bool simdEquals(const T* a, const T* b, int n) { return scalarEquals(a, b, n); }
+
+template <typename T>
+T simdSum(const T* data, int n) { return scalarSum(data, n); }
+
+template <typename T>
+T simdMin(const T* data, int n) { return scalarMin(data, n); }
+
+template <typename T>
+T simdMax(const T* data, int n) { return scalarMax(data, n); }
+
+#if SIMD_X86
+
+inline int simdFind(const int* data, int n, const int& value) { return dispatchFind<SimdTraits<int>>(data, n, value); }
+inline int simdFind(const float* data, int n, const float& value) { return dispatchFind<SimdTraits<float>>(data, n, value); }
+inline int simdFind(const uint64_t* data, int n, const uint64_t& value) { return dispatchFind<SimdTraits<uint64_t>>(data, n, value); }
+
+inline int simdCount(const int* data, int n, const int& value) { return dispatchCount<SimdTraits<int>>(data, n, value); }
+inline int simdCount(const float* data, int n, const float& value) { return dispatchCount<SimdTraits<float>>(data, n, value); }
+inline int simdCount(const uint64_t* data, int n, const uint64_t& value) { return dispatchCount<SimdTraits<uint64_t>>(data, n, value); }
+
+inline bool simdEquals(const int* a, const int* b, int n) { return dispatchEquals<SimdTraits<int>>(a, b, n); }
+inline bool simdEquals(const float* a, const float* b, int n) { return dispatchEquals<SimdTraits<float>>(a, b, n); }
+inline bool simdEquals(const uint64_t* a, const uint64_t* b, int n) { return dispatchEquals<SimdTraits<uint64_t>>(a, b, n); }
+
+inline int simdSum(const int* data, int n) { return dispatchSum<SimdTraits<int>>(data, n); }
+inline float simdSum(const float* data, int n) { return dispatchSum<SimdTraits<float>>(data, n); }
+inline uint64_t simdSum(const uint64_t* data, int n) { return dispatchSum<SimdTraits<uint64_t>>(data, n); }
+
+inline int simdMin(const int* data, int n) { return dispatchMin<SimdTraits<int>>(data, n); }
+inline float simdMin(const float* data, int n) { return dispatchMin<SimdTraits<float>>(data, n); }
+inline uint64_t simdMin(const uint64_t* data, int n) { return dispatchMin<SimdTraits<uint64_t>>(data, n); }
+
+inline int simdMax(const int* data, int n) { return dispatchMax<SimdTraits<int>>(data, n); }
+inline float simdMax(const float* data, int n) { return dispatchMax<SimdTraits<float>>(data, n); }
+inline uint64_t simdMax(const uint64_t* data, int n) { return dispatchMax<SimdTraits<uint64_t>>(data, n); }
+
+#endif
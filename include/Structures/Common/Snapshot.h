@@ -0,0 +1,731 @@
+/**
+ * @file Snapshot.h
+ * @brief Formato binario de instantáneas para guardar y cargar contenedores.
+ *
+ * Una instantánea es un encabezado de 32 bytes seguido de una o dos columnas: la de los
+ * elementos (o claves) y, en los diccionarios, la de los valores. Cada columna empieza
+ * alineada a 8 bytes:
+ *
+ * - Tipos trivialmente copiables: los elementos uno tras otro, tal como están en memoria.
+ * - string: una tabla de desplazamientos de 8 bytes por elemento, el tamaño del bloque de
+ *   cadenas y el bloque, donde cada cadena está precedida por su largo en 4 bytes.
+ *
+ * Cada columna se identifica en el encabezado con el código de su tipo (ver SnapshotCodec),
+ * que distingue enteros con y sin signo, flotantes, cadenas y tipos del usuario, de modo
+ * que una instantánea sólo se carga en un contenedor del mismo tipo.
+ *
+ * Como las columnas tienen posiciones fijas, el archivo puede proyectarse en memoria con
+ * mmap y consultarse directamente (ver MappedDictionary) sin deserializarlo. El formato
+ * usa el orden de bytes de la máquina que lo escribe.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using std::runtime_error;
+using std::string;
+
+/**
+ * @brief Tipo de contenedor guardado en una instantánea.
+ */
+enum SnapshotKind {
+    SNAPSHOT_SEQUENCE = 1,  ///< Una columna de elementos.
+    SNAPSHOT_DICTIONARY = 2 ///< Una columna de claves y una de valores.
+};
+
+const uint32_t SNAPSHOT_SORTED = 1; ///< Indica que la primera columna está en orden estrictamente creciente.
+
+/**
+ * @brief Encabezado de una instantánea.
+ */
+struct SnapshotHeader {
+    char magic[4];      ///< Siempre "DSNP".
+    uint32_t version;   ///< Versión del formato.
+    uint32_t kind;      ///< Un valor de SnapshotKind.
+    uint32_t flags;     ///< Combinación de banderas, como SNAPSHOT_SORTED.
+    uint32_t keyCode;   ///< Código del tipo de la primera columna (ver SnapshotCodec::code).
+    uint32_t valueCode; ///< Código del tipo de la columna de valores, o 0 en las secuencias.
+    uint64_t count;     ///< Cantidad de elementos o de pares.
+};
+
+static_assert(sizeof(SnapshotHeader) == 32, "El encabezado de la instantánea debe medir 32 bytes.");
+
+const uint32_t SNAPSHOT_VERSION = 2; ///< Versión actual del formato.
+
+/**
+ * @brief Familia del tipo de una columna, guardada en los 4 bits altos de su código.
+ */
+enum SnapshotTypeKind {
+    SNAPSHOT_UNSIGNED = 1, ///< Entero sin signo (incluye bool).
+    SNAPSHOT_SIGNED = 2,   ///< Entero con signo.
+    SNAPSHOT_FLOATING = 3, ///< Número de punto flotante.
+    SNAPSHOT_STRING = 4,   ///< Cadena.
+    SNAPSHOT_USER = 5      ///< Tipo del usuario identificado por su SnapshotTag.
+};
+
+/**
+ * @brief Etiqueta con que se identifica en las instantáneas un tipo trivialmente copiable del usuario.
+ *
+ * Los tipos aritméticos no la necesitan. Para guardar otro tipo se especializa con un valor
+ * entre 1 y 4095 distinto para cada tipo, por ejemplo:
+ *
+ * @code
+ * template <> struct SnapshotTag<Point> { static const uint32_t value = 1; };
+ * @endcode
+ *
+ * Sin especialización el valor es 0 y guardar o cargar el tipo es un error de compilación,
+ * porque su código no distinguiría tipos distintos del mismo tamaño.
+ *
+ * @tparam T Tipo a identificar.
+ */
+template <typename T>
+struct SnapshotTag {
+    static const uint32_t value = 0; ///< Etiqueta del tipo, o 0 si no tiene.
+};
+
+/**
+ * @brief Arma el código de un tipo: familia, etiqueta y tamaño.
+ *
+ * @param kind Familia del tipo.
+ * @param tag Etiqueta del tipo del usuario, o 0.
+ * @param size Tamaño del tipo en bytes, o 0 en las cadenas.
+ * @return El código para el encabezado.
+ */
+inline uint32_t snapshotTypeCode(SnapshotTypeKind kind, uint32_t tag, uint32_t size) {
+    return ((uint32_t)kind << 28) | (tag << 16) | size;
+}
+
+/**
+ * @brief Escribe una instantánea en un archivo, con un búfer propio.
+ *
+ * Los datos se escriben en un archivo temporal junto al destino (su ruta seguida de un
+ * sufijo único creado con mkstemp) que finish() lleva al disco y renombra sobre el
+ * destino. Como cada escritor tiene su propio temporal, dos escritores del mismo destino
+ * no se pisan: el destino queda completo con los datos de alguno de ellos. Si la
+ * escritura falla o no se llega a finish(), el destructor borra el temporal y el archivo
+ * anterior queda intacto. El archivo nuevo conserva los permisos del anterior, o 0644 si
+ * no existía.
+ */
+class SnapshotWriter {
+private:
+    static const int BUFFER_SIZE = 1 << 16; ///< Tamaño del búfer de escritura.
+
+    string path;      ///< Ruta del archivo de destino.
+    string temporary; ///< Ruta del archivo temporal en que se escribe.
+    FILE* file;       ///< Archivo temporal abierto, o nullptr después de cerrarlo.
+    char* buffer;     ///< Datos pendientes de escribir.
+    int pending;      ///< Bytes ocupados del búfer.
+    uint64_t written; ///< Bytes escritos desde el inicio del archivo.
+
+    SnapshotWriter(const SnapshotWriter& other);
+    void operator=(const SnapshotWriter& other);
+
+    /**
+     * @brief Escribe en el archivo el contenido del búfer.
+     */
+    void flush() {
+        if (pending > 0 && fwrite(buffer, 1, pending, file) != (size_t)pending)
+            throw runtime_error("Could not write file.");
+        pending = 0;
+    }
+
+public:
+    /**
+     * @brief Crea el archivo y escribe el encabezado.
+     *
+     * @param path Ruta del archivo; se reemplaza en finish() si existe.
+     * @param kind Tipo de contenedor.
+     * @param flags Banderas del contenido.
+     * @param keyCode Código del tipo de la primera columna.
+     * @param valueCode Código del tipo de los valores, o 0 en las secuencias.
+     * @param count Cantidad de elementos o de pares.
+     * @throw runtime_error Si no se puede crear el archivo temporal.
+     */
+    SnapshotWriter(const string& path, SnapshotKind kind, uint32_t flags, uint32_t keyCode, uint32_t valueCode, uint64_t count)
+        : path(path), temporary(path + ".XXXXXX") {
+        int descriptor = mkstemp(&temporary[0]);
+        if (descriptor < 0)
+            throw runtime_error("Could not open file.");
+        struct stat existing;
+        mode_t mode = stat(path.c_str(), &existing) == 0 ? (existing.st_mode & 07777) : 0644;
+        file = fchmod(descriptor, mode) == 0 ? fdopen(descriptor, "wb") : nullptr;
+        if (file == nullptr) {
+            close(descriptor);
+            std::remove(temporary.c_str());
+            throw runtime_error("Could not open file.");
+        }
+        buffer = new char[BUFFER_SIZE];
+        pending = 0;
+        written = 0;
+        SnapshotHeader header;
+        memcpy(header.magic, "DSNP", 4);
+        header.version = SNAPSHOT_VERSION;
+        header.kind = kind;
+        header.flags = flags;
+        header.keyCode = keyCode;
+        header.valueCode = valueCode;
+        header.count = count;
+        write(&header, sizeof(header));
+    }
+
+    /**
+     * @brief Destructor. Si no se completó finish(), cierra y borra el archivo temporal.
+     */
+    ~SnapshotWriter() {
+        if (file != nullptr) {
+            fclose(file);
+            std::remove(temporary.c_str());
+        }
+        delete[] buffer;
+    }
+
+    /**
+     * @brief Agrega bytes a la instantánea.
+     *
+     * @param data Bytes a escribir.
+     * @param length Cantidad de bytes.
+     * @throw runtime_error Si falla la escritura.
+     */
+    void write(const void* data, size_t length) {
+        const char* bytes = (const char*)data;
+        written += length;
+        while (length > 0) {
+            if (pending == BUFFER_SIZE)
+                flush();
+            size_t room = (size_t)(BUFFER_SIZE - pending);
+            size_t chunk = room < length ? room : length;
+            memcpy(buffer + pending, bytes, chunk);
+            pending += (int)chunk;
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+
+    /**
+     * @brief Completa con ceros hasta la siguiente posición múltiplo de 8.
+     */
+    void align() {
+        static const char zeros[8] = { 0 };
+        write(zeros, (8 - written % 8) % 8);
+    }
+
+    /**
+     * @brief Escribe los datos pendientes, los lleva al disco y reemplaza el destino.
+     *
+     * @throw runtime_error Si falla la escritura, el cierre o el cambio de nombre; en ese
+     * caso el archivo de destino no cambia.
+     */
+    void finish() {
+        flush();
+        bool synced = fflush(file) == 0 && fsync(fileno(file)) == 0;
+        int result = fclose(file);
+        file = nullptr;
+        if (!synced || result != 0 || std::rename(temporary.c_str(), path.c_str()) != 0) {
+            std::remove(temporary.c_str());
+            throw runtime_error("Could not write file.");
+        }
+    }
+};
+
+/**
+ * @brief Codificación de un tipo en las columnas de una instantánea.
+ *
+ * Sólo está definida para los tipos trivialmente copiables y para string; usar otro tipo
+ * es un error de compilación.
+ *
+ * @tparam T Tipo de los elementos.
+ */
+template <typename T, bool Fixed = std::is_trivially_copyable<T>::value>
+struct SnapshotCodec;
+
+/**
+ * @brief Archivo de instantánea proyectado en memoria en modo de sólo lectura.
+ *
+ * Valida el encabezado y entrega las columnas en orden con column(). Las columnas apuntan
+ * directamente a la proyección, por lo que son válidas mientras el archivo esté abierto.
+ */
+class SnapshotFile {
+private:
+    int descriptor;        ///< Descriptor del archivo.
+    char* base;            ///< Inicio de la proyección.
+    size_t length;         ///< Tamaño del archivo.
+    size_t position;       ///< Posición de la siguiente columna.
+    SnapshotHeader header; ///< Encabezado validado.
+
+    SnapshotFile(const SnapshotFile& other);
+    void operator=(const SnapshotFile& other);
+
+    /**
+     * @brief Libera la proyección y el descriptor.
+     */
+    void release() {
+        if (base != nullptr)
+            munmap(base, length);
+        close(descriptor);
+    }
+
+public:
+    /**
+     * @brief Abre y proyecta una instantánea, validando que contenga el tipo esperado.
+     *
+     * @param path Ruta del archivo.
+     * @param kind Tipo de contenedor esperado.
+     * @param keyCode Código esperado para la primera columna.
+     * @param valueCode Código esperado para los valores, o 0 en las secuencias.
+     * @param sequential true si se leerá completo en orden (carga); false para accesos aleatorios.
+     * @throw runtime_error Si no se puede abrir el archivo o no es una instantánea compatible.
+     */
+    SnapshotFile(const string& path, SnapshotKind kind, uint32_t keyCode, uint32_t valueCode, bool sequential) {
+        descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0)
+            throw runtime_error("Could not open file.");
+        base = nullptr;
+        struct stat status;
+        if (fstat(descriptor, &status) != 0 || status.st_size < (off_t)sizeof(SnapshotHeader)) {
+            release();
+            throw runtime_error("Invalid snapshot.");
+        }
+        length = (size_t)status.st_size;
+        void* mapping = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            release();
+            throw runtime_error("Could not map file.");
+        }
+        base = (char*)mapping;
+        madvise(base, length, sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+        memcpy(&header, base, sizeof(header));
+        if (memcmp(header.magic, "DSNP", 4) != 0 || header.version != SNAPSHOT_VERSION || header.kind != (uint32_t)kind
+            || header.keyCode != keyCode || header.valueCode != valueCode || header.count > (uint64_t)INT32_MAX) {
+            release();
+            throw runtime_error("Invalid snapshot.");
+        }
+        position = sizeof(header);
+    }
+
+    ~SnapshotFile() {
+        release();
+    }
+
+    /**
+     * @brief Obtiene la cantidad de elementos o de pares.
+     */
+    int getCount() const {
+        return (int)header.count;
+    }
+
+    /**
+     * @brief Indica si la primera columna está en orden estrictamente creciente.
+     */
+    bool isSorted() const {
+        return (header.flags & SNAPSHOT_SORTED) != 0;
+    }
+
+    /**
+     * @brief Toma los siguientes bytes de la proyección y avanza a la siguiente posición alineada.
+     *
+     * @param bytes Cantidad de bytes.
+     * @return Puntero al inicio de los bytes dentro de la proyección.
+     * @throw runtime_error Si el archivo es más corto de lo indicado.
+     */
+    const char* take(uint64_t bytes) {
+        if (bytes > length - position)
+            throw runtime_error("Invalid snapshot.");
+        const char* result = base + position;
+        position += (size_t)bytes;
+        position += (8 - position % 8) % 8;
+        if (position > length)
+            position = length;
+        return result;
+    }
+
+    /**
+     * @brief Lee la siguiente columna.
+     *
+     * @tparam T Tipo de los elementos de la columna.
+     * @return La columna, que apunta a la proyección.
+     */
+    template <typename T>
+    typename SnapshotCodec<T>::Column column();
+};
+
+/**
+ * @brief Columna de elementos de tamaño fijo dentro de una proyección.
+ */
+template <typename T>
+class FixedSnapshotColumn {
+private:
+    const T* data; ///< Primer elemento.
+    int count;     ///< Cantidad de elementos.
+
+public:
+    typedef const T& Reference; ///< Tipo con que se entregan los elementos.
+
+    FixedSnapshotColumn() : data(nullptr), count(0) {}
+
+    FixedSnapshotColumn(const T* data, int count) : data(data), count(count) {}
+
+    Reference operator[](int i) const {
+        return data[i];
+    }
+
+    /**
+     * @brief Retorna la dirección de un elemento dentro de la proyección.
+     */
+    const T* address(int i) const {
+        return data + i;
+    }
+
+    bool less(int i, const T& key) const {
+        return data[i] < key;
+    }
+
+    bool greater(int i, const T& key) const {
+        return key < data[i];
+    }
+
+    /**
+     * @brief Valida la columna; los elementos de tamaño fijo siempre son válidos.
+     */
+    void validate() const {}
+
+    /**
+     * @brief Copia todos los elementos a un arreglo.
+     */
+    void copyTo(T* out) const {
+        memcpy((void*)out, (const void*)data, sizeof(T) * (size_t)count);
+    }
+};
+
+/**
+ * @brief Columna de cadenas dentro de una proyección.
+ *
+ * Las comparaciones leen los bytes de la proyección directamente, sin construir string.
+ */
+class StringSnapshotColumn {
+private:
+    const uint64_t* offsets; ///< Desplazamiento de cada cadena dentro del bloque.
+    const char* blob;        ///< Bloque de cadenas, cada una precedida por su largo.
+    uint64_t blobSize;       ///< Tamaño del bloque.
+    int count;               ///< Cantidad de cadenas.
+
+    /**
+     * @brief Ubica una cadena y valida que esté dentro del bloque.
+     */
+    const char* locate(int i, uint32_t* length) const {
+        uint64_t offset = offsets[i];
+        if (offset > blobSize || blobSize - offset < 4)
+            throw runtime_error("Invalid snapshot.");
+        memcpy(length, blob + offset, 4);
+        if (*length > blobSize - offset - 4)
+            throw runtime_error("Invalid snapshot.");
+        return blob + offset + 4;
+    }
+
+    int compare(int i, const string& key) const {
+        uint32_t length;
+        const char* bytes = locate(i, &length);
+        size_t common = length < key.size() ? length : key.size();
+        int result = memcmp(bytes, key.data(), common);
+        if (result != 0)
+            return result;
+        return length < key.size() ? -1 : (length > key.size() ? 1 : 0);
+    }
+
+public:
+    typedef string Reference; ///< Tipo con que se entregan los elementos.
+
+    StringSnapshotColumn() : offsets(nullptr), blob(nullptr), blobSize(0), count(0) {}
+
+    StringSnapshotColumn(const uint64_t* offsets, const char* blob, uint64_t blobSize, int count)
+        : offsets(offsets), blob(blob), blobSize(blobSize), count(count) {}
+
+    Reference operator[](int i) const {
+        uint32_t length;
+        const char* bytes = locate(i, &length);
+        return string(bytes, length);
+    }
+
+    bool less(int i, const string& key) const {
+        return compare(i, key) < 0;
+    }
+
+    bool greater(int i, const string& key) const {
+        return compare(i, key) > 0;
+    }
+
+    /**
+     * @brief Verifica que todas las cadenas estén dentro del bloque.
+     *
+     * Las cargas lo llaman antes de construir el contenedor, para que un archivo dañado no
+     * lo deje a medio construir.
+     *
+     * @throw runtime_error Si alguna cadena se sale del bloque.
+     */
+    void validate() const {
+        uint32_t length;
+        for (int i = 0; i < count; i++)
+            locate(i, &length);
+    }
+
+    /**
+     * @brief Copia todas las cadenas a un arreglo.
+     */
+    void copyTo(string* out) const {
+        for (int i = 0; i < count; i++) {
+            uint32_t length;
+            const char* bytes = locate(i, &length);
+            out[i].assign(bytes, length);
+        }
+    }
+};
+
+/**
+ * @brief Codificación de los tipos trivialmente copiables: sus bytes, uno tras otro.
+ */
+template <typename T>
+struct SnapshotCodec<T, true> {
+    static_assert(alignof(T) <= 8, "Las columnas de la instantánea están alineadas a 8 bytes.");
+
+    typedef FixedSnapshotColumn<T> Column; ///< Columna leída.
+
+    static_assert(sizeof(T) <= 0xFFFF, "Los elementos de la instantánea deben medir menos de 64 KiB.");
+    static_assert(std::is_arithmetic<T>::value || (SnapshotTag<T>::value > 0 && SnapshotTag<T>::value <= 0xFFF),
+                  "Para guardar un tipo que no es aritmético hay que especializar SnapshotTag con una etiqueta entre 1 y 4095.");
+
+    /**
+     * @brief Código del tipo en el encabezado: su familia, su etiqueta si es del usuario y su tamaño.
+     */
+    static uint32_t code() {
+        SnapshotTypeKind kind = std::is_floating_point<T>::value ? SNAPSHOT_FLOATING
+                              : !std::is_arithmetic<T>::value ? SNAPSHOT_USER
+                              : std::is_signed<T>::value ? SNAPSHOT_SIGNED : SNAPSHOT_UNSIGNED;
+        return snapshotTypeCode(kind, std::is_arithmetic<T>::value ? 0 : SnapshotTag<T>::value, (uint32_t)sizeof(T));
+    }
+
+    /**
+     * @brief Escribe una columna a partir de una función que entrega cada elemento.
+     *
+     * @param writer Destino.
+     * @param count Cantidad de elementos.
+     * @param element Función que recibe una posición y retorna una referencia al elemento.
+     */
+    template <typename Source>
+    static void write(SnapshotWriter& writer, int count, Source element) {
+        for (int i = 0; i < count; i++)
+            writer.write(&element(i), sizeof(T));
+        writer.align();
+    }
+
+    /**
+     * @brief Escribe una columna a partir de un arreglo contiguo, en una sola copia.
+     */
+    static void writeArray(SnapshotWriter& writer, const T* data, int count) {
+        writer.write(data, sizeof(T) * (size_t)count);
+        writer.align();
+    }
+
+    /**
+     * @brief Lee una columna de la proyección.
+     */
+    static Column read(SnapshotFile& file, int count) {
+        return Column((const T*)file.take(sizeof(T) * (uint64_t)count), count);
+    }
+};
+
+/**
+ * @brief Codificación de las cadenas: tabla de desplazamientos y cadenas precedidas por su largo.
+ */
+template <>
+struct SnapshotCodec<string, false> {
+    typedef StringSnapshotColumn Column; ///< Columna leída.
+
+    /**
+     * @brief Código del tipo en el encabezado: la familia de las cadenas.
+     */
+    static uint32_t code() {
+        return snapshotTypeCode(SNAPSHOT_STRING, 0, 0);
+    }
+
+    /**
+     * @brief Escribe una columna a partir de una función que entrega cada cadena.
+     *
+     * Recorre las cadenas dos veces: la primera escribe los desplazamientos y la segunda
+     * el bloque, de modo que no se necesita memoria adicional.
+     */
+    template <typename Source>
+    static void write(SnapshotWriter& writer, int count, Source element) {
+        uint64_t offset = 0;
+        for (int i = 0; i < count; i++) {
+            writer.write(&offset, sizeof(offset));
+            offset += 4 + element(i).size();
+        }
+        writer.write(&offset, sizeof(offset));
+        for (int i = 0; i < count; i++) {
+            const string& text = element(i);
+            if (text.size() > UINT32_MAX)
+                throw runtime_error("String too long.");
+            uint32_t length = (uint32_t)text.size();
+            writer.write(&length, sizeof(length));
+            writer.write(text.data(), length);
+        }
+        writer.align();
+    }
+
+    static void writeArray(SnapshotWriter& writer, const string* data, int count) {
+        write(writer, count, [data](int i) -> const string& { return data[i]; });
+    }
+
+    static Column read(SnapshotFile& file, int count) {
+        const uint64_t* offsets = (const uint64_t*)file.take(sizeof(uint64_t) * (uint64_t)count);
+        uint64_t blobSize;
+        memcpy(&blobSize, file.take(sizeof(blobSize)), sizeof(blobSize));
+        const char* blob = file.take(blobSize);
+        return Column(offsets, blob, blobSize, count);
+    }
+};
+
+template <typename T>
+typename SnapshotCodec<T>::Column SnapshotFile::column() {
+    return SnapshotCodec<T>::read(*this, getCount());
+}
+
+/**
+ * @brief Obtiene la primera posición de una columna ordenada cuyo elemento no es menor que la clave.
+ *
+ * @param column Columna en orden creciente.
+ * @param count Cantidad de elementos.
+ * @param key Clave de referencia.
+ * @return La posición encontrada, o count si todos son menores.
+ */
+template <typename Column, typename T>
+int snapshotLowerBound(const Column& column, int count, const T& key) {
+    int low = 0;
+    int length = count;
+    while (length > 0) {
+        int half = length / 2;
+        if (column.less(low + half, key)) {
+            low += half + 1;
+            length -= half + 1;
+        } else {
+            length = half;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Verifica que una columna esté en orden estrictamente creciente.
+ *
+ * @throw runtime_error Si hay elementos repetidos o fuera de orden.
+ */
+template <typename Column>
+void checkSnapshotSorted(const Column& column, int count) {
+    for (int i = 1; i < count; i++)
+        if (!column.less(i - 1, column[i]))
+            throw runtime_error("Invalid snapshot.");
+}
+
+/**
+ * @brief Referencias a un par que se va a guardar.
+ */
+template <typename K, typename V>
+struct SnapshotEntry {
+    const K* key;   ///< Clave del par.
+    const V* value; ///< Valor del par.
+};
+
+/**
+ * @brief Guarda un diccionario recorriéndolo con forEach().
+ *
+ * Si el diccionario no recorre sus pares en orden de clave, se ordenan referencias a
+ * ellos antes de escribirlos, para que la instantánea pueda consultarse con búsqueda
+ * binaria.
+ *
+ * @param dictionary Diccionario a guardar.
+ * @param path Ruta del archivo.
+ * @param ordered true si forEach() entrega las claves en orden creciente.
+ * @throw runtime_error Si no se puede escribir el archivo.
+ */
+template <typename K, typename V, typename D>
+void saveDictionarySnapshot(D& dictionary, const string& path, bool ordered) {
+    int count = dictionary.getSize();
+    SnapshotEntry<K, V>* entries = new SnapshotEntry<K, V>[count > 0 ? count : 1];
+    int filled = 0;
+    dictionary.forEach([entries, &filled](const K& key, V& value) {
+        entries[filled].key = &key;
+        entries[filled].value = &value;
+        filled++;
+    });
+    if (!ordered)
+        std::sort(entries, entries + count, [](const SnapshotEntry<K, V>& a, const SnapshotEntry<K, V>& b) {
+            return *a.key < *b.key;
+        });
+    try {
+        SnapshotWriter writer(path, SNAPSHOT_DICTIONARY, SNAPSHOT_SORTED,
+                              SnapshotCodec<K>::code(), SnapshotCodec<V>::code(), (uint64_t)count);
+        SnapshotCodec<K>::write(writer, count, [entries](int i) -> const K& { return *entries[i].key; });
+        SnapshotCodec<V>::write(writer, count, [entries](int i) -> const V& { return *entries[i].value; });
+        writer.finish();
+    } catch (...) {
+        delete[] entries;
+        throw;
+    }
+    delete[] entries;
+}
+
+/**
+ * @brief Instantánea de un diccionario abierta, con sus columnas de claves y de valores.
+ *
+ * @tparam K Tipo de las claves.
+ * @tparam V Tipo de los valores.
+ */
+template <typename K, typename V>
+struct DictionarySnapshot {
+    SnapshotFile file;                        ///< Archivo proyectado.
+    typename SnapshotCodec<K>::Column keys;   ///< Claves, en orden estrictamente creciente.
+    typename SnapshotCodec<V>::Column values; ///< Valores, paralelos a las claves.
+
+    /**
+     * @brief Abre la instantánea de un diccionario.
+     *
+     * Para cargarla (loading en true) se lee en orden y se valida completa: las cadenas
+     * y el orden de las claves. Para consultarla en su lugar sólo se valida la estructura
+     * del archivo, y cada cadena se verifica al leerla.
+     *
+     * @param path Ruta del archivo.
+     * @param loading true si se va a recorrer completa para cargarla en un diccionario.
+     * @throw runtime_error Si no se puede abrir el archivo o no es un diccionario de K a V.
+     */
+    DictionarySnapshot(const string& path, bool loading)
+        : file(path, SNAPSHOT_DICTIONARY, SnapshotCodec<K>::code(), SnapshotCodec<V>::code(), loading),
+          keys(file.column<K>()), values(file.column<V>()) {
+        if (!file.isSorted())
+            throw runtime_error("Invalid snapshot.");
+        if (loading) {
+            keys.validate();
+            values.validate();
+            checkSnapshotSorted(keys, file.getCount());
+        }
+    }
+
+    /**
+     * @brief Obtiene la cantidad de pares.
+     */
+    int getCount() const {
+        return file.getCount();
+    }
+};
@@ -0,0 +1,202 @@
+/**
+ * @file Sorting.h
+ * @brief Algoritmos de ordenamiento utilizados por las listas.
+ *
+ * Incluye un ordenamiento paralelo para arreglos contiguos (introsort por bloques o
+ * radix sort para claves enteras, seguido de mezclas en paralelo) y un merge sort
+ * para cadenas de nodos enlazados que sólo reenlaza punteros.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Structures/Common/MemoryResource.h"
+
+/**
+ * @brief Tamaño mínimo de un bloque para que valga la pena ordenarlo en otro hilo.
+ */
+const int PARALLEL_SORT_GRAIN = 1 << 16;
+
+/**
+ * @brief Ordena un arreglo de enteros con radix sort LSD de 8 bits por dígito.
+ *
+ * Es estable. Las pasadas en las que todos los elementos comparten el mismo dígito
+ * se omiten. Para tipos con signo se invierte el bit de signo del dígito más alto.
+ *
+ * @param data Arreglo a ordenar.
+ * @param buffer Arreglo auxiliar de al menos n elementos.
+ * @param n Cantidad de elementos.
+ */
+template <typename E>
+void radixSort(E* data, E* buffer, int n) {
+    typedef typename std::make_unsigned<E>::type U;
+    const int digits = (int)sizeof(E);
+    E* src = data;
+    E* dst = buffer;
+    for (int d = 0; d < digits; d++) {
+        int shift = d * 8;
+        U flip = (std::is_signed<E>::value && d == digits - 1) ? 0x80 : 0;
+        int counts[256] = { 0 };
+        for (int i = 0; i < n; i++)
+            counts[(((U)src[i] >> shift) & 0xFF) ^ flip]++;
+        bool trivial = false;
+        for (int b = 0; b < 256; b++)
+            if (counts[b] == n)
+                trivial = true;
+        if (trivial)
+            continue;
+        int offset = 0;
+        for (int b = 0; b < 256; b++) {
+            int count = counts[b];
+            counts[b] = offset;
+            offset += count;
+        }
+        for (int i = 0; i < n; i++)
+            dst[counts[(((U)src[i] >> shift) & 0xFF) ^ flip]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != data)
+        std::copy(src, src + n, data);
+}
+
+/**
+ * @brief Ordena un bloque de enteros (radix sort, siempre estable).
+ */
+template <typename E>
+void sortBlock(E* data, E* buffer, int n, bool, std::true_type) {
+    radixSort(data, buffer, n);
+}
+
+/**
+ * @brief Ordena un bloque de un tipo general (introsort o merge sort estable).
+ */
+template <typename E>
+void sortBlock(E* data, E*, int n, bool stable, std::false_type) {
+    if (stable)
+        std::stable_sort(data, data + n);
+    else
+        std::sort(data, data + n);
+}
+
+/**
+ * @brief Ordena un arreglo contiguo, utilizando varios hilos si es grande.
+ *
+ * El arreglo se divide en un bloque por hilo; cada bloque se ordena por separado
+ * (radix sort para enteros, introsort o merge sort para el resto) y luego los bloques
+ * se mezclan de dos en dos, también en paralelo, alternando entre el arreglo y un
+ * arreglo auxiliar. La mezcla toma primero del bloque izquierdo en caso de empate,
+ * por lo que el resultado es estable si el ordenamiento de los bloques lo es.
+ *
+ * El arreglo auxiliar sólo se reserva si se usa, es decir, con radix sort o con más de
+ * un bloque, y se obtiene del recurso indicado.
+ *
+ * @param data Arreglo a ordenar.
+ * @param n Cantidad de elementos.
+ * @param stable Indica si debe conservarse el orden relativo de elementos iguales.
+ * @param threads Cantidad máxima de hilos; 0 utiliza los que reporte el sistema.
+ * @param resource Recurso del que se obtiene el arreglo auxiliar (ver MemoryResource.h).
+ */
+template <typename E>
+void parallelSort(E* data, int n, bool stable, int threads = 0, MemoryResource* resource = defaultResource()) {
+    if (n < 2)
+        return;
+    if (threads <= 0)
+        threads = (int)std::thread::hardware_concurrency();
+    if (threads < 1)
+        threads = 1;
+    if (threads > n / PARALLEL_SORT_GRAIN)
+        threads = n / PARALLEL_SORT_GRAIN > 0 ? n / PARALLEL_SORT_GRAIN : 1;
+
+    typedef std::integral_constant<bool, std::is_integral<E>::value && !std::is_same<E, bool>::value> IsIntegral;
+    E* buffer = IsIntegral::value || threads > 1 ? createArray<E>(resource, n) : nullptr;
+
+    std::vector<int> bounds(threads + 1);
+    for (int t = 0; t <= threads; t++)
+        bounds[t] = (int)((long long)n * t / threads);
+
+    std::vector<std::thread> workers;
+    for (int t = 1; t < threads; t++)
+        workers.push_back(std::thread([=]() {
+            sortBlock(data + bounds[t], buffer + bounds[t], bounds[t + 1] - bounds[t], stable, IsIntegral());
+        }));
+    sortBlock(data, buffer, bounds[1], stable, IsIntegral());
+    for (size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+
+    E* src = data;
+    E* dst = buffer;
+    while (bounds.size() > 2) {
+        std::vector<int> merged;
+        workers.clear();
+        for (size_t b = 0; b + 1 < bounds.size(); b += 2) {
+            merged.push_back(bounds[b]);
+            int first = bounds[b];
+            int middle = bounds[b + 1];
+            int last = b + 2 < bounds.size() ? bounds[b + 2] : middle;
+            workers.push_back(std::thread([=]() {
+                std::merge(std::make_move_iterator(src + first), std::make_move_iterator(src + middle),
+                           std::make_move_iterator(src + middle), std::make_move_iterator(src + last), dst + first);
+            }));
+        }
+        merged.push_back(n);
+        for (size_t t = 0; t < workers.size(); t++)
+            workers[t].join();
+        bounds = merged;
+        std::swap(src, dst);
+    }
+    if (src != data)
+        std::move(src, src + n, data);
+    destroyArray(resource, buffer, n);
+}
+
+/**
+ * @brief Ordena una cadena de nodos enlazados por su campo next con merge sort.
+ *
+ * Sólo reenlaza los punteros next; los elementos no se copian. Es estable. La cadena
+ * recibida debe tener exactamente n nodos; el último nodo de la cadena resultante
+ * apunta a nullptr. Sirve para cualquier nodo con los campos element y next.
+ *
+ * @param first Primer nodo de la cadena.
+ * @param n Cantidad de nodos de la cadena.
+ * @return El primer nodo de la cadena ordenada.
+ */
+template <typename N>
+N* mergeSortNodes(N* first, int n) {
+    if (n < 2) {
+        if (first != nullptr)
+            first->next = nullptr;
+        return first;
+    }
+    int half = n / 2;
+    N* middle = first;
+    for (int i = 0; i < half; i++)
+        middle = middle->next;
+    N* left = mergeSortNodes(first, half);
+    N* right = mergeSortNodes(middle, n - half);
+
+    N* result = nullptr;
+    N* last = nullptr;
+    while (left != nullptr && right != nullptr) {
+        N* taken;
+        if (right->element < left->element) {
+            taken = right;
+            right = right->next;
+        } else {
+            taken = left;
+            left = left->next;
+        }
+        if (last == nullptr)
+            result = taken;
+        else
+            last->next = taken;
+        last = taken;
+    }
+    last->next = left != nullptr ? left : right;
+    return result;
+}
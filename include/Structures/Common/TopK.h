@@ -0,0 +1,49 @@
+/**
+ * @file TopK.h
+ * @brief Selección de los k mayores elementos de una secuencia en una sola pasada.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <stdexcept>
+#include "Structures/Implementations/Queues/MinHeap.h"
+
+using std::runtime_error;
+
+/**
+ * @brief Obtiene los k mayores elementos de una secuencia recorriéndola una sola vez.
+ *
+ * Mantiene un MinHeap 4-ario con los k mayores vistos hasta el momento: cada elemento
+ * nuevo se compara con el mínimo del heap y sólo si es mayor lo reemplaza con pushPop()
+ * (un sift-down). Usa O(k) memoria sin importar el largo de la secuencia, por lo que la
+ * secuencia puede generarse sobre la marcha. El costo es O(n) comparaciones más
+ * O(m log k), donde m es la cantidad de veces que cambia el conjunto de los k mayores.
+ *
+ * @tparam E Tipo de los elementos.
+ * @tparam Iterable Cualquier tipo recorrible con un for de rango cuyos elementos sean E.
+ * @param items Secuencia a recorrer.
+ * @param k Cantidad de elementos a seleccionar.
+ * @param out Arreglo de al menos k posiciones donde se guardan los elementos en orden descendente.
+ * @return Cantidad de elementos seleccionados (k, o menos si la secuencia era más corta).
+ * @throw runtime_error Si k es negativo.
+ */
+template <typename E, typename Iterable>
+int topK(const Iterable& items, int k, E* out) {
+    if (k < 0)
+        throw runtime_error("Invalid batch size.");
+    if (k == 0)
+        return 0;
+    MinHeap<E, 4> heap(k);
+    for (const E& item : items) {
+        if (heap.getSize() < k)
+            heap.insert(item);
+        else
+            heap.pushPop(item);
+    }
+    int count = heap.popN(k, out);
+    std::reverse(out, out + count);
+    return count;
+}
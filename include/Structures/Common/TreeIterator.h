@@ -0,0 +1,128 @@
+/**
+ * @file TreeIterator.h
+ * @brief Iterador en orden para los árboles binarios de búsqueda.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+/**
+ * @brief Iterador que recorre un árbol binario en orden sin modificarlo.
+ *
+ * Guarda en una pila los ancestros cuyo subárbol derecho falta visitar. La pila vive
+ * dentro del iterador para alturas de hasta INLINE_DEPTH, lo que cubre cualquier árbol
+ * AVL que quepa en memoria, y sólo se pasa a memoria dinámica si el árbol es más alto
+ * (por ejemplo, un BST degenerado). Avanzar cuesta O(1) amortizado.
+ *
+ * Los elementos se entregan por referencia: modificar la parte del elemento que
+ * determina su orden invalida el árbol.
+ *
+ * @tparam N Tipo de los nodos; debe tener los campos element, left y right.
+ * @tparam E Tipo de los elementos.
+ */
+template <typename N, typename E>
+class TreeIterator {
+private:
+    static const int INLINE_DEPTH = 64; ///< Altura que cabe en la pila interna.
+
+    N* buffer[INLINE_DEPTH]; ///< Pila interna.
+    N** stack;               ///< Pila en uso: buffer, o un arreglo dinámico si el árbol es más alto.
+    int capacity;            ///< Capacidad de la pila en uso.
+    int count;               ///< Cantidad de nodos en la pila; el actual es el último.
+
+    /**
+     * @brief Agrega un nodo a la pila, duplicando su capacidad si está llena.
+     */
+    void push(N* node) {
+        if (count == capacity) {
+            N** larger = new N*[capacity * 2];
+            for (int i = 0; i < count; i++)
+                larger[i] = stack[i];
+            if (stack != buffer)
+                delete[] stack;
+            stack = larger;
+            capacity *= 2;
+        }
+        stack[count++] = node;
+    }
+
+    /**
+     * @brief Agrega a la pila un nodo y toda su rama izquierda.
+     */
+    void pushLeft(N* node) {
+        while (node != nullptr) {
+            push(node);
+            node = node->left;
+        }
+    }
+
+    /**
+     * @brief Copia la pila de otro iterador.
+     */
+    void copyFrom(const TreeIterator<N, E>& other) {
+        capacity = other.capacity;
+        count = other.count;
+        stack = capacity == INLINE_DEPTH ? buffer : new N*[capacity];
+        for (int i = 0; i < count; i++)
+            stack[i] = other.stack[i];
+    }
+
+public:
+    /**
+     * @brief Construye el iterador de fin de recorrido.
+     */
+    TreeIterator() : stack(buffer), capacity(INLINE_DEPTH), count(0) {}
+
+    /**
+     * @brief Construye un iterador posicionado en el menor elemento del árbol.
+     *
+     * @param root Raíz del árbol; puede ser nullptr.
+     */
+    explicit TreeIterator(N* root) : stack(buffer), capacity(INLINE_DEPTH), count(0) {
+        pushLeft(root);
+    }
+
+    TreeIterator(const TreeIterator<N, E>& other) {
+        copyFrom(other);
+    }
+
+    TreeIterator<N, E>& operator=(const TreeIterator<N, E>& other) {
+        if (this != &other) {
+            if (stack != buffer)
+                delete[] stack;
+            copyFrom(other);
+        }
+        return *this;
+    }
+
+    ~TreeIterator() {
+        if (stack != buffer)
+            delete[] stack;
+    }
+
+    E& operator*() {
+        return stack[count - 1]->element;
+    }
+
+    E* operator->() {
+        return &stack[count - 1]->element;
+    }
+
+    /**
+     * @brief Avanza al sucesor en orden.
+     */
+    TreeIterator<N, E>& operator++() {
+        N* node = stack[--count];
+        pushLeft(node->right);
+        return *this;
+    }
+
+    bool operator==(const TreeIterator<N, E>& other) const {
+        return count == other.count && (count == 0 || stack[count - 1] == other.stack[count - 1]);
+    }
+
+    bool operator!=(const TreeIterator<N, E>& other) const {
+        return !(*this == other);
+    }
+};
@@ -13,9 +13,16 @@
 #include <string>
 #include <stdexcept>
 #include <cstdlib>
+#include <cstring>
 #include <cmath>
+#include <utility>
 #include "Structures/Implementations/Lists/DLinkedList.h"
+#include "Structures/Common/Instrumentation.h"
+#include "Structures/Common/DictionaryEntry.h"
+#include "Structures/Common/Snapshot.h"
 #include "Structures/Common/KVPair.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Abstract/Dictionary.h"
 
 using std::runtime_error;
@@ -32,10 +39,24 @@ private:
     double maxLoad; ///< Factor de carga máximo permitido.
     double minLoad; ///< Factor de carga mínimo permitido.
     DLinkedList<int> *primes; ///< Lista de números primos para el tamaño de la tabla.
+    MemoryResource* resource; ///< Recurso del que se obtienen las cubetas y sus nodos.
+
+    /**
+     * @brief Operaciones instrumentadas; su trabajo es la cantidad de pares comparados.
+     */
+    enum Operation { INSERT, REMOVE, GET_VALUE, SET_VALUE, CONTAINS, OPERATION_COUNT };
+
+    /**
+     * @brief Contadores instrumentados.
+     */
+    enum Counter { REHASHES, COUNTER_COUNT };
+
+    typedef Instrumentation<OPERATION_COUNT, COUNTER_COUNT> Instruments; ///< Política de instrumentación.
+    Instruments instrumentation; ///< Mediciones de las operaciones (vacías si no se compila con STRUCTURES_INSTRUMENTATION).
 
     // Carga números primos para ser usados como capacidad máxima de la tabla. Inicia en 1021.
     void initPrimes() {
-        primes = new DLinkedList<int>();
+        primes = create<DLinkedList<int>>(resource, resource);
         primes->append(61);
         primes->append(127);
         primes->append(251);
@@ -52,6 +73,12 @@ private:
         primes->append(520679);
         primes->append(1041349);
         primes->append(2082709);
+        primes->append(4165451);
+        primes->append(8330923);
+        primes->append(16661851);
+        primes->append(33323707);
+        primes->append(66647417);
+        primes->append(133294853);
         primes->goToPos(4);
     }
 
@@ -81,58 +108,84 @@ private:
 
     // Redimensiona la tabla al tamaño indicado.
     void reHash(int newMax) {
+        instrumentation.count(REHASHES);
         int oldMax = max;
         max = newMax;
-        DLinkedList<KVPair<K, V>> *newBuckets = new DLinkedList<KVPair<K, V>>[max];
+        DLinkedList<KVPair<K, V>> *newBuckets = createArray<DLinkedList<KVPair<K, V>>>(resource, max, resource);
         for (int i = 0; i < oldMax; i++) {
             buckets[i].goToStart();
             while (!buckets[i].getSize() == 0) {
                 KVPair<K, V> p = buckets[i].remove();
-                newBuckets[h(p.key)].append(p);
+                newBuckets[h(p.key)].append(std::move(p));
             }
         }
-        delete [] buckets;
+        destroyArray(resource, buckets, oldMax);
         buckets = newBuckets;
     }
 
-    // Revisa que una llave no exista en la estructura.
-    // Si la encuentra, lanza un error.
-    // Si no la encuentra, la posición actual queda al final.
-    void checkNotExisting(K key) {
-        KVPair<K, V> p(key);
-        if (buckets[h(key)].contains(p))
-            throw runtime_error("Duplicated key.");
+    // Busca el par con la llave indicada sin copiarlo.
+    // Retorna un puntero al par, o nullptr si no existe.
+    // Agrega a la medición la cantidad de pares comparados.
+    // La llave puede ser de cualquier tipo transparente para K (ver TransparentKey).
+    template <typename Q>
+    KVPair<K, V>* search(const Q& key, typename Instruments::Scope& scope) {
+        DLinkedList<KVPair<K, V>>& bucket = buckets[h(key)];
+        KVPair<K, V>* pair = bucket.findKey(key);
+        scope.addWork(pair != nullptr ? bucket.getPos() + 1 : bucket.getSize());
+        return pair;
     }
 
-    // Revisa que una llave exista en la estructura.
-    // Si la encuentra, deja la posición actual apuntando a la llave buscada.
+    // Prepara la eliminación de la llave indicada, reduciendo la tabla si hace falta.
+    // Si la encuentra, retorna su bucket con la posición actual apuntando al par.
+    // Si no la encuentra, retorna nullptr sin lanzar errores.
+    // Agrega a la medición la cantidad de pares comparados.
+    template <typename Q>
+    DLinkedList<KVPair<K, V>>* locateForRemoval(const Q& key, typename Instruments::Scope& scope) {
+        if (loadFactor() <= minLoad)
+            reHashDown();
+        DLinkedList<KVPair<K, V>>* bucket = &buckets[h(key)];
+        bool found = bucket->findKey(key) != nullptr;
+        scope.addWork(found ? bucket->getPos() + 1 : bucket->getSize());
+        return found ? bucket : nullptr;
+    }
+
+    // Elimina el par con la llave indicada y retorna su valor.
     // Si no la encuentra, lanza un error.
-    void checkExisting(K key) {
-        KVPair<K, V> p(key);
-        if (!buckets[h(key)].contains(p))
+    template <typename Q>
+    V removeKey(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
+        DLinkedList<KVPair<K, V>>* bucket = locateForRemoval(key, scope);
+        if (bucket == nullptr)
             throw runtime_error("Key not found.");
+        V result = bucket->remove().value;
+        size--;
+        return result;
     }
 
     /** 
      * @brief Función hash para convertir la clave en un índice de la tabla.
      * 
-     * @param key La clave a hashear.
+     * @param key La clave a hashear, de tipo K o transparente para K.
      * @return El índice correspondiente en la tabla.
      */
-    int h(K key) {
+    template <typename Q>
+    int h(const Q& key) {
         return compress(hashCodePolynomial(key));
     }
 
     /** 
      * @brief Comprime el código hash a un índice válido.
      * 
+     * La multiplicación se hace sin signo: con int, a * code se desbordaba para los
+     * códigos grandes y abs() podía devolver un índice negativo.
+     * 
      * @param code El código hash a comprimir.
      * @return El índice comprimido.
      */
     int compress(int code) {
-        int a = 1097;
-        int b = 1279;
-        return abs(a * code + b) % max;
+        unsigned int a = 1097;
+        unsigned int b = 1279;
+        return (int)((a * (unsigned int)code + b) % (unsigned int)max);
     }
 
     template <typename T>
@@ -142,39 +195,122 @@ private:
      * @param key La clave a hashear.
      * @return El código hash calculado.
      */
-    int hashCodePolynomial(T key) {
+    int hashCodePolynomial(const T& key) {
         int a = 33;
         int result = 0;
-        char* bytes = reinterpret_cast<char*>(&key);
+        const char* bytes = reinterpret_cast<const char*>(&key);
         for (unsigned int i = 0; i < sizeof(T); i++) {
             result += static_cast<int>(bytes[i] * pow(a, i));
         }
         return result;
     }
 
+    /** 
+     * @brief Calcula el código hash de una secuencia de caracteres.
+     * 
+     * Evalúa el polinomio con el método de Horner en aritmética sin signo, que se
+     * desborda de forma definida; con pow() los términos de las cadenas de más de seis
+     * caracteres no cabían en un int y todas esas cadenas producían el mismo código.
+     * 
+     * @param chars Primer carácter de la secuencia.
+     * @param length Cantidad de caracteres, incluidos los nulos intermedios.
+     * @return El código hash calculado, no negativo.
+     */
+    int hashCharacters(const char* chars, size_t length) {
+        unsigned int a = 33;
+        unsigned int result = 0;
+        for (size_t i = 0; i < length; i++) {
+            result = result * a + (unsigned char)chars[i];
+        }
+        return (int)(result & 0x7fffffffu);
+    }
+
     /** 
      * @brief Sobrecarga de la función hash para cadenas de texto.
      * 
+     * Recorre los size() caracteres, de modo que dos cadenas que sólo difieren después de
+     * un '\0' intermedio producen códigos distintos.
+     * 
      * @param key La cadena a hashear.
-     * @return El código hash calculado.
+     * @return El código hash calculado, no negativo.
      */
-    int hashCodePolynomial(string key) {
-        int a = 33;
-        int result = 0;
-        for (unsigned int i = 0; i < key.size(); i++) {
-            result += (int)key[i] * pow(a, i);
-        }
-        return result;
+    int hashCodePolynomial(const string& key) {
+        return hashCharacters(key.data(), key.size());
+    }
+
+    /** 
+     * @brief Sobrecarga de la función hash para cadenas de C.
+     * 
+     * Produce el mismo código que el string con el mismo contenido, de modo que un
+     * const char* puede buscarse sin construir un string.
+     * 
+     * @param key La cadena a hashear, terminada en nulo.
+     * @return El código hash calculado, no negativo.
+     */
+    int hashCodePolynomial(const char* key) {
+        return hashCharacters(key, strlen(key));
     }
 
 public:
+    /**
+     * @brief Iterador sobre las entradas de la tabla, cubeta por cubeta.
+     *
+     * Recorre los nodos de cada cubeta y salta las cubetas vacías.
+     */
+    class Iterator {
+    private:
+        typedef typename DLinkedList<KVPair<K, V>>::Iterator BucketIterator;
+
+        DLinkedList<KVPair<K, V>>* buckets; ///< Cubetas de la tabla.
+        int bucket;                         ///< Cubeta actual; max al terminar.
+        int max;                            ///< Cantidad de cubetas.
+        BucketIterator current;             ///< Posición dentro de la cubeta actual.
+
+        // Avanza hasta la siguiente cubeta con elementos si la actual ya se terminó.
+        void skipEmpty() {
+            while (bucket < max && current == buckets[bucket].end()) {
+                bucket++;
+                if (bucket < max)
+                    current = buckets[bucket].begin();
+            }
+        }
+
+    public:
+        Iterator(DLinkedList<KVPair<K, V>>* buckets, int bucket, int max)
+            : buckets(buckets), bucket(bucket), max(max),
+              current(bucket < max ? buckets[bucket].begin() : BucketIterator(nullptr)) {
+            skipEmpty();
+        }
+
+        DictionaryEntry<K, V> operator*() {
+            KVPair<K, V>& pair = *current;
+            return DictionaryEntry<K, V>{ pair.key, pair.value };
+        }
+
+        Iterator& operator++() {
+            ++current;
+            skipEmpty();
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return bucket == other.bucket && (bucket == max || current == other.current);
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other);
+        }
+    };
+
     /** 
      * @brief Constructor por defecto que inicializa la tabla de hash.
+     * 
+     * @param resource Recurso del que se obtienen las cubetas y sus nodos (ver MemoryResource.h).
      */
-    HashTable() {
+    explicit HashTable(MemoryResource* resource = defaultResource()) : resource(resource) {
         initPrimes();
         max = primes->getElement();
-        buckets = new DLinkedList<KVPair<K, V>>[max];
+        buckets = createArray<DLinkedList<KVPair<K, V>>>(resource, max, resource);
         size = 0;
         maxLoad = 0.6;
         minLoad = 0.2;
@@ -184,24 +320,44 @@ public:
      * @brief Destructor que libera la memoria utilizada por la tabla de hash.
      */
     ~HashTable() {
-        delete [] buckets;
-        delete primes;
+        destroyArray(resource, buckets, max);
+        destroy(resource, primes);
     }
 
     /** 
      * @brief Inserta un nuevo par clave-valor en la tabla de hash.
      * 
-     * @param key La clave del par.
-     * @param value El valor asociado a la clave.
+     * @param key La clave del par, que se mueve al diccionario.
+     * @param value El valor asociado a la clave, que se mueve al diccionario.
      * @throw runtime_error si la clave ya existe en la tabla.
      */
     void insert(K key, V value) {
+        if (!tryInsert(std::move(key), std::move(value)))
+            throw runtime_error("Duplicated key.");
+    }
+
+    /** 
+     * @brief Intenta insertar un nuevo par clave-valor, sin lanzar excepciones si la clave ya existe.
+     * 
+     * El bucket se calcula y se recorre una sola vez.
+     * 
+     * @param key La clave del par, que se mueve al diccionario si se inserta.
+     * @param value El valor asociado a la clave, que se mueve al diccionario si se inserta.
+     * @return true si se insertó, false si la clave ya existía.
+     */
+    bool tryInsert(K key, V value) {
+        typename Instruments::Scope scope(instrumentation, INSERT);
         if (loadFactor() > maxLoad)
             reHashUp();
-        checkNotExisting(key);
-        KVPair<K, V> p(key, value);
-        buckets[h(key)].append(p);
+        DLinkedList<KVPair<K, V>>& bucket = buckets[h(key)];
+        if (bucket.findKey(key) != nullptr) {
+            scope.addWork(bucket.getPos() + 1);
+            return false;
+        }
+        scope.addWork(bucket.getSize());
+        bucket.append(KVPair<K, V>(std::move(key), std::move(value)));
         size++;
+        return true;
     }
 
     /** 
@@ -211,13 +367,25 @@ public:
      * @return El valor asociado a la clave eliminada.
      * @throw runtime_error si la clave no existe en la tabla.
      */
-    V remove(K key) {
-        if (loadFactor() <= minLoad)
-            reHashDown();
-        checkExisting(key);
-        KVPair<K, V> p = buckets[h(key)].remove();
+    V remove(const K& key) {
+        return removeKey(key);
+    }
+
+    /** 
+     * @brief Intenta eliminar un elemento por su clave, sin lanzar excepciones si no existe.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @param value Se asigna el valor eliminado; no cambia si la clave no existe.
+     * @return true si se eliminó, false si la clave no existía.
+     */
+    bool tryRemove(const K& key, V& value) {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
+        DLinkedList<KVPair<K, V>>* bucket = locateForRemoval(key, scope);
+        if (bucket == nullptr)
+            return false;
+        value = bucket->remove().value;
         size--;
-        return p.value;
+        return true;
     }
 
     /** 
@@ -227,23 +395,61 @@ public:
      * @return El valor asociado a la clave.
      * @throw runtime_error si la clave no existe en la tabla.
      */
-    V getValue(K key) {
-        checkExisting(key);
-        KVPair<K, V> p = buckets[h(key)].getElement();
-        return p.value;
+    V getValue(const K& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor asociado a una clave, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en la tabla.
+     */
+    V& at(const K& key) {
+        typename Instruments::Scope scope(instrumentation, GET_VALUE);
+        KVPair<K, V>* pair = search(key, scope);
+        if (pair == nullptr)
+            throw runtime_error("Key not found.");
+        return pair->value;
+    }
+
+    /** 
+     * @brief Busca el valor asociado a una clave sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    const V* find(const K& key) {
+        typename Instruments::Scope scope(instrumentation, GET_VALUE);
+        KVPair<K, V>* pair = search(key, scope);
+        return pair == nullptr ? nullptr : &pair->value;
     }
 
     /** 
      * @brief Establece un nuevo valor para una clave existente.
      * 
      * @param key La clave del elemento a actualizar.
-     * @param value El nuevo valor a establecer.
+     * @param value El nuevo valor a establecer, que se copia.
+     * @throw runtime_error si la clave no existe en la tabla.
+     */
+    void setValue(const K& key, const V& value) {
+        setValue(key, V(value));
+    }
+
+    /** 
+     * @brief Establece un nuevo valor para una clave existente moviéndolo.
+     * 
+     * @param key La clave del elemento a actualizar.
+     * @param value El nuevo valor, que queda en un estado válido pero no especificado.
      * @throw runtime_error si la clave no existe en la tabla.
      */
-    void setValue(K key, V value) {
-        checkExisting(key);
-        KVPair<K, V> p(key, value);
-        buckets[h(key)].set(p);
+    void setValue(const K& key, V&& value) {
+        typename Instruments::Scope scope(instrumentation, SET_VALUE);
+        KVPair<K, V>* pair = search(key, scope);
+        if (pair == nullptr)
+            throw runtime_error("Key not found.");
+        pair->value = std::move(value);
     }
 
     /** 
@@ -252,9 +458,77 @@ public:
      * @param key La clave a buscar.
      * @return true si la clave existe en la tabla, false en caso contrario.
      */
-    bool contains(K key) {
-        KVPair<K, V> p(key);
-        return buckets[h(key)].contains(p);
+    bool contains(const K& key) {
+        typename Instruments::Scope scope(instrumentation, CONTAINS);
+        return search(key, scope) != nullptr;
+    }
+
+    /** 
+     * @brief Verifica si la tabla contiene una clave, buscándola con un tipo transparente para K.
+     * 
+     * Con claves string acepta, por ejemplo, un const char* sin construir un string (ver
+     * TransparentKey). Los demás tipos se convierten a K y usan contains(const K&).
+     * 
+     * @param key La clave a buscar.
+     * @return true si la clave existe en la tabla, false en caso contrario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, bool>::type contains(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, CONTAINS);
+        return search(key, scope) != nullptr;
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en la tabla.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V&>::type at(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, GET_VALUE);
+        KVPair<K, V>* pair = search(key, scope);
+        if (pair == nullptr)
+            throw runtime_error("Key not found.");
+        return pair->value;
+    }
+
+    /** 
+     * @brief Recupera el valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en la tabla.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type getValue(const Q& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Busca el valor de una clave con un tipo transparente para K, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, const V*>::type find(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, GET_VALUE);
+        KVPair<K, V>* pair = search(key, scope);
+        return pair == nullptr ? nullptr : &pair->value;
+    }
+
+    /** 
+     * @brief Elimina el par de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @return El valor asociado a la clave eliminada.
+     * @throw runtime_error si la clave no existe en la tabla.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type remove(const Q& key) {
+        return removeKey(key);
     }
 
     /** 
@@ -268,39 +542,83 @@ public:
     }
 
     /** 
-     * @brief Recupera una lista de todas las claves en la tabla de hash.
+     * @brief Aplica una función a cada par, cubeta por cubeta, sin copiarlos.
+     * 
+     * El orden depende de la función hash y de la capacidad actual de la tabla.
+     * 
+     * @param visit Función que recibe (const K& clave, V& valor).
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (int i = 0; i < max; i++)
+            buckets[i].forEach([&visit](KVPair<K, V>& pair) { visit(pair.key, pair.value); });
+    }
+
+    /** 
+     * @brief Recorre todos los pares con un visitante.
+     * 
+     * @param visitor Visitante que recibe cada par.
+     */
+    void accept(typename Dictionary<K, V>::Visitor& visitor) {
+        forEach([&visitor](const K& key, V& value) { visitor.visit(key, value); });
+    }
+
+    /** 
+     * @brief Obtiene un iterador a la primera entrada.
+     * 
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(buckets, 0, max);
+    }
+
+    /** 
+     * @brief Obtiene el iterador de fin del recorrido.
+     * 
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator(buckets, max, max);
+    }
+
+    /** 
+     * @brief Obtiene las claves, sin copiarlas, para recorrerlas con un for de rango.
+     * 
+     * @return Rango sobre las claves.
+     */
+    Range<KeyIterator<Iterator, K>> keys() {
+        return Range<KeyIterator<Iterator, K>>(KeyIterator<Iterator, K>(begin()), KeyIterator<Iterator, K>(end()));
+    }
+
+    /** 
+     * @brief Obtiene los valores, sin copiarlos, para recorrerlos con un for de rango.
+     * 
+     * @return Rango sobre los valores.
+     */
+    Range<ValueIterator<Iterator, V>> values() {
+        return Range<ValueIterator<Iterator, V>>(ValueIterator<Iterator, V>(begin()), ValueIterator<Iterator, V>(end()));
+    }
+
+    /** 
+     * @brief Recupera una lista de todas las claves en el diccionario.
      * 
      * @return Un puntero a una lista que contiene todas las claves.
      */
     List<K>* getKeys() {
-        List<K> *keys = new DLinkedList<K>();
-        for (int i = 0; i < max; i++) {
-            buckets[i].goToStart();
-            while (!buckets[i].atEnd()) {
-                KVPair<K, V> p = buckets[i].getElement();
-                keys->append(p.key);
-                buckets[i].next();
-            }
-        }
-        return keys;
+        List<K>* result = new DLinkedList<K>();
+        forEach([result](const K& key, V&) { result->append(key); });
+        return result;
     }
 
     /** 
-     * @brief Recupera una lista de todos los valores en la tabla de hash.
+     * @brief Recupera una lista de todos los valores en el diccionario.
      * 
      * @return Un puntero a una lista que contiene todos los valores.
      */
     List<V>* getValues() {
-        List<V> *values = new DLinkedList<V>();
-        for (int i = 0; i < max; i++) {
-            buckets[i].goToStart();
-            while (!buckets[i].atEnd()) {
-                KVPair<K, V> p = buckets[i].getElement();
-                values->append(p.value);
-                buckets[i].next();
-            }
-        }
-        return values;
+        List<V>* result = new DLinkedList<V>();
+        forEach([result](const K&, V& value) { result->append(value); });
+        return result;
     }
 
     /** 
@@ -312,6 +630,75 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen las cubetas y los nodos de la tabla.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Obtiene las mediciones de la tabla.
+     *
+     * Si no se compiló con STRUCTURES_INSTRUMENTATION, la instantánea está vacía.
+     * El trabajo de cada operación es la cantidad de pares comparados en la cubeta.
+     *
+     * @return Instantánea de las mediciones.
+     */
+    Stats stats() const {
+        static const char* const operations[] = { "insert", "remove", "getValue", "setValue", "contains" };
+        static const char* const counters[] = { "rehashes" };
+        return instrumentation.snapshot(operations, counters);
+    }
+
+    /** 
+     * @brief Guarda los pares en orden de clave en un archivo binario de instantánea.
+     * 
+     * El formato se describe en Snapshot.h y permite consultar el archivo en su lugar con
+     * MappedDictionary. Sólo está disponible si K y V son trivialmente copiables o string.
+     * Como las cubetas no guardan orden, se ordenan referencias a los pares antes de
+     * escribirlos; K debe soportar el operador <.
+     * 
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        saveDictionarySnapshot<K, V>(*this, path, false);
+    }
+
+    /** 
+     * @brief Reemplaza el contenido del diccionario por el de un archivo guardado con save().
+     * 
+     * Elige de una vez la capacidad para la cantidad de pares y agrega cada par al final
+     * de su cubeta sin buscar duplicados, porque las claves del archivo son únicas.
+     * 
+     * @param path Ruta del archivo.
+     * @throw runtime_error si no se puede abrir el archivo o no es un diccionario válido de K a V.
+     */
+    void load(const string& path) {
+        DictionarySnapshot<K, V> snapshot(path, true);
+        int count = snapshot.getCount();
+        clear();
+        int newMax = max;
+        while ((double)count / (double)newMax > maxLoad && primes->getPos() < primes->getSize() - 1) {
+            primes->next();
+            newMax = primes->getElement();
+        }
+        if (newMax != max) {
+            destroyArray(resource, buckets, max);
+            max = newMax;
+            buckets = createArray<DLinkedList<KVPair<K, V>>>(resource, max, resource);
+        }
+        for (int i = 0; i < count; i++) {
+            K key = snapshot.keys[i];
+            int index = h(key);
+            buckets[index].append(KVPair<K, V>(std::move(key), snapshot.values[i]));
+        }
+        size = count;
+    }
+
     /** 
      * @brief Imprime el contenido de la tabla de hash.
      */
@@ -0,0 +1,142 @@
+/**
+ * @file MappedDictionary.h
+ * @brief Diccionario de sólo lectura que consulta en su lugar una instantánea proyectada en memoria.
+ *
+ * Abrir el diccionario sólo proyecta el archivo y valida su estructura, sin leer ni
+ * copiar los pares, por lo que el costo de arranque no depende de su tamaño: las páginas
+ * se cargan del disco (o de la caché del sistema) a medida que las búsquedas las tocan.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <stdexcept>
+#include <string>
+#include "Structures/Common/Snapshot.h"
+
+using std::runtime_error;
+using std::string;
+
+/**
+ * @brief Diccionario de sólo lectura sobre un archivo guardado con save() por cualquier diccionario.
+ *
+ * Las claves del archivo están ordenadas, así que las búsquedas son binarias sobre la
+ * columna de claves proyectada. Las claves y valores de tamaño fijo se entregan por
+ * referencia a la proyección; las cadenas se comparan sobre la proyección sin reservar
+ * memoria y sólo se construye un string al retornarlas.
+ *
+ * No implementa la interfaz Dictionary porque esta modifica el diccionario en sitio.
+ *
+ * @tparam K Tipo de las claves; trivialmente copiable o string.
+ * @tparam V Tipo de los valores; trivialmente copiable o string.
+ */
+template <typename K, typename V>
+class MappedDictionary {
+private:
+    DictionarySnapshot<K, V> snapshot; ///< Archivo proyectado y sus columnas.
+    int size;                          ///< Número de pares.
+
+    /**
+     * @brief Busca la posición de una clave.
+     *
+     * @param key La clave a buscar.
+     * @return La posición de la clave, o -1 si no existe.
+     */
+    int position(const K& key) const {
+        int pos = snapshotLowerBound(snapshot.keys, size, key);
+        if (pos < size && !snapshot.keys.greater(pos, key))
+            return pos;
+        return -1;
+    }
+
+public:
+    typedef typename SnapshotCodec<K>::Column::Reference KeyReference;   ///< Tipo con que se entregan las claves.
+    typedef typename SnapshotCodec<V>::Column::Reference ValueReference; ///< Tipo con que se entregan los valores.
+
+    MappedDictionary(const MappedDictionary<K, V>& other) = delete;
+    void operator=(const MappedDictionary<K, V>& other) = delete;
+
+    /**
+     * @brief Abre una instantánea de diccionario.
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error Si no se puede abrir el archivo o no es un diccionario de K a V.
+     */
+    explicit MappedDictionary(const string& path) : snapshot(path, false) {
+        size = snapshot.getCount();
+    }
+
+    /**
+     * @brief Verifica si el diccionario contiene una clave.
+     *
+     * @param key La clave a verificar.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    bool contains(const K& key) const {
+        return position(key) != -1;
+    }
+
+    /**
+     * @brief Recupera el valor asociado a una clave.
+     *
+     * @param key La clave cuyo valor se desea obtener.
+     * @return El valor, por referencia a la proyección si es de tamaño fijo.
+     * @throw runtime_error Si la clave no existe.
+     */
+    ValueReference getValue(const K& key) const {
+        int pos = position(key);
+        if (pos == -1)
+            throw runtime_error("Key not found.");
+        return snapshot.values[pos];
+    }
+
+    /**
+     * @brief Intenta recuperar el valor asociado a una clave, sin lanzar excepciones si no existe.
+     *
+     * @param key La clave a buscar.
+     * @param value Se asigna una copia del valor; no cambia si la clave no existe.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    bool tryGet(const K& key, V& value) const {
+        int pos = position(key);
+        if (pos == -1)
+            return false;
+        value = snapshot.values[pos];
+        return true;
+    }
+
+    /**
+     * @brief Busca el valor asociado a una clave sin copiarlo y sin lanzar excepciones.
+     *
+     * Sólo está disponible si V es de tamaño fijo. El puntero es válido mientras el
+     * diccionario exista.
+     *
+     * @param key La clave a buscar.
+     * @return Puntero al valor dentro de la proyección, o nullptr si la clave no existe.
+     */
+    const V* find(const K& key) const {
+        int pos = position(key);
+        return pos == -1 ? nullptr : snapshot.values.address(pos);
+    }
+
+    /**
+     * @brief Aplica una función a cada par en orden de clave.
+     *
+     * @param visit Función que recibe (KeyReference clave, ValueReference valor).
+     */
+    template <typename F>
+    void forEach(F visit) const {
+        for (int i = 0; i < size; i++)
+            visit(snapshot.keys[i], snapshot.values[i]);
+    }
+
+    /**
+     * @brief Obtiene el número de pares.
+     *
+     * @return El tamaño del diccionario.
+     */
+    int getSize() const {
+        return size;
+    }
+};
@@ -0,0 +1,365 @@
+/**
+ * @file PersistentAVLDictionary.h
+ * @brief Clase que implementa un diccionario persistente (inmutable) sobre un árbol AVL.
+ *
+ * Cada modificación retorna una nueva versión del diccionario que comparte con la
+ * anterior todos los nodos que no cambiaron, por lo que copiar una versión es O(1).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include "Structures/Common/Compare.h"
+#include "Structures/Common/KVPair.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Nodes/PersistentAVLNode.h"
+#include "Structures/Implementations/Lists/DLinkedList.h"
+
+using std::runtime_error;
+
+/**
+ * @brief Diccionario persistente implementado con un árbol AVL con copia de caminos.
+ *
+ * insert(), setValue() y remove() no modifican el diccionario: crean una copia de los
+ * O(log n) nodos entre la raíz y la posición modificada (incluidas las rotaciones) y
+ * retornan una nueva versión que comparte el resto del árbol. Copiar un diccionario es
+ * O(1), lo que permite tomar instantáneas baratas para lectores concurrentes: los nodos
+ * nunca cambian después de construirse, así que una versión puede leerse desde varios
+ * hilos sin sincronización. Publicar una nueva versión para otros hilos sí requiere
+ * sincronización (por ejemplo, un mutex alrededor de la asignación).
+ *
+ * Los nodos se obtienen del recurso de memoria del diccionario (ver MemoryResource.h),
+ * que heredan todas las versiones derivadas de él y que debe vivir más que la última.
+ *
+ * No implementa la interfaz Dictionary porque esta modifica el diccionario en sitio.
+ *
+ * @tparam K Tipo de las claves.
+ * @tparam V Tipo de los valores.
+ */
+template <typename K, typename V>
+class PersistentAVLDictionary {
+private:
+    typedef PersistentAVLNode<KVPair<K, V>> Node;
+    typedef typename Node::Ptr NodePtr;
+
+    NodePtr root; ///< Raíz del árbol de esta versión.
+    int size;     ///< Número de pares en esta versión.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
+
+    /**
+     * @brief Constructor interno a partir de una raíz y su tamaño.
+     */
+    PersistentAVLDictionary(const NodePtr& root, int size, MemoryResource* resource)
+        : root(root), size(size), resource(resource) {}
+
+    /**
+     * @brief Crea un nodo nuevo con memoria del recurso del diccionario.
+     */
+    NodePtr make(const KVPair<K, V>& pair, const NodePtr& left, const NodePtr& right) const {
+        return std::allocate_shared<Node>(ResourceAllocator<Node>(resource), pair, left, right);
+    }
+
+    /**
+     * @brief Crea un nodo con los hijos indicados, rotando si quedaría desbalanceado.
+     *
+     * Los hijos ya están balanceados y sus alturas difieren a lo sumo en dos.
+     *
+     * @param pair Elemento del nodo.
+     * @param left Hijo izquierdo.
+     * @param right Hijo derecho.
+     * @return La raíz del subárbol balanceado.
+     */
+    NodePtr balance(const KVPair<K, V>& pair, const NodePtr& left, const NodePtr& right) const {
+        int leftHeight = Node::heightOf(left);
+        int rightHeight = Node::heightOf(right);
+        if (leftHeight > rightHeight + 1) {
+            if (Node::heightOf(left->left) >= Node::heightOf(left->right))
+                return make(left->element, left->left, make(pair, left->right, right));
+            const Node* middle = left->right.get();
+            return make(middle->element,
+                        make(left->element, left->left, middle->left),
+                        make(pair, middle->right, right));
+        }
+        if (rightHeight > leftHeight + 1) {
+            if (Node::heightOf(right->right) >= Node::heightOf(right->left))
+                return make(right->element, make(pair, left, right->left), right->right);
+            const Node* middle = right->left.get();
+            return make(middle->element,
+                        make(pair, left, middle->left),
+                        make(right->element, middle->right, right->right));
+        }
+        return make(pair, left, right);
+    }
+
+    /**
+     * @brief Inserta o reemplaza un par copiando el camino desde la raíz.
+     *
+     * @param node Raíz del subárbol actual.
+     * @param pair Par a insertar.
+     * @param replace Indica si se permite reemplazar el valor de una clave existente.
+     * @param added Se asigna true si la clave no existía.
+     * @return La raíz del nuevo subárbol.
+     * @throw runtime_error si la clave ya existe y no se permite reemplazar.
+     */
+    NodePtr insertAux(const NodePtr& node, const KVPair<K, V>& pair, bool replace, bool& added) const {
+        if (node == nullptr) {
+            added = true;
+            return make(pair, nullptr, nullptr);
+        }
+        int order = threeWayCompare(pair.key, node->element.key);
+        if (order < 0)
+            return balance(node->element, insertAux(node->left, pair, replace, added), node->right);
+        if (order > 0)
+            return balance(node->element, node->left, insertAux(node->right, pair, replace, added));
+        if (!replace)
+            throw runtime_error("Duplicated key.");
+        return make(pair, node->left, node->right);
+    }
+
+    /**
+     * @brief Quita el menor par de un subárbol copiando el camino hasta él.
+     *
+     * @param node Raíz del subárbol, que no puede estar vacío.
+     * @param min Se asigna el par quitado.
+     * @return La raíz del nuevo subárbol.
+     */
+    NodePtr removeMin(const NodePtr& node, KVPair<K, V>& min) const {
+        if (node->left == nullptr) {
+            min = node->element;
+            return node->right;
+        }
+        return balance(node->element, removeMin(node->left, min), node->right);
+    }
+
+    /**
+     * @brief Elimina una clave copiando el camino desde la raíz.
+     *
+     * @param node Raíz del subárbol actual.
+     * @param key Clave a eliminar.
+     * @param removed Se asigna el par eliminado.
+     * @return La raíz del nuevo subárbol.
+     * @throw runtime_error si la clave no existe.
+     */
+    NodePtr removeAux(const NodePtr& node, const K& key, KVPair<K, V>& removed) const {
+        if (node == nullptr)
+            throw runtime_error("Key not found.");
+        int order = threeWayCompare(key, node->element.key);
+        if (order < 0)
+            return balance(node->element, removeAux(node->left, key, removed), node->right);
+        if (order > 0)
+            return balance(node->element, node->left, removeAux(node->right, key, removed));
+        removed = node->element;
+        if (node->left == nullptr)
+            return node->right;
+        if (node->right == nullptr)
+            return node->left;
+        KVPair<K, V> successor;
+        NodePtr right = removeMin(node->right, successor);
+        return balance(successor, node->left, right);
+    }
+
+    /**
+     * @brief Busca el nodo de una clave.
+     *
+     * @param key Clave a buscar.
+     * @return Puntero al nodo, o nullptr si la clave no existe.
+     */
+    const Node* find(const K& key) const {
+        const Node* node = root.get();
+        while (node != nullptr) {
+            int order = threeWayCompare(key, node->element.key);
+            if (order < 0)
+                node = node->left.get();
+            else if (order > 0)
+                node = node->right.get();
+            else
+                return node;
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief Recorre el árbol en orden agregando las claves o los valores a una lista.
+     */
+    static void collect(const Node* node, List<K>* keys, List<V>* values) {
+        if (node == nullptr)
+            return;
+        collect(node->left.get(), keys, values);
+        if (keys != nullptr)
+            keys->append(node->element.key);
+        if (values != nullptr)
+            values->append(node->element.value);
+        collect(node->right.get(), keys, values);
+    }
+
+    /**
+     * @brief Recorre el árbol en orden agregando los pares a una lista.
+     */
+    static void collectPairs(const Node* node, List<KVPair<K, V>>* pairs) {
+        if (node == nullptr)
+            return;
+        collectPairs(node->left.get(), pairs);
+        pairs->append(node->element);
+        collectPairs(node->right.get(), pairs);
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto que crea un diccionario vacío.
+     *
+     * @param resource Recurso del que se obtienen los nodos de esta versión y de las derivadas.
+     */
+    explicit PersistentAVLDictionary(MemoryResource* resource = defaultResource())
+        : root(nullptr), size(0), resource(resource) {}
+
+    /**
+     * @brief Retorna una nueva versión con un par clave-valor agregado.
+     *
+     * @param key La clave del par.
+     * @param value El valor asociado a la clave.
+     * @return La nueva versión del diccionario.
+     * @throw runtime_error si la clave ya existe en el diccionario.
+     */
+    PersistentAVLDictionary<K, V> insert(const K& key, const V& value) const {
+        bool added = false;
+        NodePtr newRoot = insertAux(root, KVPair<K, V>(key, value), false, added);
+        return PersistentAVLDictionary<K, V>(newRoot, size + 1, resource);
+    }
+
+    /**
+     * @brief Retorna una nueva versión con el valor de una clave reemplazado.
+     *
+     * Si la clave no existe, se agrega.
+     *
+     * @param key La clave del par.
+     * @param value El nuevo valor.
+     * @return La nueva versión del diccionario.
+     */
+    PersistentAVLDictionary<K, V> setValue(const K& key, const V& value) const {
+        bool added = false;
+        NodePtr newRoot = insertAux(root, KVPair<K, V>(key, value), true, added);
+        return PersistentAVLDictionary<K, V>(newRoot, added ? size + 1 : size, resource);
+    }
+
+    /**
+     * @brief Retorna una nueva versión sin la clave indicada.
+     *
+     * @param key La clave a eliminar.
+     * @return La nueva versión del diccionario.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    PersistentAVLDictionary<K, V> remove(const K& key) const {
+        KVPair<K, V> removed;
+        NodePtr newRoot = removeAux(root, key, removed);
+        return PersistentAVLDictionary<K, V>(newRoot, size - 1, resource);
+    }
+
+    /**
+     * @brief Recupera el valor asociado a una clave.
+     *
+     * @param key La clave a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    V getValue(const K& key) const {
+        const Node* node = find(key);
+        if (node == nullptr)
+            throw runtime_error("Key not found.");
+        return node->element.value;
+    }
+
+    /**
+     * @brief Intenta recuperar el valor asociado a una clave, sin lanzar excepciones si no existe.
+     *
+     * @param key La clave a buscar.
+     * @param value Se asigna una copia del valor; no cambia si la clave no existe.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    bool tryGet(const K& key, V& value) const {
+        const Node* node = find(key);
+        if (node == nullptr)
+            return false;
+        value = node->element.value;
+        return true;
+    }
+
+    /**
+     * @brief Verifica si el diccionario contiene una clave.
+     *
+     * @param key La clave a buscar.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * @brief Recupera una lista ordenada de todas las claves.
+     *
+     * @return Un puntero a una lista nueva que contiene las claves.
+     */
+    List<K>* getKeys() const {
+        List<K>* keys = new DLinkedList<K>();
+        collect(root.get(), keys, nullptr);
+        return keys;
+    }
+
+    /**
+     * @brief Recupera una lista de todos los valores, en el orden de sus claves.
+     *
+     * @return Un puntero a una lista nueva que contiene los valores.
+     */
+    List<V>* getValues() const {
+        List<V>* values = new DLinkedList<V>();
+        collect(root.get(), nullptr, values);
+        return values;
+    }
+
+    /**
+     * @brief Obtiene el número de pares en el diccionario.
+     *
+     * @return El tamaño del diccionario.
+     */
+    int getSize() const {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos del diccionario.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si el diccionario está vacío.
+     *
+     * @return true si no tiene pares, false en caso contrario.
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * @brief Obtiene la altura del árbol de esta versión.
+     *
+     * @return La altura del árbol, 0 si está vacío.
+     */
+    int getHeight() const {
+        return Node::heightOf(root);
+    }
+
+    /**
+     * @brief Imprime el contenido del diccionario.
+     */
+    void print() const {
+        DLinkedList<KVPair<K, V>> pairs;
+        collectPairs(root.get(), &pairs);
+        pairs.print();
+    }
+};
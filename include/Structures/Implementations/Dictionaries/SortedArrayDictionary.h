@@ -0,0 +1,596 @@
+/**
+ * @file SortedArrayDictionary.h
+ * @brief Clase que implementa un diccionario ordenado utilizando arreglos contiguos.
+ *
+ * Las claves y los valores se guardan en dos arreglos separados y ordenados por clave,
+ * lo que permite búsquedas binarias sin saltos condicionales.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "Structures/Abstract/Dictionary.h"
+#include "Structures/Common/DictionaryEntry.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Snapshot.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Lists/DLinkedList.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Diccionario que mantiene sus pares ordenados en arreglos contiguos (flat map).
+ *
+ * Las claves se almacenan en un arreglo y los valores en otro paralelo, de modo que la
+ * búsqueda sólo recorre la memoria de las claves. Para tamaños pequeños se usa un conteo
+ * lineal que el compilador puede vectorizar; para tamaños mayores, una búsqueda binaria
+ * sin saltos. Las búsquedas son O(log n) y las inserciones y eliminaciones O(n) por el
+ * desplazamiento, por lo que está pensado para diccionarios pequeños y de mayormente lectura.
+ *
+ * @tparam K Tipo de las claves del diccionario. Debe soportar el operador <.
+ * @tparam V Tipo de los valores del diccionario.
+ */
+template <typename K, typename V>
+class SortedArrayDictionary : public Dictionary<K, V> {
+private:
+    K* keyArray;   ///< Arreglo ordenado de claves.
+    V* valueArray; ///< Arreglo de valores, paralelo al de claves.
+    int max;       ///< Capacidad actual de los arreglos.
+    int size;      ///< Número de pares almacenados.
+    MemoryResource* resource; ///< Recurso del que se obtienen los arreglos.
+
+    static const int LINEAR_LIMIT = 16; ///< Tamaño hasta el cual se usa búsqueda lineal.
+
+    /**
+     * @brief Duplica la capacidad de los arreglos.
+     */
+    void expand() {
+        K* newKeys = createArray<K>(resource, max * 2);
+        V* newValues = createArray<V>(resource, max * 2);
+        for (int i = 0; i < size; i++) {
+            newKeys[i] = std::move(keyArray[i]);
+            newValues[i] = std::move(valueArray[i]);
+        }
+        destroyArray(resource, keyArray, max);
+        destroyArray(resource, valueArray, max);
+        keyArray = newKeys;
+        valueArray = newValues;
+        max *= 2;
+    }
+
+    /**
+     * @brief Deja una posición fuera del diccionario con el valor por defecto y libera lo que tenía.
+     *
+     * Se intercambia con un temporal que se destruye de inmediato: asignar T() no basta,
+     * porque std::string conserva su búfer al recibir una cadena corta.
+     *
+     * @param slot Clave o valor a liberar.
+     */
+    template <typename T>
+    static void release(T& slot) {
+        T empty = T();
+        std::swap(slot, empty);
+    }
+
+    /**
+     * @brief Obtiene la posición de la primera clave que no es menor que la indicada.
+     *
+     * @param key Clave de referencia.
+     * @return Posición encontrada, o el tamaño si todas las claves son menores.
+     */
+    template <typename Q>
+    int lowerBound(const Q& key) {
+        if (size <= LINEAR_LIMIT) {
+            int count = 0;
+            for (int i = 0; i < size; i++)
+                count += keyArray[i] < key;
+            return count;
+        }
+        const K* base = keyArray;
+        int length = size;
+        while (length > 1) {
+            int half = length / 2;
+            base = (base[half - 1] < key) ? base + half : base;
+            length -= half;
+        }
+        return (int)(base - keyArray) + (*base < key);
+    }
+
+    /**
+     * @brief Busca la posición de una clave.
+     *
+     * @param key La clave a buscar, de tipo K o transparente para K.
+     * @return La posición de la clave, o -1 si no existe.
+     */
+    template <typename Q>
+    int position(const Q& key) {
+        int pos = lowerBound(key);
+        if (pos < size && !(key < keyArray[pos]))
+            return pos;
+        return -1;
+    }
+
+    /**
+     * @brief Busca la posición de una clave que debe existir.
+     *
+     * @param key La clave a buscar.
+     * @return La posición de la clave.
+     * @throw runtime_error si la clave no se encuentra en el diccionario.
+     */
+    template <typename Q>
+    int checkExisting(const Q& key) {
+        int pos = position(key);
+        if (pos == -1)
+            throw runtime_error("Key not found.");
+        return pos;
+    }
+
+    /**
+     * @brief Elimina el par de una posición desplazando los siguientes.
+     *
+     * @param pos Posición del par.
+     * @return El valor eliminado.
+     */
+    V removeAt(int pos) {
+        V result = std::move(valueArray[pos]);
+        for (int i = pos + 1; i < size; i++) {
+            keyArray[i - 1] = std::move(keyArray[i]);
+            valueArray[i - 1] = std::move(valueArray[i]);
+        }
+        size--;
+        release(keyArray[size]);
+        release(valueArray[size]);
+        return result;
+    }
+
+public:
+    /**
+     * @brief Iterador sobre las entradas, en orden de clave.
+     *
+     * Avanza en paralelo por los arreglos de claves y de valores.
+     */
+    class Iterator {
+    private:
+        const K* key; ///< Clave actual.
+        V* value;     ///< Valor actual.
+
+    public:
+        Iterator(const K* key, V* value) : key(key), value(value) {}
+
+        DictionaryEntry<K, V> operator*() {
+            return DictionaryEntry<K, V>{ *key, *value };
+        }
+
+        Iterator& operator++() {
+            ++key;
+            ++value;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return key == other.key;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return key != other.key;
+        }
+    };
+
+    /**
+     * @brief Constructor de copia (eliminado).
+     */
+    SortedArrayDictionary(const SortedArrayDictionary<K, V>& other) = delete;
+
+    /**
+     * @brief Operador de asignación (eliminado).
+     */
+    void operator=(const SortedArrayDictionary<K, V>& other) = delete;
+
+    /**
+     * @brief Constructor que inicializa el diccionario con una capacidad inicial.
+     *
+     * @param max Capacidad inicial de los arreglos (por defecto es DEFAULT_MAX).
+     * @param resource Recurso del que se obtienen los arreglos (ver MemoryResource.h).
+     * @throw runtime_error si la capacidad es menor que 1.
+     */
+    SortedArrayDictionary(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource()) : resource(resource) {
+        if (max < 1)
+            throw runtime_error("Invalid max size.");
+        keyArray = createArray<K>(resource, max);
+        valueArray = createArray<V>(resource, max);
+        this->max = max;
+        size = 0;
+    }
+
+    /**
+     * @brief Constructor que inicializa el diccionario con la capacidad por defecto y el recurso indicado.
+     *
+     * @param resource Recurso del que se obtienen los arreglos.
+     */
+    explicit SortedArrayDictionary(MemoryResource* resource) : SortedArrayDictionary(DEFAULT_MAX, resource) {}
+
+    /**
+     * @brief Destructor que libera los arreglos de claves y valores.
+     */
+    ~SortedArrayDictionary() {
+        destroyArray(resource, keyArray, max);
+        destroyArray(resource, valueArray, max);
+    }
+
+    /**
+     * @brief Inserta un nuevo par clave-valor en su posición ordenada.
+     *
+     * @param key La clave del par, que se mueve al diccionario.
+     * @param value El valor asociado a la clave, que se mueve al diccionario.
+     * @throw runtime_error si la clave ya existe en el diccionario.
+     */
+    void insert(K key, V value) {
+        if (!tryInsert(std::move(key), std::move(value)))
+            throw runtime_error("Duplicated key.");
+    }
+
+    /**
+     * @brief Intenta insertar un nuevo par clave-valor, sin lanzar excepciones si la clave ya existe.
+     *
+     * @param key La clave del par, que se mueve al diccionario si se inserta.
+     * @param value El valor asociado a la clave, que se mueve al diccionario si se inserta.
+     * @return true si se insertó, false si la clave ya existía.
+     */
+    bool tryInsert(K key, V value) {
+        int pos = lowerBound(key);
+        if (pos < size && !(key < keyArray[pos]))
+            return false;
+        if (size == max)
+            expand();
+        for (int i = size; i > pos; i--) {
+            keyArray[i] = std::move(keyArray[i - 1]);
+            valueArray[i] = std::move(valueArray[i - 1]);
+        }
+        keyArray[pos] = std::move(key);
+        valueArray[pos] = std::move(value);
+        size++;
+        return true;
+    }
+
+    /**
+     * @brief Elimina un elemento del diccionario por su clave.
+     *
+     * @param key La clave del elemento a eliminar.
+     * @return El valor asociado a la clave eliminada.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    V remove(const K& key) {
+        return removeAt(checkExisting(key));
+    }
+
+    /**
+     * @brief Intenta eliminar un elemento por su clave, sin lanzar excepciones si no existe.
+     *
+     * @param key La clave del elemento a eliminar.
+     * @param value Se asigna el valor eliminado; no cambia si la clave no existe.
+     * @return true si se eliminó, false si la clave no existía.
+     */
+    bool tryRemove(const K& key, V& value) {
+        int pos = position(key);
+        if (pos == -1)
+            return false;
+        value = removeAt(pos);
+        return true;
+    }
+
+    /**
+     * @brief Recupera el valor asociado a una clave.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    V getValue(const K& key) {
+        return valueArray[checkExisting(key)];
+    }
+
+    /**
+     * @brief Obtiene una referencia al valor asociado a una clave, sin copiarlo.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    V& at(const K& key) {
+        return valueArray[checkExisting(key)];
+    }
+
+    /**
+     * @brief Busca el valor asociado a una clave sin copiarlo.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    const V* find(const K& key) {
+        int pos = position(key);
+        return pos == -1 ? nullptr : &valueArray[pos];
+    }
+
+    /**
+     * @brief Establece un nuevo valor para una clave existente.
+     *
+     * @param key La clave del elemento a actualizar.
+     * @param value El nuevo valor a establecer, que se copia.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    void setValue(const K& key, const V& value) {
+        setValue(key, V(value));
+    }
+
+    /**
+     * @brief Establece un nuevo valor para una clave existente moviéndolo.
+     *
+     * @param key La clave del elemento a actualizar.
+     * @param value El nuevo valor, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    void setValue(const K& key, V&& value) {
+        valueArray[checkExisting(key)] = std::move(value);
+    }
+
+    /**
+     * @brief Verifica si el diccionario contiene una clave específica.
+     *
+     * @param key La clave a buscar.
+     * @return true si la clave existe en el diccionario, false en caso contrario.
+     */
+    bool contains(const K& key) {
+        return position(key) != -1;
+    }
+
+    /**
+     * @brief Verifica si el diccionario contiene una clave, buscándola con un tipo transparente para K.
+     *
+     * Con claves string acepta, por ejemplo, un const char* sin construir un string (ver
+     * TransparentKey). Los demás tipos se convierten a K y usan contains(const K&).
+     *
+     * @param key La clave a buscar.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, bool>::type contains(const Q& key) {
+        return position(key) != -1;
+    }
+
+    /**
+     * @brief Obtiene una referencia al valor de una clave buscada con un tipo transparente para K.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V&>::type at(const Q& key) {
+        return valueArray[checkExisting(key)];
+    }
+
+    /**
+     * @brief Recupera el valor de una clave buscada con un tipo transparente para K.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type getValue(const Q& key) {
+        return at(key);
+    }
+
+    /**
+     * @brief Busca el valor de una clave con un tipo transparente para K, sin copiarlo.
+     *
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, const V*>::type find(const Q& key) {
+        int pos = position(key);
+        return pos == -1 ? nullptr : &valueArray[pos];
+    }
+
+    /**
+     * @brief Elimina el par de una clave buscada con un tipo transparente para K.
+     *
+     * @param key La clave del elemento a eliminar.
+     * @return El valor asociado a la clave eliminada.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type remove(const Q& key) {
+        return removeAt(checkExisting(key));
+    }
+
+    /**
+     * @brief Elimina todos los pares del diccionario.
+     *
+     * Las posiciones ocupadas se reemplazan por claves y valores vacíos, para que los
+     * recursos de los pares (por ejemplo, el texto de un string) se liberen de inmediato.
+     * Con tipos trivialmente destructibles no hay nada que liberar y sólo cambia el tamaño.
+     */
+    void clear() {
+        if (!std::is_trivially_destructible<K>::value || !std::is_trivially_destructible<V>::value) {
+            for (int i = 0; i < size; i++) {
+                release(keyArray[i]);
+                release(valueArray[i]);
+            }
+        }
+        size = 0;
+    }
+
+    /**
+     * @brief Aplica una función a cada par en orden de clave, sin copiarlos.
+     *
+     * @param visit Función que recibe (const K& clave, V& valor).
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (int i = 0; i < size; i++)
+            visit(keyArray[i], valueArray[i]);
+    }
+
+    /**
+     * @brief Recorre todos los pares en orden de clave con un visitante.
+     *
+     * @param visitor Visitante que recibe cada par.
+     */
+    void accept(typename Dictionary<K, V>::Visitor& visitor) {
+        forEach([&visitor](const K& key, V& value) { visitor.visit(key, value); });
+    }
+
+    /**
+     * @brief Obtiene un iterador a la primera entrada.
+     *
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(keyArray, valueArray);
+    }
+
+    /**
+     * @brief Obtiene el iterador de fin del recorrido.
+     *
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator(keyArray + size, valueArray + size);
+    }
+
+    /**
+     * @brief Obtiene las claves, sin copiarlas, para recorrerlas con un for de rango.
+     *
+     * @return Rango sobre las claves.
+     */
+    Range<KeyIterator<Iterator, K>> keys() {
+        return Range<KeyIterator<Iterator, K>>(KeyIterator<Iterator, K>(begin()), KeyIterator<Iterator, K>(end()));
+    }
+
+    /**
+     * @brief Obtiene los valores, sin copiarlos, para recorrerlos con un for de rango.
+     *
+     * @return Rango sobre los valores.
+     */
+    Range<ValueIterator<Iterator, V>> values() {
+        return Range<ValueIterator<Iterator, V>>(ValueIterator<Iterator, V>(begin()), ValueIterator<Iterator, V>(end()));
+    }
+
+    /**
+     * @brief Recupera una lista de todas las claves en el diccionario.
+     *
+     * @return Un puntero a una lista que contiene todas las claves.
+     */
+    List<K>* getKeys() {
+        List<K>* result = new DLinkedList<K>();
+        forEach([result](const K& key, V&) { result->append(key); });
+        return result;
+    }
+
+    /**
+     * @brief Recupera una lista de todos los valores en el diccionario.
+     *
+     * @return Un puntero a una lista que contiene todos los valores.
+     */
+    List<V>* getValues() {
+        List<V>* result = new DLinkedList<V>();
+        forEach([result](const K&, V& value) { result->append(value); });
+        return result;
+    }
+
+    /**
+     * @brief Obtiene el número de elementos en el diccionario.
+     *
+     * @return El tamaño del diccionario.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen los arreglos del diccionario.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Guarda los pares en orden de clave en un archivo binario de instantánea.
+     *
+     * El formato se describe en Snapshot.h y permite consultar el archivo en su lugar con
+     * MappedDictionary. Sólo está disponible si K y V son trivialmente copiables o string.
+     * Los arreglos se escriben directamente, con una sola copia cada uno si sus tipos son
+     * de tamaño fijo.
+     *
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        SnapshotWriter writer(path, SNAPSHOT_DICTIONARY, SNAPSHOT_SORTED,
+                              SnapshotCodec<K>::code(), SnapshotCodec<V>::code(), (uint64_t)size);
+        SnapshotCodec<K>::writeArray(writer, keyArray, size);
+        SnapshotCodec<V>::writeArray(writer, valueArray, size);
+        writer.finish();
+    }
+
+    /**
+     * @brief Reemplaza el contenido del diccionario por el de un archivo guardado con save().
+     *
+     * Las columnas del archivo tienen el mismo orden que los arreglos, así que se copian
+     * directamente, con una sola copia cada una si sus tipos son de tamaño fijo. Si el
+     * archivo tiene menos pares que el diccionario, los que sobran se liberan como en clear().
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error si no se puede abrir el archivo o no es un diccionario válido de K a V.
+     */
+    void load(const string& path) {
+        DictionarySnapshot<K, V> snapshot(path, true);
+        int count = snapshot.getCount();
+        if (count > max) {
+            K* newKeys = createArray<K>(resource, count);
+            V* newValues;
+            try {
+                newValues = createArray<V>(resource, count);
+            } catch (...) {
+                destroyArray(resource, newKeys, count);
+                throw;
+            }
+            destroyArray(resource, keyArray, max);
+            destroyArray(resource, valueArray, max);
+            keyArray = newKeys;
+            valueArray = newValues;
+            max = count;
+        }
+        snapshot.keys.copyTo(keyArray);
+        snapshot.values.copyTo(valueArray);
+        if (!std::is_trivially_destructible<K>::value || !std::is_trivially_destructible<V>::value) {
+            for (int i = count; i < size; i++) {
+                release(keyArray[i]);
+                release(valueArray[i]);
+            }
+        }
+        size = count;
+    }
+
+    /**
+     * @brief Imprime el contenido del diccionario.
+     */
+    void print() {
+        cout << "[ ";
+        for (int i = 0; i < size; i++)
+            cout << "(" << keyArray[i] << ", " << valueArray[i] << ") ";
+        cout << "]" << endl;
+    }
+};
@@ -13,8 +13,13 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 #include "Structures/Abstract/Dictionary.h"
+#include "Structures/Common/DictionaryEntry.h"
 #include "Structures/Common/KVPair.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Snapshot.h"
 #include "Structures/Implementations/Trees/SplayTree.h"
 #include "Structures/Implementations/Lists/DLinkedList.h"
 
@@ -22,8 +27,11 @@ template <typename K, typename V>
 class SplayDictionary : public Dictionary<K, V> {
 private:
     SplayTree<KVPair<K, V>>* pairs; ///< Árbol Splay que almacena los pares clave-valor.
+    MemoryResource* resource; ///< Recurso del que se obtienen el árbol y sus nodos.
 
 public:
+    typedef PairIterator<typename SplayTree<KVPair<K, V>>::Iterator, K, V> Iterator; ///< Iterador sobre las entradas, en orden de clave.
+
     /** 
      * @brief Constructor de copia (eliminado).
      */
@@ -38,9 +46,11 @@ public:
      * @brief Constructor por defecto.
      * 
      * Inicializa un árbol Splay vacío para almacenar pares clave-valor.
+     * 
+     * @param resource Recurso del que se obtienen el árbol y sus nodos (ver MemoryResource.h).
      */
-    SplayDictionary() {
-        pairs = new SplayTree<KVPair<K, V>>();
+    explicit SplayDictionary(MemoryResource* resource = defaultResource()) : resource(resource) {
+        pairs = create<SplayTree<KVPair<K, V>>>(resource, resource);
     }
 
     /** 
@@ -49,18 +59,28 @@ public:
      * Libera los recursos utilizados por el árbol Splay.
      */
     ~SplayDictionary() {
-        delete pairs;
+        destroy(resource, pairs);
     }
 
     /** 
      * @brief Inserta un nuevo par clave-valor en el diccionario.
      * 
-     * @param key La clave del par.
-     * @param value El valor asociado a la clave.
+     * @param key La clave del par, que se mueve al diccionario.
+     * @param value El valor asociado a la clave, que se mueve al diccionario.
      */
     void insert(K key, V value) {
-        KVPair<K, V> pair(key, value);
-        pairs->insert(pair);
+        pairs->insert(KVPair<K, V>(std::move(key), std::move(value)));
+    }
+
+    /** 
+     * @brief Intenta insertar un nuevo par clave-valor, sin lanzar excepciones si la clave ya existe.
+     * 
+     * @param key La clave del par, que se mueve al diccionario si se inserta.
+     * @param value El valor asociado a la clave, que se mueve al diccionario si se inserta.
+     * @return true si se insertó, false si la clave ya existía.
+     */
+    bool tryInsert(K key, V value) {
+        return pairs->tryInsert(KVPair<K, V>(std::move(key), std::move(value)));
     }
 
     /** 
@@ -70,10 +90,23 @@ public:
      * @return El valor asociado a la clave eliminada.
      * @throw std::runtime_error si la clave no existe en el diccionario.
      */
-    V remove(K key) {
-        KVPair<K, V> pair(key);
-        pair = pairs->remove(pair);
-        return pair.value;
+    V remove(const K& key) {
+        return pairs->remove(key).value;
+    }
+
+    /** 
+     * @brief Intenta eliminar un elemento por su clave, sin lanzar excepciones si no existe.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @param value Se asigna el valor eliminado; no cambia si la clave no existe.
+     * @return true si se eliminó, false si la clave no existía.
+     */
+    bool tryRemove(const K& key, V& value) {
+        KVPair<K, V> pair;
+        if (!pairs->tryRemove(key, pair))
+            return false;
+        value = std::move(pair.value);
+        return true;
     }
 
     /** 
@@ -83,23 +116,57 @@ public:
      * @return El valor asociado a la clave.
      * @throw std::runtime_error si la clave no existe en el diccionario.
      */
-    V getValue(K key) {
-        KVPair<K, V> pair(key);
-        pair = pairs->find(pair);
-        return pair.value;
+    V getValue(const K& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor asociado a una clave, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw std::runtime_error si la clave no existe en el diccionario.
+     */
+    V& at(const K& key) {
+        KVPair<K, V>* pair = pairs->search(key);
+        if (pair == nullptr)
+            throw runtime_error("Key not found.");
+        return pair->value;
+    }
+
+    /** 
+     * @brief Busca el valor asociado a una clave sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    const V* find(const K& key) {
+        KVPair<K, V>* pair = pairs->search(key);
+        return pair == nullptr ? nullptr : &pair->value;
     }
 
     /** 
      * @brief Establece un nuevo valor para una clave existente.
      * 
      * @param key La clave del elemento a actualizar.
-     * @param value El nuevo valor a establecer.
+     * @param value El nuevo valor a establecer, que se copia.
+     * @throw std::runtime_error si la clave no existe en el diccionario.
+     */
+    void setValue(const K& key, const V& value) {
+        at(key) = value;
+    }
+
+    /** 
+     * @brief Establece un nuevo valor para una clave existente moviéndolo.
+     * 
+     * El valor se reemplaza en el mismo nodo, sin eliminar y volver a insertar el par.
+     * 
+     * @param key La clave del elemento a actualizar.
+     * @param value El nuevo valor, que queda en un estado válido pero no especificado.
+     * @throw std::runtime_error si la clave no existe en el diccionario.
      */
-    void setValue(K key, V value) {
-        KVPair<K, V> pair(key, value);
-        pairs->remove(pair);
-        pairs->insert(pair);
-        
+    void setValue(const K& key, V&& value) {
+        at(key) = std::move(value);
     }
 
     /** 
@@ -108,9 +175,130 @@ public:
      * @param key La clave a buscar.
      * @return true si la clave existe en el diccionario, false en caso contrario.
      */
-    bool contains(K key) {
-        KVPair<K, V> pair(key);
-        return pairs->contains(pair);
+    bool contains(const K& key) {
+        return pairs->contains(key);
+    }
+
+    /** 
+     * @brief Verifica si el diccionario contiene una clave, buscándola con un tipo transparente para K.
+     * 
+     * Con claves string acepta, por ejemplo, un const char* sin construir un string (ver
+     * TransparentKey). Los demás tipos se convierten a K y usan contains(const K&).
+     * 
+     * @param key La clave a buscar.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, bool>::type contains(const Q& key) {
+        return pairs->contains(key);
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V&>::type at(const Q& key) {
+        KVPair<K, V>* pair = pairs->search(key);
+        if (pair == nullptr)
+            throw runtime_error("Key not found.");
+        return pair->value;
+    }
+
+    /** 
+     * @brief Recupera el valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type getValue(const Q& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Busca el valor de una clave con un tipo transparente para K, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, const V*>::type find(const Q& key) {
+        KVPair<K, V>* pair = pairs->search(key);
+        return pair == nullptr ? nullptr : &pair->value;
+    }
+
+    /** 
+     * @brief Elimina el par de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @return El valor asociado a la clave eliminada.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type remove(const Q& key) {
+        return pairs->remove(key).value;
+    }
+
+    /** 
+     * @brief Aplica una función a cada par en orden de clave, sin copiarlos.
+     * 
+     * Recorre el árbol directamente y no lo modifica, por lo que no reserva memoria.
+     * 
+     * @param visit Función que recibe (const K& clave, V& valor).
+     */
+    template <typename F>
+    void forEach(F visit) {
+        pairs->forEach([&visit](KVPair<K, V>& pair) { visit(pair.key, pair.value); });
+    }
+
+    /** 
+     * @brief Recorre todos los pares en orden de clave con un visitante.
+     * 
+     * @param visitor Visitante que recibe cada par.
+     */
+    void accept(typename Dictionary<K, V>::Visitor& visitor) {
+        forEach([&visitor](const K& key, V& value) { visitor.visit(key, value); });
+    }
+
+    /** 
+     * @brief Obtiene un iterador a la primera entrada, en orden de clave.
+     * 
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(pairs->begin());
+    }
+
+    /** 
+     * @brief Obtiene el iterador de fin del recorrido.
+     * 
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator(pairs->end());
+    }
+
+    /** 
+     * @brief Obtiene las claves en orden, sin copiarlas, para recorrerlas con un for de rango.
+     * 
+     * @return Rango sobre las claves.
+     */
+    Range<KeyIterator<Iterator, K>> keys() {
+        return Range<KeyIterator<Iterator, K>>(KeyIterator<Iterator, K>(begin()), KeyIterator<Iterator, K>(end()));
+    }
+
+    /** 
+     * @brief Obtiene los valores en orden de clave, sin copiarlos, para recorrerlos con un for de rango.
+     * 
+     * @return Rango sobre los valores.
+     */
+    Range<ValueIterator<Iterator, V>> values() {
+        return Range<ValueIterator<Iterator, V>>(ValueIterator<Iterator, V>(begin()), ValueIterator<Iterator, V>(end()));
     }
 
     /** 
@@ -119,19 +307,9 @@ public:
      * @return Un puntero a una lista que contiene todas las claves.
      */
     List<K>* getKeys() {
-        // Llama a una versión de getElements que no splayea el árbol en cada acceso.
-        List<KVPair<K, V>>* items = pairs->getElements();
-
-        List<K>* keys = new DLinkedList<K>();
-
-        // Itera sobre los pares sin modificar la estructura del árbol.
-        while (!items->atEnd()) {
-            auto pair = items->getElement();
-            keys->append(pair.key);
-            items->next();
-        }
-        delete items;
-        return keys;
+        List<K>* result = new DLinkedList<K>();
+        forEach([result](const K& key, V&) { result->append(key); });
+        return result;
     }
 
     /** 
@@ -140,15 +318,9 @@ public:
      * @return Un puntero a una lista que contiene todos los valores.
      */
     List<V>* getValues() {
-        List<KVPair<K, V>>* items = pairs->getElements();
-        List<V>* values = new DLinkedList<V>();
-        while (!items->atEnd()) {
-            auto pair = items->getElement();
-            values->append(pair.value);
-            items->next();
-        }
-        delete items;
-        return values;
+        List<V>* result = new DLinkedList<V>();
+        forEach([result](const K&, V& value) { result->append(value); });
+        return result;
     }
 
     /** 
@@ -160,6 +332,44 @@ public:
         return pairs->getSize();
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen el árbol y los nodos del diccionario.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /** 
+     * @brief Guarda los pares en orden de clave en un archivo binario de instantánea.
+     * 
+     * El formato se describe en Snapshot.h y permite consultar el archivo en su lugar con
+     * MappedDictionary. Sólo está disponible si K y V son trivialmente copiables o string.
+     * 
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        saveDictionarySnapshot<K, V>(*this, path, true);
+    }
+
+    /** 
+     * @brief Reemplaza el contenido del diccionario por el de un archivo guardado con save().
+     * 
+     * Las claves del archivo ya están ordenadas, por lo que el árbol se construye balanceado en
+     * O(n), sin comparaciones ni rotaciones.
+     * 
+     * @param path Ruta del archivo.
+     * @throw runtime_error si no se puede abrir el archivo o no es un diccionario válido de K a V.
+     */
+    void load(const string& path) {
+        DictionarySnapshot<K, V> snapshot(path, true);
+        pairs->assignSorted(snapshot.getCount(), [&snapshot](int i) {
+            return KVPair<K, V>(snapshot.keys[i], snapshot.values[i]);
+        });
+    }
+
     /** 
      * @brief Imprime el contenido del diccionario.
      */
@@ -10,32 +10,36 @@
 #pragma once
 
 #include <stdexcept>
+#include <utility>
 #include "Structures/Abstract/Dictionary.h"
 #include "Structures/Implementations/Lists/ArrayList.h"
 #include "Structures/Implementations/Lists/DLinkedList.h"
+#include "Structures/Common/DictionaryEntry.h"
+#include "Structures/Common/Snapshot.h"
 #include "Structures/Common/KVPair.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 
 using std::runtime_error;
 
 template <typename K, typename V>
 class UnsortedArrayDictionary : public Dictionary<K, V> {
 private:
-    List<KVPair<K, V>>* pairs; ///< Lista de pares clave-valor almacenados en el diccionario.
+    ArrayList<KVPair<K, V>>* pairs; ///< Lista de pares clave-valor almacenados en el diccionario.
+    MemoryResource* resource; ///< Recurso del que se obtienen la lista y su arreglo.
 
-    /** 
-     * @brief Verifica que una clave no exista en el diccionario.
+    /**
+     * @brief Busca la posición de una clave comparando directamente las claves de los pares.
      * 
-     * @param key La clave a verificar.
-     * @throw runtime_error si la clave ya existe en el diccionario.
+     * @param key La clave a buscar, de tipo K o transparente para K.
+     * @return La posición del par con esa clave, o -1 si no existe.
      */
-    void checkNotExisting(K key) {
-        KVPair<K, V> p(key);
-        pairs->goToStart();
-        while (!pairs->atEnd()) {
-            if (p == pairs->getElement())
-                throw runtime_error("Duplicated key.");
-            pairs->next();
-        }
+    template <typename Q>
+    int position(const Q& key) {
+        for (int i = 0; i < pairs->getSize(); i++)
+            if (pairs->at(i).key == key)
+                return i;
+        return -1;
     }
 
     /**
@@ -44,47 +48,69 @@ private:
      * Si la clave existe, la posición actual se actualiza para apuntar al par correspondiente.
      * 
      * @param key La clave a verificar.
+     * @return La posición del par con esa clave.
      * @throw runtime_error si la clave no se encuentra en el diccionario.
      */
-    void checkExisting(K key) {
-        KVPair<K, V> p(key);
-        pairs->goToStart();
-        while (!pairs->atEnd()) {
-            if (p == pairs->getElement())
-                return;
-            pairs->next();
-        }
-        throw runtime_error("Key not found.");
+    template <typename Q>
+    int checkExisting(const Q& key) {
+        int pos = position(key);
+        if (pos == -1)
+            throw runtime_error("Key not found.");
+        pairs->goToPos(pos);
+        return pos;
     }
 
 public:
+    typedef PairIterator<KVPair<K, V>*, K, V> Iterator; ///< Iterador sobre las entradas, en orden de inserción.
+
     /**
      * @brief Constructor que inicializa el diccionario con un tamaño máximo.
      * 
      * @param max El tamaño máximo del diccionario (por defecto es DEFAULT_MAX).
+     * @param resource Recurso del que se obtienen la lista y su arreglo (ver MemoryResource.h).
      */
-    UnsortedArrayDictionary(int max = DEFAULT_MAX) {
-        pairs = new ArrayList<KVPair<K, V>>(max);
+    UnsortedArrayDictionary(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource()) : resource(resource) {
+        pairs = create<ArrayList<KVPair<K, V>>>(resource, max, resource);
     }
 
+    /**
+     * @brief Constructor que inicializa el diccionario con el tamaño por defecto y el recurso indicado.
+     * 
+     * @param resource Recurso del que se obtienen la lista y su arreglo.
+     */
+    explicit UnsortedArrayDictionary(MemoryResource* resource) : UnsortedArrayDictionary(DEFAULT_MAX, resource) {}
+
     /**
      * @brief Destructor que libera los recursos utilizados por el diccionario.
      */
     ~UnsortedArrayDictionary() {
-        delete pairs;
+        destroy(resource, pairs);
     }
 
     /** 
      * @brief Inserta un nuevo par clave-valor en el diccionario.
      * 
-     * @param key La clave del par.
-     * @param value El valor asociado a la clave.
+     * @param key La clave del par, que se mueve al diccionario.
+     * @param value El valor asociado a la clave, que se mueve al diccionario.
      * @throw runtime_error si la clave ya existe en el diccionario.
      */
     void insert(K key, V value) {
-        checkNotExisting(key);
-        KVPair<K, V> p(key, value);
-        pairs->append(p);
+        if (!tryInsert(std::move(key), std::move(value)))
+            throw runtime_error("Duplicated key.");
+    }
+
+    /** 
+     * @brief Intenta insertar un nuevo par clave-valor, sin lanzar excepciones si la clave ya existe.
+     * 
+     * @param key La clave del par, que se mueve al diccionario si se inserta.
+     * @param value El valor asociado a la clave, que se mueve al diccionario si se inserta.
+     * @return true si se insertó, false si la clave ya existía.
+     */
+    bool tryInsert(K key, V value) {
+        if (position(key) != -1)
+            return false;
+        pairs->append(KVPair<K, V>(std::move(key), std::move(value)));
+        return true;
     }
 
     /** 
@@ -94,10 +120,25 @@ public:
      * @return El valor asociado a la clave eliminada.
      * @throw runtime_error si la clave no existe en el diccionario.
      */
-    V remove(K key) {
+    V remove(const K& key) {
         checkExisting(key);
-        KVPair<K, V> p = pairs->remove();
-        return p.value;
+        return pairs->remove().value;
+    }
+
+    /** 
+     * @brief Intenta eliminar un elemento por su clave, sin lanzar excepciones si no existe.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @param value Se asigna el valor eliminado; no cambia si la clave no existe.
+     * @return true si se eliminó, false si la clave no existía.
+     */
+    bool tryRemove(const K& key, V& value) {
+        int pos = position(key);
+        if (pos == -1)
+            return false;
+        pairs->goToPos(pos);
+        value = pairs->remove().value;
+        return true;
     }
 
     /** 
@@ -107,23 +148,52 @@ public:
      * @return El valor asociado a la clave.
      * @throw runtime_error si la clave no existe en el diccionario.
      */
-    V getValue(K key) {
-        checkExisting(key);
-        KVPair<K, V> p = pairs->getElement();
-        return p.value;
+    V getValue(const K& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor asociado a una clave, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    V& at(const K& key) {
+        return pairs->at(checkExisting(key)).value;
+    }
+
+    /** 
+     * @brief Busca el valor asociado a una clave sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    const V* find(const K& key) {
+        int pos = position(key);
+        return pos == -1 ? nullptr : &pairs->at(pos).value;
     }
 
     /** 
      * @brief Establece un nuevo valor para una clave existente.
      * 
      * @param key La clave del elemento a actualizar.
-     * @param value El nuevo valor a establecer.
+     * @param value El nuevo valor a establecer, que se copia.
      * @throw runtime_error si la clave no existe en el diccionario.
      */
-    void setValue(K key, V value) {
-        checkExisting(key);
-        KVPair<K, V> p(key, value);
-        pairs->set(p);
+    void setValue(const K& key, const V& value) {
+        at(key) = value;
+    }
+
+    /** 
+     * @brief Establece un nuevo valor para una clave existente moviéndolo.
+     * 
+     * @param key La clave del elemento a actualizar.
+     * @param value El nuevo valor, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    void setValue(const K& key, V&& value) {
+        at(key) = std::move(value);
     }
 
     /** 
@@ -132,15 +202,127 @@ public:
      * @param key La clave a buscar.
      * @return true si la clave existe en el diccionario, false en caso contrario.
      */
-    bool contains(K key) {
-        KVPair<K, V> p(key);
-        pairs->goToStart();
-        while (!pairs->atEnd()) {
-            if (p == pairs->getElement())
-                return true;
-            pairs->next();
-        }
-        return false;
+    bool contains(const K& key) {
+        return position(key) != -1;
+    }
+
+    /** 
+     * @brief Verifica si el diccionario contiene una clave, buscándola con un tipo transparente para K.
+     * 
+     * Con claves string acepta, por ejemplo, un const char* sin construir un string (ver
+     * TransparentKey). Los demás tipos se convierten a K y usan contains(const K&).
+     * 
+     * @param key La clave a buscar.
+     * @return true si la clave existe, false en caso contrario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, bool>::type contains(const Q& key) {
+        return position(key) != -1;
+    }
+
+    /** 
+     * @brief Obtiene una referencia al valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Referencia al valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V&>::type at(const Q& key) {
+        return pairs->at(checkExisting(key)).value;
+    }
+
+    /** 
+     * @brief Recupera el valor de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return El valor asociado a la clave.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type getValue(const Q& key) {
+        return at(key);
+    }
+
+    /** 
+     * @brief Busca el valor de una clave con un tipo transparente para K, sin copiarlo.
+     * 
+     * @param key La clave del elemento a buscar.
+     * @return Puntero al valor asociado a la clave, o nullptr si no existe.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, const V*>::type find(const Q& key) {
+        int pos = position(key);
+        return pos == -1 ? nullptr : &pairs->at(pos).value;
+    }
+
+    /** 
+     * @brief Elimina el par de una clave buscada con un tipo transparente para K.
+     * 
+     * @param key La clave del elemento a eliminar.
+     * @return El valor asociado a la clave eliminada.
+     * @throw runtime_error si la clave no existe en el diccionario.
+     */
+    template <typename Q>
+    typename TransparentLookup<K, Q, V>::type remove(const Q& key) {
+        checkExisting(key);
+        return pairs->remove().value;
+    }
+
+    /** 
+     * @brief Aplica una función a cada par en orden de inserción, sin copiarlos.
+     * 
+     * @param visit Función que recibe (const K& clave, V& valor).
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (KVPair<K, V>* pair = pairs->begin(); pair != pairs->end(); ++pair)
+            visit(pair->key, pair->value);
+    }
+
+    /** 
+     * @brief Recorre todos los pares en orden de inserción con un visitante.
+     * 
+     * @param visitor Visitante que recibe cada par.
+     */
+    void accept(typename Dictionary<K, V>::Visitor& visitor) {
+        forEach([&visitor](const K& key, V& value) { visitor.visit(key, value); });
+    }
+
+    /** 
+     * @brief Obtiene un iterador a la primera entrada.
+     * 
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(pairs->begin());
+    }
+
+    /** 
+     * @brief Obtiene el iterador de fin del recorrido.
+     * 
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator(pairs->end());
+    }
+
+    /** 
+     * @brief Obtiene las claves, sin copiarlas, para recorrerlas con un for de rango.
+     * 
+     * @return Rango sobre las claves.
+     */
+    Range<KeyIterator<Iterator, K>> keys() {
+        return Range<KeyIterator<Iterator, K>>(KeyIterator<Iterator, K>(begin()), KeyIterator<Iterator, K>(end()));
+    }
+
+    /** 
+     * @brief Obtiene los valores, sin copiarlos, para recorrerlos con un for de rango.
+     * 
+     * @return Rango sobre los valores.
+     */
+    Range<ValueIterator<Iterator, V>> values() {
+        return Range<ValueIterator<Iterator, V>>(ValueIterator<Iterator, V>(begin()), ValueIterator<Iterator, V>(end()));
     }
 
     /** 
@@ -149,14 +331,9 @@ public:
      * @return Un puntero a una lista que contiene todas las claves.
      */
     List<K>* getKeys() {
-        List<K>* keys = new DLinkedList<K>();
-        pairs->goToStart();
-        while (!pairs->atEnd()) {
-            KVPair<K, V> p = pairs->getElement();
-            keys->append(p.key);
-            pairs->next();
-        }
-        return keys;
+        List<K>* result = new DLinkedList<K>();
+        forEach([result](const K& key, V&) { result->append(key); });
+        return result;
     }
 
     /** 
@@ -165,14 +342,9 @@ public:
      * @return Un puntero a una lista que contiene todos los valores.
      */
     List<V>* getValues() {
-        List<V>* values = new DLinkedList<V>();
-        pairs->goToStart();
-        while (!pairs->atEnd()) {
-            KVPair<K, V> p = pairs->getElement();
-            values->append(p.value);
-            pairs->next();
-        }
-        return values;
+        List<V>* result = new DLinkedList<V>();
+        forEach([result](const K&, V& value) { result->append(value); });
+        return result;
     }
 
     /** 
@@ -184,6 +356,46 @@ public:
         return pairs->getSize();
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen la lista y el arreglo del diccionario.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /** 
+     * @brief Guarda los pares en orden de clave en un archivo binario de instantánea.
+     * 
+     * El formato se describe en Snapshot.h y permite consultar el archivo en su lugar con
+     * MappedDictionary. Sólo está disponible si K y V son trivialmente copiables o string.
+     * Los pares se ordenan por referencia antes de escribirlos; K debe soportar el
+     * operador <.
+     * 
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        saveDictionarySnapshot<K, V>(*this, path, false);
+    }
+
+    /** 
+     * @brief Reemplaza el contenido del diccionario por el de un archivo guardado con save().
+     * 
+     * Las claves del archivo son únicas, por lo que los pares se agregan sin buscar
+     * duplicados.
+     * 
+     * @param path Ruta del archivo.
+     * @throw runtime_error si no se puede abrir el archivo o no es un diccionario válido de K a V.
+     */
+    void load(const string& path) {
+        DictionarySnapshot<K, V> snapshot(path, true);
+        pairs->clear();
+        for (int i = 0; i < snapshot.getCount(); i++)
+            pairs->append(KVPair<K, V>(snapshot.keys[i], snapshot.values[i]));
+    }
+
     /** 
      * @brief Imprime el contenido del diccionario.
      */
@@ -14,7 +14,13 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "Structures/Abstract/List.h"
+#include "Structures/Common/Instrumentation.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/SimdKernels.h"
+#include "Structures/Common/Snapshot.h"
+#include "Structures/Common/Sorting.h"
 
 using std::runtime_error;
 using std::cout;
@@ -35,21 +41,83 @@ protected:
     int max;     ///< Capacidad máxima actual del arreglo.
     int size;    ///< Número de elementos actualmente almacenados en la lista.
     int pos;     ///< Posición actual en la lista.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
+
+    /**
+     * @brief Operaciones instrumentadas; su trabajo es la cantidad de elementos desplazados.
+     */
+    enum Operation { INSERT, APPEND, REMOVE, OPERATION_COUNT };
+
+    /**
+     * @brief Contadores instrumentados.
+     */
+    enum Counter { EXPANSIONS, COUNTER_COUNT };
+
+    typedef Instrumentation<OPERATION_COUNT, COUNTER_COUNT> Instruments; ///< Política de instrumentación.
+    Instruments instrumentation; ///< Mediciones de las operaciones (vacías si no se compila con STRUCTURES_INSTRUMENTATION).
+
+    /**
+     * @brief Garantiza que el arreglo tenga al menos la capacidad indicada.
+     *
+     * Si la capacidad actual es suficiente no hace nada. En caso contrario crea un
+     * nuevo arreglo con la capacidad pedida, copia los elementos existentes y libera
+     * la memoria del arreglo antiguo.
+     *
+     * @param capacity Capacidad mínima requerida.
+     */
+    void reserve(int capacity) {
+        if (capacity <= max)
+            return;
+        instrumentation.count(EXPANSIONS);
+        E* newElements = createArray<E>(resource, capacity);
+        for (int i = 0; i < size; i++)
+            newElements[i] = std::move(elements[i]);
+        destroyArray(resource, elements, max);
+        elements = newElements;
+        max = capacity;
+    }
+
+    /**
+     * @brief Reemplaza el contenido de la lista por una columna de una instantánea.
+     *
+     * @param column Columna ya validada.
+     * @param count Cantidad de elementos de la columna.
+     */
+    template <typename Column>
+    void assignColumn(const Column& column, int count) {
+        size = pos = 0;
+        reserve(count);
+        column.copyTo(elements);
+        size = count;
+    }
 
 private:
+    /**
+     * @brief Desplaza una posición a la derecha los elementos en [from, to).
+     *
+     * Está separado de insert() para que el compilador pueda convertir el ciclo en un
+     * memmove también cuando la instrumentación está activa.
+     */
+    void shiftRight(int from, int to) {
+        for (int i = to; i > from; i--)
+            elements[i] = std::move(elements[i - 1]);
+    }
+
+    /**
+     * @brief Desplaza una posición a la izquierda los elementos en [from, to).
+     */
+    void shiftLeft(int from, int to) {
+        for (int i = from; i < to; i++)
+            elements[i - 1] = std::move(elements[i]);
+    }
+
     /**
      * @brief Expande la capacidad del arreglo cuando éste se encuentra lleno.
      *
-     * Crea un nuevo arreglo con el doble de la capacidad actual, copia los elementos
-     * existentes y libera la memoria del arreglo antiguo.
+     * Duplica la capacidad actual del arreglo.
      */
     void expand() {
-        E* newElements = new E[max * 2];
-        for (int i = 0; i < size; i++)
-            newElements[i] = elements[i];
-        delete[] elements;
-        elements = newElements;
-        max *= 2;
+        reserve(max * 2);
     }
 
 public:
@@ -57,22 +125,30 @@ public:
      * @brief Constructor que inicializa la lista con una capacidad máxima.
      *
      * @param max Capacidad máxima inicial de la lista. Si no se especifica, se utiliza DEFAULT_MAX.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
      * @throws runtime_error Si el tamaño máximo es menor que 1.
      */
-    ArrayList(int max = DEFAULT_MAX) {
+    ArrayList(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource()) : resource(resource) {
         if (max < 1)
             throw runtime_error("Invalid max size.");
-        elements = new E[max];
+        elements = createArray<E>(resource, max);
         this->max = max;
         size = 0;
         pos = 0;
     }
 
+    /**
+     * @brief Constructor que inicializa la lista con la capacidad por defecto y el recurso indicado.
+     *
+     * @param resource Recurso del que se obtiene el arreglo.
+     */
+    explicit ArrayList(MemoryResource* resource) : ArrayList(DEFAULT_MAX, resource) {}
+
     /**
      * @brief Destructor que libera la memoria utilizada por el arreglo dinámico.
      */
     ~ArrayList() {
-        delete[] elements;
+        destroyArray(resource, elements, max);
     }
 
     /**
@@ -81,14 +157,27 @@ public:
      * Si el arreglo está lleno, se expande su capacidad antes de insertar.
      * Los elementos a partir de la posición actual se desplazan hacia la derecha.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     */
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la posición actual de la lista moviéndolo.
+     *
+     * La copia de insert(const E&) se hace antes de expandir el arreglo, por lo que es
+     * válido insertar un elemento de la misma lista.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
      */
-    void insert(E element) {
+    void insert(E&& element) {
+        typename Instruments::Scope scope(instrumentation, INSERT);
         if (size == max)
             expand();
-        for (int i = size; i > pos; i--)
-            elements[i] = elements[i - 1];
-        elements[pos] = element;
+        scope.addWork(size - pos);
+        shiftRight(pos, size);
+        elements[pos] = std::move(element);
         size++;
     }
 
@@ -97,12 +186,22 @@ public:
      *
      * Si el arreglo está lleno, se expande su capacidad antes de agregar el elemento.
      *
-     * @param element Elemento a agregar.
+     * @param element Elemento a agregar, que se copia.
      */
-    void append(E element) {
+    void append(const E& element) {
+        append(E(element));
+    }
+
+    /**
+     * @brief Agrega un elemento al final de la lista moviéndolo.
+     *
+     * @param element Elemento a agregar, que queda en un estado válido pero no especificado.
+     */
+    void append(E&& element) {
+        typename Instruments::Scope scope(instrumentation, APPEND);
         if (size == max)
             expand();
-        elements[size] = element;
+        elements[size] = std::move(element);
         size++;
     }
 
@@ -112,7 +211,7 @@ public:
      * @param element Nuevo valor a asignar al elemento en la posición actual.
      * @throws runtime_error Si la lista está vacía o no hay elemento actual.
      */
-    void set(E element) {
+    void set(const E& element) {
         if (size == 0)
             throw runtime_error("List is empty.");
         if (pos == size)
@@ -120,6 +219,20 @@ public:
         elements[pos] = element;
     }
 
+    /**
+     * @brief Modifica el elemento en la posición actual moviendo el nuevo valor.
+     *
+     * @param element Nuevo valor, que queda en un estado válido pero no especificado.
+     * @throws runtime_error Si la lista está vacía o no hay elemento actual.
+     */
+    void set(E&& element) {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        if (pos == size)
+            throw runtime_error("No current element.");
+        elements[pos] = std::move(element);
+    }
+
     /**
      * @brief Elimina y retorna el elemento en la posición actual.
      *
@@ -129,13 +242,14 @@ public:
      * @throws runtime_error Si la lista está vacía o no hay elemento actual.
      */
     E remove() {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
         if (size == 0)
             throw runtime_error("List is empty.");
         if (pos == size)
             throw runtime_error("No current element.");
-        E result = elements[pos];
-        for (int i = pos + 1; i < size; i++)
-            elements[i - 1] = elements[i];
+        E result = std::move(elements[pos]);
+        scope.addWork(size - pos - 1);
+        shiftLeft(pos + 1, size);
         size--;
         return result;
     }
@@ -154,6 +268,19 @@ public:
         return elements[pos];
     }
 
+    /**
+     * @brief Obtiene una referencia al elemento en una posición, sin copiarlo ni mover el cursor.
+     *
+     * @param pos Posición del elemento.
+     * @return Referencia al elemento.
+     * @throws runtime_error Si la posición está fuera de los límites.
+     */
+    E& at(int pos) {
+        if (pos < 0 || pos >= size)
+            throw runtime_error("Index out of bounds.");
+        return elements[pos];
+    }
+
     /**
      * @brief Elimina todos los elementos de la lista.
      *
@@ -245,21 +372,93 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Obtiene un puntero al primer elemento, para recorrer el arreglo directamente.
+     *
+     * El recorrido no mueve el cursor. Los punteros son válidos hasta la siguiente
+     * inserción, que puede reubicar el arreglo.
+     *
+     * @return Puntero al primer elemento.
+     */
+    E* begin() {
+        return elements;
+    }
+
+    /**
+     * @brief Obtiene un puntero a la posición siguiente al último elemento.
+     *
+     * @return Puntero al final del arreglo ocupado.
+     */
+    E* end() {
+        return elements + size;
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento en orden, sin copiarlos ni mover el cursor.
+     *
+     * @param visit Función que recibe una referencia a cada elemento.
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (int i = 0; i < size; i++)
+            visit(elements[i]);
+    }
+
+    /**
+     * @brief Guarda los elementos en un archivo binario de instantánea (ver Snapshot.h).
+     *
+     * Sólo está disponible si E es trivialmente copiable o string. Los elementos de tamaño
+     * fijo se escriben con una sola copia del arreglo.
+     *
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error Si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        SnapshotWriter writer(path, SNAPSHOT_SEQUENCE, 0, SnapshotCodec<E>::code(), 0, (uint64_t)size);
+        SnapshotCodec<E>::writeArray(writer, elements, size);
+        writer.finish();
+    }
+
+    /**
+     * @brief Reemplaza el contenido de la lista por el de un archivo guardado con save().
+     *
+     * El archivo se proyecta en memoria y se copia al arreglo reservando una sola vez, sin
+     * insertar elemento por elemento. El cursor queda al inicio.
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error Si no se puede abrir el archivo o no guarda una secuencia de E.
+     */
+    void load(const string& path) {
+        SnapshotFile file(path, SNAPSHOT_SEQUENCE, SnapshotCodec<E>::code(), 0, true);
+        typename SnapshotCodec<E>::Column column = file.column<E>();
+        column.validate();
+        assignColumn(column, file.getCount());
+    }
+
     /**
      * @brief Busca el índice de un elemento en la lista a partir de una posición inicial.
      *
+     * Para int, float y uint64_t la búsqueda se realiza con instrucciones vectoriales.
+     *
      * @param element Elemento a buscar.
      * @param start Posición desde la cual iniciar la búsqueda (por defecto 0).
      * @return El índice del elemento si se encuentra; de lo contrario, -1.
      * @throws runtime_error Si la posición de inicio está fuera de los límites.
      */
-    int indexOf(E element, int start = 0) {
+    int indexOf(const E& element, int start = 0) {
         if (start < 0 || start >= size)
             throw runtime_error("Index out of bounds.");
-        for (int i = start; i < size; i++)
-            if (elements[i] == element)
-                return i;
-        return -1;
+        int index = simdFind(elements + start, size - start, element);
+        return index == -1 ? -1 : start + index;
     }
 
     /**
@@ -268,8 +467,54 @@ public:
      * @param element Elemento a buscar.
      * @return true si el elemento está presente, false en caso contrario.
      */
-    bool contains(E element) {
-        return indexOf(element, 0) != -1;
+    bool contains(const E& element) {
+        return simdFind(elements, size, element) != -1;
+    }
+
+    /**
+     * @brief Cuenta las apariciones de un elemento en la lista.
+     *
+     * @param element Elemento a contar.
+     * @return La cantidad de posiciones que contienen el elemento.
+     */
+    int count(const E& element) {
+        return simdCount(elements, size, element);
+    }
+
+    /**
+     * @brief Obtiene el menor elemento de la lista.
+     *
+     * @return El menor elemento.
+     * @throws runtime_error Si la lista está vacía.
+     */
+    E minElement() {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        return simdMin(elements, size);
+    }
+
+    /**
+     * @brief Obtiene el mayor elemento de la lista.
+     *
+     * @return El mayor elemento.
+     * @throws runtime_error Si la lista está vacía.
+     */
+    E maxElement() {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        return simdMax(elements, size);
+    }
+
+    /**
+     * @brief Suma todos los elementos de la lista.
+     *
+     * Con float, la versión vectorial agrupa las sumas en otro orden, por lo que el
+     * resultado puede diferir en el redondeo del de una suma secuencial.
+     *
+     * @return La suma de los elementos, o E() si la lista está vacía.
+     */
+    E sum() {
+        return simdSum(elements, size);
     }
 
     /**
@@ -278,17 +523,45 @@ public:
      * Crea un nuevo arreglo con los elementos en orden inverso y reemplaza el arreglo actual.
      */
     void reverse() {
-        E* newElements = new E[max];
+        E* newElements = createArray<E>(resource, max);
         for (int i = 0; i < size; i++)
             newElements[i] = elements[size - i - 1];
-        delete[] elements;
+        destroyArray(resource, elements, max);
         elements = newElements;
     }
 
+    /**
+     * @brief Ordena los elementos de la lista en orden ascendente.
+     *
+     * Para tipos enteros se utiliza radix sort; para el resto, introsort. Si la lista
+     * es grande, el trabajo se reparte entre varios hilos. El cursor queda al inicio.
+     *
+     * @param threads Cantidad máxima de hilos; 0 utiliza los que reporte el sistema.
+     */
+    void sort(int threads = 0) {
+        parallelSort(elements, size, false, threads, resource);
+        pos = 0;
+    }
+
+    /**
+     * @brief Ordena los elementos conservando el orden relativo de los elementos iguales.
+     *
+     * Igual que sort(), pero con un algoritmo estable (radix sort o merge sort).
+     * El cursor queda al inicio.
+     *
+     * @param threads Cantidad máxima de hilos; 0 utiliza los que reporte el sistema.
+     */
+    void stableSort(int threads = 0) {
+        parallelSort(elements, size, true, threads, resource);
+        pos = 0;
+    }
+
     /**
      * @brief Compara la lista actual con otra lista para determinar si son iguales.
      *
      * Dos listas son iguales si tienen el mismo tamaño y los elementos en cada posición son idénticos.
+     * Si la otra lista también es un ArrayList, se comparan ambos arreglos directamente;
+     * en caso contrario se recorre la otra lista desde el inicio con su cursor.
      *
      * @param other Puntero a otra lista que implementa la interfaz List.
      * @return true si las listas son iguales, false en caso contrario.
@@ -296,12 +569,32 @@ public:
     bool equals(List<E>* other) {
         if (size != other->getSize())
             return false;
-        for (int i = 0; i < size; i++)
-            if (elements[i] != other->getElement())
+        ArrayList<E>* array = dynamic_cast<ArrayList<E>*>(other);
+        if (array != nullptr)
+            return simdEquals(elements, array->elements, size);
+        other->goToStart();
+        for (int i = 0; i < size; i++) {
+            if (!(elements[i] == other->getElement()))
                 return false;
+            other->next();
+        }
         return true;
     }
 
+    /**
+     * @brief Obtiene las mediciones de la lista.
+     *
+     * Si no se compiló con STRUCTURES_INSTRUMENTATION, la instantánea está vacía.
+     * El trabajo de insert y remove es la cantidad de elementos desplazados.
+     *
+     * @return Instantánea de las mediciones.
+     */
+    Stats stats() const {
+        static const char* const operations[] = { "insert", "append", "remove" };
+        static const char* const counters[] = { "expansions" };
+        return instrumentation.snapshot(operations, counters);
+    }
+
     /**
      * @brief Imprime el contenido de la lista.
      *
@@ -12,6 +12,8 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/Node.h"
 
 using std::runtime_error;
@@ -31,14 +33,17 @@ class CircleList {
 private:
     Node<E>* current; ///< Puntero al nodo actual de la lista.
     int size;         ///< Número de elementos en la lista.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
 public:
     /**
      * @brief Constructor por defecto.
      *
      * Inicializa la lista circular vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    CircleList() : current(nullptr), size(0) {}
+    explicit CircleList(MemoryResource* resource = defaultResource()) : current(nullptr), size(0), resource(resource) {}
 
     /**
      * @brief Destructor.
@@ -55,15 +60,24 @@ public:
      * Si la lista está vacía, crea el primer nodo y establece el enlace circular.
      * En caso contrario, inserta el nuevo elemento inmediatamente después del nodo actual.
      *
-     * @param element Elemento a insertar en la lista.
+     * @param element Elemento a insertar en la lista, que se copia.
+     */
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la lista circular moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
      */
-    void insert(E element) {
+    void insert(E&& element) {
         if (size == 0) {
-            current = new Node<E>(element);
+            current = create<Node<E>>(resource, std::move(element));
             current->next = current;
         }
         else {
-            Node<E>* newNode = new Node<E>(element, current->next);
+            Node<E>* newNode = create<Node<E>>(resource, std::move(element), current->next);
             current->next = newNode;
         }
         size++;
@@ -81,7 +95,7 @@ public:
         if (size == 0)
             throw runtime_error("List is empty.");
 
-        E result = current->next->element;
+        E result = std::move(current->next->element);
         Node<E>* temp = current->next;
 
         if (size == 1) { // Si solo hay un elemento
@@ -90,7 +104,7 @@ public:
             current->next = temp->next;
         }
 
-        delete temp;
+        destroy(resource, temp);
         size--;
         return result;
     }
@@ -168,6 +182,15 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Imprime el contenido de la lista.
      *
@@ -224,7 +247,7 @@ public:
      * @return El índice del elemento si se encuentra, o -1 si no existe.
      * @throws runtime_error Si el índice inicial está fuera de los límites de la lista.
      */
-    int indexOf(E element, int start = 0) {
+    int indexOf(const E& element, int start = 0) {
         if (start < 0 || start >= size)
             throw runtime_error("Index out of bounds.");
 
@@ -246,7 +269,7 @@ public:
      * @param element Elemento a buscar.
      * @return true si el elemento existe en la lista, false en caso contrario.
      */
-    bool contains(E element) {
+    bool contains(const E& element) {
         return indexOf(element, 0) != -1;
     }
 
@@ -12,6 +12,8 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/DNode.h"
 
 using std::runtime_error;
@@ -31,14 +33,17 @@ class DCircleList {
 private:
     DNode<E>* current; ///< Puntero al nodo actual de la lista.
     int size;          ///< Número de elementos en la lista.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
 public:
     /**
      * @brief Constructor por defecto.
      *
      * Inicializa la lista vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    DCircleList() : current(nullptr), size(0) {}
+    explicit DCircleList(MemoryResource* resource = defaultResource()) : current(nullptr), size(0), resource(resource) {}
 
     /**
      * @brief Destructor.
@@ -56,15 +61,24 @@ public:
      * de siguiente y anterior apuntando a sí mismo. En caso contrario, inserta
      * el nuevo nodo inmediatamente después del nodo actual y ajusta los enlaces.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     */
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la lista circular moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
      */
-    void insert(E element) {
+    void insert(E&& element) {
         if (size == 0) {
-            current = new DNode<E>(element);
+            current = create<DNode<E>>(resource, std::move(element), nullptr, nullptr);
             current->next = current;
             current->previous = current;
         } else {
-            DNode<E>* newNode = new DNode<E>(element, current->next, current);
+            DNode<E>* newNode = create<DNode<E>>(resource, std::move(element), current->next, current);
             current->next->previous = newNode;
             current->next = newNode;
         }
@@ -83,7 +97,7 @@ public:
         if (size == 0)
             throw runtime_error("List is empty.");
 
-        E result = current->next->element;
+        E result = std::move(current->next->element);
         DNode<E>* temp = current->next;
 
         if (size == 1) { // Si solo hay un elemento
@@ -93,7 +107,7 @@ public:
             temp->next->previous = current;
         }
 
-        delete temp;
+        destroy(resource, temp);
         size--;
         return result;
     }
@@ -166,6 +180,15 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Imprime los elementos de la lista.
      *
@@ -222,7 +245,7 @@ public:
      * @return El índice del elemento si se encuentra; de lo contrario, -1.
      * @throws runtime_error Si el índice inicial está fuera de los límites.
      */
-    int indexOf(E element, int start = 0) const {
+    int indexOf(const E& element, int start = 0) const {
         if (start < 0 || start >= size)
             throw runtime_error("Index out of bounds.");
 
@@ -244,7 +267,7 @@ public:
      * @param element Elemento a buscar.
      * @return true si el elemento está en la lista, false en caso contrario.
      */
-    bool contains(E element) const {
+    bool contains(const E& element) const {
         return indexOf(element, 0) != -1;
     }
 
@@ -12,8 +12,12 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "Structures/Abstract/List.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/DNode.h"
+#include "Structures/Common/Sorting.h"
 
 using std::runtime_error;
 using std::cout;
@@ -31,14 +35,51 @@ private:
     DNode<E>* tail;    ///< Puntero al nodo ficticio al final de la lista.
     DNode<E>* current; ///< Puntero al nodo actual.
     int size;          ///< Número de elementos en la lista.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
 public:
+    /**
+     * @brief Iterador que recorre los nodos de la lista del inicio al final.
+     *
+     * No mueve el cursor de la lista y entrega los elementos por referencia.
+     */
+    class Iterator {
+    private:
+        DNode<E>* node; ///< Nodo actual.
+
+    public:
+        explicit Iterator(DNode<E>* node) : node(node) {}
+
+        E& operator*() {
+            return node->element;
+        }
+
+        E* operator->() {
+            return &node->element;
+        }
+
+        Iterator& operator++() {
+            node = node->next;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const {
+            return node == other.node;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return node != other.node;
+        }
+    };
+
     /**
      * @brief Constructor que inicializa una lista vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    DLinkedList() {
-        current = head = new DNode<E>(nullptr, nullptr);
-        head->next = tail = new DNode<E>(nullptr, head);
+    explicit DLinkedList(MemoryResource* resource = defaultResource()) : resource(resource) {
+        current = head = create<DNode<E>>(resource, nullptr, nullptr);
+        head->next = tail = create<DNode<E>>(resource, nullptr, head);
         size = 0;
     }
 
@@ -47,37 +88,55 @@ public:
      */
     ~DLinkedList() {
         clear();
-        delete head;
-        delete tail;
+        destroy(resource, head);
+        destroy(resource, tail);
     }
 
     /**
      * @brief Inserta un elemento en la posición actual.
      * 
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      */
-    void insert(E element) {
-        current->next = current->next->previous = new DNode<E>(element, current->next, current);
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la posición actual moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void insert(E&& element) {
+        current->next = current->next->previous = create<DNode<E>>(resource, std::move(element), current->next, current);
         size++;
     }
 
     /**
      * @brief Agrega un elemento al final de la lista.
      * 
-     * @param element Elemento a agregar.
+     * @param element Elemento a agregar, que se copia.
+     */
+    void append(const E& element) {
+        append(E(element));
+    }
+
+    /**
+     * @brief Agrega un elemento al final de la lista moviéndolo.
+     * 
+     * @param element Elemento a agregar, que queda en un estado válido pero no especificado.
      */
-    void append(E element) {
-        tail->previous = tail->previous->next = new DNode<E>(element, tail, tail->previous);
+    void append(E&& element) {
+        tail->previous = tail->previous->next = create<DNode<E>>(resource, std::move(element), tail, tail->previous);
         size++;
     }
 
     /**
      * @brief Reemplaza el elemento en la posición actual.
      * 
-     * @param element Nuevo elemento.
+     * @param element Nuevo elemento, que se copia.
      * @throw runtime_error Si la lista está vacía o no hay elemento actual.
      */
-    void set(E element) {
+    void set(const E& element) {
         if (size == 0)
             throw runtime_error("List is empty.");
         if (current->next == tail)
@@ -85,6 +144,20 @@ public:
         current->next->element = element;
     }
 
+    /**
+     * @brief Reemplaza el elemento en la posición actual moviendo el nuevo valor.
+     * 
+     * @param element Nuevo elemento, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si la lista está vacía o no hay elemento actual.
+     */
+    void set(E&& element) {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        if (current->next == tail)
+            throw runtime_error("No current element.");
+        current->next->element = std::move(element);
+    }
+
     /**
      * @brief Elimina y devuelve el elemento en la posición actual.
      * 
@@ -96,9 +169,9 @@ public:
             throw runtime_error("List is empty.");
         if (current->next == tail)
             throw runtime_error("No current element.");
-        E result = current->next->element;
+        E result = std::move(current->next->element);
         current->next = current->next->next;
-        delete current->next->previous;
+        destroy(resource, current->next->previous);
         current->next->previous = current;
         size--;
         return result;
@@ -118,13 +191,38 @@ public:
         return current->next->element;
     }
 
+    /**
+     * @brief Devuelve una referencia al elemento en una posición, sin copiarlo ni mover el cursor.
+     * 
+     * Recorre la lista desde el extremo más cercano a la posición.
+     * 
+     * @param pos Posición del elemento.
+     * @return Referencia al elemento.
+     * @throw runtime_error Si la posición está fuera de los límites de la lista.
+     */
+    E& at(int pos) {
+        if (pos < 0 || pos >= size)
+            throw runtime_error("Index out of bounds.");
+        DNode<E>* temp;
+        if (pos <= size / 2) {
+            temp = head->next;
+            for (int i = 0; i < pos; i++)
+                temp = temp->next;
+        } else {
+            temp = tail->previous;
+            for (int i = size - 1; i > pos; i--)
+                temp = temp->previous;
+        }
+        return temp->element;
+    }
+
     /**
      * @brief Elimina todos los elementos de la lista.
      */
     void clear() {
         while (head->next != tail) {
             head->next = head->next->next;
-            delete head->next->previous;
+            destroy(resource, head->next->previous);
         }
         current = tail->previous = head;
         size = 0;
@@ -222,6 +320,44 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Obtiene un iterador al primer elemento.
+     *
+     * @return Iterador al inicio de la lista.
+     */
+    Iterator begin() {
+        return Iterator(head->next);
+    }
+
+    /**
+     * @brief Obtiene el iterador de fin, que apunta al nodo ficticio final.
+     *
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator(tail);
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento en orden, sin copiarlos ni mover el cursor.
+     *
+     * @param visit Función que recibe una referencia a cada elemento.
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (DNode<E>* node = head->next; node != tail; node = node->next)
+            visit(node->element);
+    }
+
     /**
      * @brief Imprime los elementos de la lista.
      */
@@ -247,7 +383,7 @@ public:
      * @return Índice del elemento, o -1 si no se encuentra.
      * @throw runtime_error Si la posición de inicio está fuera de los límites.
      */
-    int indexOf(E element, int start = 0) {
+    int indexOf(const E& element, int start = 0) {
         if (start < 0 || start >= size)
             throw runtime_error("Index out of bounds.");
         DNode<E>* temp = head->next;
@@ -267,15 +403,48 @@ public:
      * @param element Elemento a buscar.
      * @return true si el elemento está en la lista, false en caso contrario.
      */
-    bool contains(E element) {
+    bool contains(const E& element) {
+        return find(element) != nullptr;
+    }
+
+    /**
+     * @brief Busca un elemento y devuelve un puntero a él, sin copiarlo.
+     * 
+     * Igual que contains(), deja el cursor sobre el elemento encontrado o al final
+     * de la lista si no existe.
+     * 
+     * @param element Elemento a buscar.
+     * @return Puntero al primer elemento igual dentro de la lista, o nullptr si no se encuentra.
+     */
+    E* find(const E& element) {
         goToStart();
         while (!atEnd()) {
-            if (element == getElement()) {
-                return true;
-            }
+            if (element == current->next->element)
+                return &current->next->element;
             next();
         }
-        return false;
+        return nullptr;
+    }
+
+    /**
+     * @brief Busca el primer elemento cuya clave es igual a la indicada, sin construir un E.
+     * 
+     * Igual que find(), deja el cursor sobre el elemento encontrado o al final de la
+     * lista si no existe, de modo que puede eliminarse después con remove().
+     * 
+     * @tparam Q Tipo de la clave buscada; se compara con keyOf() de cada elemento.
+     * @param key Clave a buscar.
+     * @return Puntero al elemento dentro de la lista, o nullptr si no se encuentra.
+     */
+    template <typename Q>
+    E* findKey(const Q& key) {
+        goToStart();
+        while (!atEnd()) {
+            if (keyOf(key) == keyOf(current->next->element))
+                return &current->next->element;
+            next();
+        }
+        return nullptr;
     }
 
     /**
@@ -319,4 +488,24 @@ public:
             other->next();
         }
     }
+
+    /**
+     * @brief Ordena la lista en orden ascendente con merge sort.
+     *
+     * Reenlaza los nodos sin copiar elementos, en O(n log n). Es estable.
+     * El cursor queda al inicio.
+     */
+    void sort() {
+        if (size > 1) {
+            head->next = mergeSortNodes(head->next, size);
+            DNode<E>* previous = head;
+            for (DNode<E>* node = head->next; node != nullptr; node = node->next) {
+                node->previous = previous;
+                previous = node;
+            }
+            previous->next = tail;
+            tail->previous = previous;
+        }
+        current = head;
+    }
 };
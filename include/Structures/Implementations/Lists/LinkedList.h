@@ -12,8 +12,11 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "Structures/Abstract/List.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/Node.h"
+#include "Structures/Common/Sorting.h"
 
 using std::runtime_error;
 using std::cout;
@@ -33,6 +36,7 @@ private:
     int size;         ///< Número de elementos en la lista.
 
     Node<E>* freeNode; ///< Lista de nodos libres para reutilización.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
     /**
      * @brief Obtiene un nodo libre de la lista de nodos libres o crea uno nuevo si no hay disponibles.
@@ -41,15 +45,15 @@ private:
      * @param next Puntero al siguiente nodo (opcional).
      * @return Puntero al nodo recién asignado.
      */
-    Node<E>* getFreeNode(E element, Node<E>* next = nullptr) {
+    Node<E>* getFreeNode(E&& element, Node<E>* next = nullptr) {
         if (freeNode != nullptr) {
             Node<E>* temp = freeNode;
             freeNode = freeNode->next;
-            temp->element = element;
+            temp->element = std::move(element);
             temp->next = next;
             return temp;
         }
-        return new Node<E>(element, next);
+        return create<Node<E>>(resource, std::move(element), next);
     }
 
     /**
@@ -65,9 +69,11 @@ private:
 public:
     /**
      * @brief Constructor que inicializa una lista enlazada vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    LinkedList() {
-        current = head = tail = new Node<E>();
+    explicit LinkedList(MemoryResource* resource = defaultResource()) : resource(resource) {
+        current = head = tail = create<Node<E>>(resource);
         freeNode = nullptr;
         size = 0;
     }
@@ -77,21 +83,30 @@ public:
      */
     ~LinkedList() {
         clear();
-        delete head;
+        destroy(resource, head);
         while (freeNode != nullptr) {
             Node<E>* temp = freeNode;
             freeNode = freeNode->next;
-            delete temp;
+            destroy(resource, temp);
         }
     }
 
     /**
      * @brief Inserta un elemento en la posición actual.
      * 
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      */
-    void insert(E element) {
-        current->next = getFreeNode(element, current->next);
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la posición actual moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void insert(E&& element) {
+        current->next = getFreeNode(std::move(element), current->next);
         if (current == tail)
             tail = tail->next;
         size++;
@@ -100,10 +115,19 @@ public:
     /**
      * @brief Agrega un elemento al final de la lista.
      * 
-     * @param element Elemento a agregar.
+     * @param element Elemento a agregar, que se copia.
+     */
+    void append(const E& element) {
+        append(E(element));
+    }
+
+    /**
+     * @brief Agrega un elemento al final de la lista moviéndolo.
+     * 
+     * @param element Elemento a agregar, que queda en un estado válido pero no especificado.
      */
-    void append(E element) {
-        tail = tail->next = getFreeNode(element);
+    void append(E&& element) {
+        tail = tail->next = getFreeNode(std::move(element));
         size++;
     }
 
@@ -118,7 +142,7 @@ public:
             throw runtime_error("List is empty");
         if (current == tail)
             throw runtime_error("No current element.");
-        E result = current->next->element;
+        E result = std::move(current->next->element);
         Node<E>* temp = current->next;
         if (current->next == tail)
             tail = current;
@@ -142,6 +166,22 @@ public:
         return current->next->element;
     }
 
+    /**
+     * @brief Devuelve una referencia al elemento en una posición, sin copiarlo ni mover el cursor.
+     * 
+     * @param pos Posición del elemento.
+     * @return Referencia al elemento.
+     * @throw runtime_error Si la posición está fuera de los límites de la lista.
+     */
+    E& at(int pos) {
+        if (pos < 0 || pos >= size)
+            throw runtime_error("Index out of bounds.");
+        Node<E>* temp = head->next;
+        for (int i = 0; i < pos; i++)
+            temp = temp->next;
+        return temp->element;
+    }
+
     /**
      * @brief Limpia todos los elementos de la lista.
      */
@@ -245,6 +285,15 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Imprime los elementos de la lista.
      */
@@ -270,7 +319,7 @@ public:
      * @return Índice del elemento, o -1 si no se encuentra.
      * @throw runtime_error Si la posición de inicio está fuera de los límites.
      */
-    int indexOf(E element, int start = 0) {
+    int indexOf(const E& element, int start = 0) {
         if (start < 0 || start >= size)
             throw runtime_error("Index out of bounds.");
         Node<E>* temp = head;
@@ -290,7 +339,7 @@ public:
      * @param element Elemento a buscar.
      * @return true si el elemento está en la lista, false en caso contrario.
      */
-    bool contains(E element) {
+    bool contains(const E& element) {
         return indexOf(element, 0) != -1;
     }
 
@@ -347,14 +396,44 @@ public:
     /**
      * @brief Establece un nuevo valor para el elemento en la posición actual.
      * 
-     * @param element Nuevo valor a establecer.
+     * @param element Nuevo valor a establecer, que se copia.
      * @throw runtime_error Si la lista está vacía o no hay un elemento actual.
      */
-    void set(E element) {
+    void set(const E& element) {
         if (size == 0)
             throw runtime_error("List is empty");
         if (current == tail)
             throw runtime_error("No current element.");
         current->next->element = element;
     }
+
+    /**
+     * @brief Establece un nuevo valor para el elemento en la posición actual moviéndolo.
+     * 
+     * @param element Nuevo valor, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si la lista está vacía o no hay un elemento actual.
+     */
+    void set(E&& element) {
+        if (size == 0)
+            throw runtime_error("List is empty");
+        if (current == tail)
+            throw runtime_error("No current element.");
+        current->next->element = std::move(element);
+    }
+
+    /**
+     * @brief Ordena la lista en orden ascendente con merge sort.
+     *
+     * Reenlaza los nodos sin copiar elementos, en O(n log n). Es estable.
+     * El cursor queda al inicio.
+     */
+    void sort() {
+        if (size > 1) {
+            head->next = mergeSortNodes(head->next, size);
+            tail = head;
+            while (tail->next != nullptr)
+                tail = tail->next;
+        }
+        current = head;
+    }
 };
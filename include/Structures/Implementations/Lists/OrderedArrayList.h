@@ -10,51 +10,93 @@
 
 #pragma once
 
+#include "Structures/Common/Compare.h"
 #include "Structures/Implementations/Lists/ArrayList.h"
 
 /**
  * @brief Clase que implementa una lista ordenada utilizando composición de un ArrayList.
  *
- * Esta clase mantiene los elementos en orden ascendente. Para insertar un nuevo elemento,
- * se recorre la lista hasta encontrar la posición correcta de acuerdo al orden, y se inserta allí.
+ * Esta clase mantiene los elementos en orden ascendente según el comparador. Para
+ * insertar un nuevo elemento, se ubica la posición correcta mediante búsqueda binaria
+ * sobre la lista subyacente (cuyo acceso por posición es O(1)) y se inserta allí.
  *
  * @tparam E Tipo de dato almacenado en la lista.
+ * @tparam Compare Comparador de tres vías de los elementos (ver Compare.h); por defecto, su orden natural.
  */
-template <typename E>
+template <typename E, typename Compare = DefaultCompare>
 class OrderedArrayList : public List<E> {
 private:
-    List<E>* data; ///< Puntero a la lista subyacente que almacena los elementos.
+    ArrayList<E>* data; ///< Puntero a la lista subyacente que almacena los elementos.
+    Compare comparator; ///< Comparador de tres vías de los elementos.
+    MemoryResource* resource; ///< Recurso del que se obtienen la lista subyacente y su arreglo.
+
+    /**
+     * @brief Búsqueda binaria de la primera posición que cumple el criterio indicado.
+     *
+     * Si upper es false, busca el primer elemento que no es menor que element
+     * (lower bound); si es true, el primer elemento mayor que element (upper bound).
+     * Los elementos se leen por referencia con at(), sin copiarlos ni mover el cursor.
+     *
+     * @param element Elemento de referencia.
+     * @param upper Indica si se busca el límite superior.
+     * @return La posición encontrada, o el tamaño de la lista si no existe.
+     */
+    int bound(const E& element, bool upper) {
+        int low = 0;
+        int high = data->getSize();
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            int order = comparator(data->at(mid), element);
+            bool goRight = upper ? order <= 0 : order < 0;
+            if (goRight)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
 
 public:
     /**
      * @brief Constructor que inicializa la lista ordenada con una capacidad máxima.
      *
      * @param max Capacidad máxima inicial para la lista. Por defecto, DEFAULT_MAX.
+     * @param comparator Comparador de los elementos; por defecto, su orden natural.
+     * @param resource Recurso del que se obtiene la memoria de la lista (ver MemoryResource.h).
      */
-    OrderedArrayList(int max = DEFAULT_MAX) {
-        data = new ArrayList<E>(max);
+    OrderedArrayList(int max = DEFAULT_MAX, const Compare& comparator = Compare(),
+                     MemoryResource* resource = defaultResource())
+        : comparator(comparator), resource(resource) {
+        data = create<ArrayList<E>>(resource, max, resource);
     }
 
     /**
      * @brief Destructor que libera la memoria utilizada por la lista.
      */
     ~OrderedArrayList() {
-        delete data;
+        destroy(resource, data);
     }
 
     /**
      * @brief Inserta un elemento en la posición correcta para mantener el orden ascendente.
      *
-     * Se recorre la lista desde el inicio hasta encontrar el lugar en el que el elemento
-     * es menor que o igual al elemento actual, y se inserta en esa posición.
+     * La posición se ubica con búsqueda binaria después de los elementos iguales ya
+     * existentes, y se inserta en esa posición.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      */
-    void insert(E element) {
-        data->goToStart();
-        while (!data->atEnd() && element >= data->getElement())
-            data->next();
-        data->insert(element);
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en orden ascendente moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void insert(E&& element) {
+        data->goToPos(bound(element, true));
+        data->insert(std::move(element));
     }
 
     /**
@@ -62,12 +104,89 @@ public:
      *
      * Este método es equivalente a llamar a insert, ya que la lista siempre se mantiene ordenada.
      *
-     * @param element Elemento a agregar.
+     * @param element Elemento a agregar, que se copia.
      */
-    void append(E element) {
+    void append(const E& element) {
         insert(element);
     }
 
+    /**
+     * @brief Agrega un elemento a la lista ordenada moviéndolo.
+     *
+     * @param element Elemento a agregar, que queda en un estado válido pero no especificado.
+     */
+    void append(E&& element) {
+        insert(std::move(element));
+    }
+
+    /**
+     * @brief Inserta un lote de elementos ya ordenados en una sola pasada.
+     *
+     * Mezcla el lote con los elementos actuales en una nueva lista con la capacidad
+     * exacta, en O(n + m), en lugar de realizar m inserciones con desplazamiento.
+     * El cursor queda al inicio.
+     *
+     * @param batch Arreglo con los elementos a insertar, en orden ascendente.
+     * @param count Cantidad de elementos del lote.
+     * @throws runtime_error Si la cantidad es negativa o el lote no está ordenado.
+     */
+    void insertSorted(const E* batch, int count) {
+        if (count < 0)
+            throw runtime_error("Invalid batch size.");
+        for (int i = 1; i < count; i++)
+            if (comparator(batch[i], batch[i - 1]) < 0)
+                throw runtime_error("Batch is not sorted.");
+        int total = data->getSize() + count;
+        ArrayList<E>* merged = create<ArrayList<E>>(resource, total > 0 ? total : 1, resource);
+        data->goToStart();
+        int j = 0;
+        while (!data->atEnd() || j < count) {
+            if (j == count || (!data->atEnd() && comparator(batch[j], data->getElement()) >= 0)) {
+                merged->append(data->getElement());
+                data->next();
+            } else {
+                merged->append(batch[j++]);
+            }
+        }
+        destroy(resource, data);
+        data = merged;
+        data->goToStart();
+    }
+
+    /**
+     * @brief Obtiene la primera posición cuyo elemento no es menor que el indicado.
+     *
+     * @param element Elemento de referencia.
+     * @return Índice del primer elemento mayor o igual, o el tamaño si no existe.
+     */
+    int lowerBound(const E& element) {
+        return bound(element, false);
+    }
+
+    /**
+     * @brief Obtiene la primera posición cuyo elemento es mayor que el indicado.
+     *
+     * @param element Elemento de referencia.
+     * @return Índice del primer elemento mayor, o el tamaño si no existe.
+     */
+    int upperBound(const E& element) {
+        return bound(element, true);
+    }
+
+    /**
+     * @brief Obtiene el rango de posiciones que contienen elementos iguales al indicado.
+     *
+     * El rango es semiabierto: [first, last).
+     *
+     * @param element Elemento a buscar.
+     * @param first Puntero donde se almacena el inicio del rango.
+     * @param last Puntero donde se almacena el final del rango.
+     */
+    void equalRange(const E& element, int* first, int* last) {
+        *first = lowerBound(element);
+        *last = upperBound(element);
+    }
+
     /**
      * @brief Elimina y retorna el elemento en la posición actual de la lista.
      *
@@ -86,6 +205,17 @@ public:
         return data->getElement();
     }
 
+    /**
+     * @brief Obtiene una referencia al elemento en una posición, sin copiarlo ni mover el cursor.
+     *
+     * @param pos Posición del elemento.
+     * @return Referencia al elemento.
+     * @throws runtime_error Si la posición está fuera de los límites.
+     */
+    E& at(int pos) {
+        return data->at(pos);
+    }
+
     /**
      * @brief Elimina todos los elementos de la lista.
      */
@@ -167,24 +297,43 @@ public:
     }
 
     /**
-     * @brief Busca el índice de un elemento en la lista a partir de una posición inicial.
+     * @brief Obtiene el recurso del que se obtiene la memoria de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Busca el índice de un elemento mediante búsqueda binaria.
      *
      * @param element Elemento a buscar.
      * @param start Posición desde la cual iniciar la búsqueda (por defecto 0).
-     * @return El índice del elemento si se encuentra; de lo contrario, -1.
+     * @return El índice de la primera ocurrencia a partir de start; -1 si no existe.
+     * @throws runtime_error Si la posición de inicio está fuera de los límites.
      */
-    int indexOf(E element, int start = 0) {
-        return data->indexOf(element, start);
+    int indexOf(const E& element, int start = 0) {
+        if (start < 0 || start >= data->getSize())
+            throw runtime_error("Index out of bounds.");
+        int index = bound(element, false);
+        if (index < start)
+            index = start;
+        if (index < data->getSize()) {
+            if (comparator(element, data->at(index)) == 0)
+                return index;
+        }
+        return -1;
     }
 
     /**
-     * @brief Determina si la lista contiene un elemento específico.
+     * @brief Determina si la lista contiene un elemento mediante búsqueda binaria.
      *
      * @param element Elemento a buscar.
      * @return true si el elemento está presente, false en caso contrario.
      */
-    bool contains(E element) {
-        return data->contains(element);
+    bool contains(const E& element) {
+        return data->getSize() > 0 && indexOf(element, 0) != -1;
     }
 
     /**
@@ -216,12 +365,21 @@ public:
     /**
      * @brief Modifica el elemento en la posición actual de la lista.
      *
-     * @param element Nuevo valor a asignar.
+     * @param element Nuevo valor a asignar, que se copia.
      */
-    void set(E element) {
+    void set(const E& element) {
         data->set(element);
     }
 
+    /**
+     * @brief Modifica el elemento en la posición actual moviendo el nuevo valor.
+     *
+     * @param element Nuevo valor, que queda en un estado válido pero no especificado.
+     */
+    void set(E&& element) {
+        data->set(std::move(element));
+    }
+
     /**
      * @brief Imprime los elementos de la lista en la consola.
      */
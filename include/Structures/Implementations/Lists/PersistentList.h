@@ -0,0 +1,356 @@
+/**
+ * @file PersistentList.h
+ * @brief Implementación de una lista persistente (inmutable) con estructura compartida.
+ *
+ * Cada modificación retorna una nueva versión de la lista que comparte con la anterior
+ * todos los nodos que no cambiaron, por lo que copiar una versión es O(1).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Common/MemoryResource.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+using std::shared_ptr;
+
+/**
+ * @brief Lista persistente basada en un trie de 32 ramas con cola (vector persistente).
+ *
+ * Los elementos se guardan en hojas de 32 elementos; los nodos internos tienen 32 hijos,
+ * por lo que la altura es log32(n). Los últimos elementos se mantienen en una hoja aparte
+ * (la cola) para que agregar al final no tenga que recorrer el árbol en 31 de cada 32 casos.
+ *
+ * Ninguna operación modifica la lista: append(), set() y removeLast() retornan una nueva
+ * versión creando sólo los O(log32 n) nodos del camino modificado. Copiar una lista es O(1)
+ * y ambas copias pueden leerse desde varios hilos sin sincronización, ya que los nodos
+ * nunca cambian después de construirse. Publicar una nueva versión para otros hilos sí
+ * requiere sincronización (por ejemplo, std::atomic_store sobre un shared_ptr o un mutex).
+ *
+ * Los nodos se obtienen del recurso de memoria de la lista (ver MemoryResource.h), que
+ * heredan todas las versiones derivadas de ella y que debe vivir más que la última.
+ *
+ * No se implementa la variante relajada (RRB) que permite concatenar e insertar en medio
+ * en O(log n); sólo se modifica por posición y por el final.
+ *
+ * @tparam E Tipo de los elementos almacenados en la lista.
+ */
+template <typename E>
+class PersistentList {
+private:
+    static const int BITS = 5;             ///< Bits del índice que consume cada nivel.
+    static const int WIDTH = 1 << BITS;    ///< Cantidad de ramas por nodo.
+    static const int MASK = WIDTH - 1;     ///< Máscara para obtener la rama de un nivel.
+
+    /**
+     * @brief Nodo base del trie.
+     */
+    struct Node {
+        virtual ~Node() {}
+    };
+
+    /**
+     * @brief Nodo interno: apunta a WIDTH subárboles.
+     */
+    struct Branch : public Node {
+        shared_ptr<const Node> children[WIDTH];
+    };
+
+    /**
+     * @brief Hoja: almacena hasta WIDTH elementos.
+     */
+    struct Leaf : public Node {
+        E elements[WIDTH];
+    };
+
+    shared_ptr<const Branch> root; ///< Raíz del trie (sin incluir la cola).
+    shared_ptr<const Leaf> tail;   ///< Hoja con los últimos elementos.
+    int size;                      ///< Número de elementos de la lista.
+    int shift;                     ///< Bits a desplazar en la raíz (BITS * altura).
+    MemoryResource* resource;      ///< Recurso del que se obtienen los nodos.
+
+    /**
+     * @brief Constructor interno a partir de sus componentes.
+     */
+    PersistentList(shared_ptr<const Branch> root, shared_ptr<const Leaf> tail, int size, int shift,
+                   MemoryResource* resource)
+        : root(root), tail(tail), size(size), shift(shift), resource(resource) {}
+
+    /**
+     * @brief Crea un nodo con memoria del recurso de la lista.
+     *
+     * @param args Argumentos del constructor del nodo.
+     * @return El nodo creado.
+     */
+    template <typename T, typename... Args>
+    shared_ptr<T> make(Args&&... args) const {
+        return std::allocate_shared<T>(ResourceAllocator<T>(resource), std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Obtiene la posición del primer elemento guardado en la cola.
+     *
+     * @return Índice del primer elemento de la cola.
+     */
+    int tailOffset() const {
+        return size < WIDTH ? 0 : ((size - 1) >> BITS) << BITS;
+    }
+
+    /**
+     * @brief Obtiene la hoja que contiene una posición.
+     *
+     * @param index Posición buscada.
+     * @return Puntero a la hoja.
+     */
+    const Leaf* leafFor(int index) const {
+        if (index >= tailOffset())
+            return tail.get();
+        const Node* node = root.get();
+        for (int level = shift; level > 0; level -= BITS)
+            node = static_cast<const Branch*>(node)->children[(index >> level) & MASK].get();
+        return static_cast<const Leaf*>(node);
+    }
+
+    /**
+     * @brief Crea una cadena de nodos internos que termina en la hoja indicada.
+     *
+     * @param level Nivel en el que se crea el primer nodo.
+     * @param leaf Hoja que queda al final de la cadena.
+     * @return La cadena creada.
+     */
+    shared_ptr<const Node> newPath(int level, shared_ptr<const Node> leaf) const {
+        if (level == 0)
+            return leaf;
+        shared_ptr<Branch> branch = make<Branch>();
+        branch->children[0] = newPath(level - BITS, leaf);
+        return branch;
+    }
+
+    /**
+     * @brief Agrega la cola llena al trie copiando el camino hasta su posición.
+     *
+     * @param level Nivel del nodo actual.
+     * @param parent Nodo actual.
+     * @param leaf Hoja a agregar.
+     * @return Copia del nodo actual con la hoja agregada.
+     */
+    shared_ptr<const Branch> pushTail(int level, const Branch* parent, shared_ptr<const Node> leaf) const {
+        shared_ptr<Branch> copy = make<Branch>(*parent);
+        int index = ((size - 1) >> level) & MASK;
+        if (level == BITS) {
+            copy->children[index] = leaf;
+        } else {
+            const Node* child = parent->children[index].get();
+            if (child != nullptr)
+                copy->children[index] = pushTail(level - BITS, static_cast<const Branch*>(child), leaf);
+            else
+                copy->children[index] = newPath(level - BITS, leaf);
+        }
+        return copy;
+    }
+
+    /**
+     * @brief Reemplaza un elemento del trie copiando el camino hasta su hoja.
+     *
+     * @param level Nivel del nodo actual.
+     * @param node Nodo actual.
+     * @param index Posición del elemento.
+     * @param element Nuevo valor.
+     * @return Copia del nodo actual con el elemento reemplazado.
+     */
+    shared_ptr<const Node> assoc(int level, const Node* node, int index, const E& element) const {
+        if (level == 0) {
+            shared_ptr<Leaf> copy = make<Leaf>(*static_cast<const Leaf*>(node));
+            copy->elements[index & MASK] = element;
+            return copy;
+        }
+        const Branch* branch = static_cast<const Branch*>(node);
+        shared_ptr<Branch> copy = make<Branch>(*branch);
+        int child = (index >> level) & MASK;
+        copy->children[child] = assoc(level - BITS, branch->children[child].get(), index, element);
+        return copy;
+    }
+
+    /**
+     * @brief Quita del trie la hoja de más a la derecha copiando el camino hasta ella.
+     *
+     * @param level Nivel del nodo actual.
+     * @param node Nodo actual.
+     * @return Copia del nodo sin la hoja, o nullptr si el nodo queda vacío.
+     */
+    shared_ptr<const Branch> popTail(int level, const Branch* node) const {
+        int index = ((size - 2) >> level) & MASK;
+        if (level > BITS) {
+            shared_ptr<const Branch> child =
+                popTail(level - BITS, static_cast<const Branch*>(node->children[index].get()));
+            if (child == nullptr && index == 0)
+                return nullptr;
+            shared_ptr<Branch> copy = make<Branch>(*node);
+            copy->children[index] = child;
+            return copy;
+        }
+        if (index == 0)
+            return nullptr;
+        shared_ptr<Branch> copy = make<Branch>(*node);
+        copy->children[index] = nullptr;
+        return copy;
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto que crea una lista vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos de esta versión y de las derivadas.
+     */
+    explicit PersistentList(MemoryResource* resource = defaultResource())
+        : size(0), shift(BITS), resource(resource) {
+        root = make<Branch>();
+        tail = make<Leaf>();
+    }
+
+    /**
+     * @brief Obtiene el elemento en una posición.
+     *
+     * @param index Posición del elemento.
+     * @return El elemento en la posición indicada.
+     * @throws runtime_error Si la posición está fuera de los límites.
+     */
+    E get(int index) const {
+        if (index < 0 || index >= size)
+            throw runtime_error("Index out of bounds.");
+        return leafFor(index)->elements[index & MASK];
+    }
+
+    /**
+     * @brief Retorna una nueva versión con el elemento agregado al final.
+     *
+     * @param element Elemento a agregar.
+     * @return La nueva versión de la lista.
+     */
+    PersistentList<E> append(const E& element) const {
+        int inTail = size - tailOffset();
+        if (inTail < WIDTH) {
+            shared_ptr<Leaf> newTail = make<Leaf>();
+            for (int i = 0; i < inTail; i++)
+                newTail->elements[i] = tail->elements[i];
+            newTail->elements[inTail] = element;
+            return PersistentList<E>(root, newTail, size + 1, shift, resource);
+        }
+        shared_ptr<const Branch> newRoot;
+        int newShift = shift;
+        if ((size >> BITS) > (1 << shift)) {
+            shared_ptr<Branch> branch = make<Branch>();
+            branch->children[0] = root;
+            branch->children[1] = newPath(shift, tail);
+            newRoot = branch;
+            newShift += BITS;
+        } else {
+            newRoot = pushTail(shift, root.get(), tail);
+        }
+        shared_ptr<Leaf> newTail = make<Leaf>();
+        newTail->elements[0] = element;
+        return PersistentList<E>(newRoot, newTail, size + 1, newShift, resource);
+    }
+
+    /**
+     * @brief Retorna una nueva versión con el elemento de una posición reemplazado.
+     *
+     * @param index Posición del elemento.
+     * @param element Nuevo valor.
+     * @return La nueva versión de la lista.
+     * @throws runtime_error Si la posición está fuera de los límites.
+     */
+    PersistentList<E> set(int index, const E& element) const {
+        if (index < 0 || index >= size)
+            throw runtime_error("Index out of bounds.");
+        if (index >= tailOffset()) {
+            shared_ptr<Leaf> newTail = make<Leaf>(*tail);
+            newTail->elements[index & MASK] = element;
+            return PersistentList<E>(root, newTail, size, shift, resource);
+        }
+        shared_ptr<const Branch> newRoot =
+            std::static_pointer_cast<const Branch>(assoc(shift, root.get(), index, element));
+        return PersistentList<E>(newRoot, tail, size, shift, resource);
+    }
+
+    /**
+     * @brief Retorna una nueva versión sin el último elemento.
+     *
+     * @return La nueva versión de la lista.
+     * @throws runtime_error Si la lista está vacía.
+     */
+    PersistentList<E> removeLast() const {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        if (size == 1)
+            return PersistentList<E>(resource);
+        if (size - tailOffset() > 1)
+            return PersistentList<E>(root, tail, size - 1, shift, resource);
+        shared_ptr<const Leaf> newTail = make<Leaf>(*leafFor(size - 2));
+        shared_ptr<const Branch> newRoot = popTail(shift, root.get());
+        int newShift = shift;
+        if (newRoot == nullptr)
+            newRoot = make<Branch>();
+        if (shift > BITS && newRoot->children[1] == nullptr) {
+            newRoot = std::static_pointer_cast<const Branch>(newRoot->children[0]);
+            newShift -= BITS;
+        }
+        return PersistentList<E>(newRoot, newTail, size - 1, newShift, resource);
+    }
+
+    /**
+     * @brief Obtiene el último elemento de la lista.
+     *
+     * @return El último elemento.
+     * @throws runtime_error Si la lista está vacía.
+     */
+    E last() const {
+        if (size == 0)
+            throw runtime_error("List is empty.");
+        return get(size - 1);
+    }
+
+    /**
+     * @brief Retorna el número de elementos en la lista.
+     *
+     * @return El tamaño de la lista.
+     */
+    int getSize() const {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la lista.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si la lista está vacía.
+     *
+     * @return true si la lista no tiene elementos, false en caso contrario.
+     */
+    bool isEmpty() const {
+        return size == 0;
+    }
+
+    /**
+     * @brief Imprime el contenido de la lista.
+     */
+    void print() const {
+        cout << "[ ";
+        for (int i = 0; i < size; i++)
+            cout << get(i) << " ";
+        cout << "]" << endl;
+    }
+};
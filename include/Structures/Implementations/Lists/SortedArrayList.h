@@ -10,41 +10,57 @@
 
 #pragma once
 
+#include "Structures/Common/Compare.h"
 #include "Structures/Implementations/Lists/ArrayList.h"
 
 /**
  * @brief Clase que implementa una lista ordenada mediante herencia,
  *        especializando la clase ArrayList.
  *
- * Esta clase mantiene los elementos en orden ascendente. La inserción
- * se realiza recorriendo la lista hasta encontrar la posición correcta,
- * garantizando que el arreglo se mantenga ordenado.
+ * Esta clase mantiene los elementos en orden ascendente según el comparador. Como el
+ * arreglo siempre está ordenado, la posición de inserción y las búsquedas se resuelven
+ * con búsqueda binaria en O(log n) comparaciones en lugar de recorrer la lista.
  *
  * @tparam E Tipo de dato almacenado en la lista.
+ * @tparam Compare Comparador de tres vías de los elementos (ver Compare.h); por defecto, su orden natural.
  */
-template <typename E>
+template <typename E, typename Compare = DefaultCompare>
 class SortedArrayList : public ArrayList<E> {
+private:
+    Compare comparator; ///< Comparador de tres vías de los elementos.
+
 public:
     /**
      * @brief Constructor que inicializa la lista ordenada con una capacidad máxima.
      *
      * @param max Capacidad máxima inicial para la lista. Por defecto, DEFAULT_MAX.
+     * @param comparator Comparador de los elementos; por defecto, su orden natural.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
      */
-    SortedArrayList(int max = DEFAULT_MAX) : ArrayList<E>(max) {}
+    SortedArrayList(int max = DEFAULT_MAX, const Compare& comparator = Compare(),
+                    MemoryResource* resource = defaultResource())
+        : ArrayList<E>(max, resource), comparator(comparator) {}
 
     /**
      * @brief Inserta un elemento en la posición adecuada para mantener el orden ascendente.
      *
-     * Recorre la lista desde el inicio hasta encontrar la posición en la que el nuevo elemento
-     * es menor que el elemento actual, y lo inserta en ese punto.
+     * La posición se obtiene con upperBound(), por lo que los elementos iguales se
+     * insertan después de los ya existentes. El cursor queda sobre el elemento insertado.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      */
-    void insert(E element) {
-        ArrayList<E>::goToStart();
-        while (!ArrayList<E>::atEnd() && element >= ArrayList<E>::getElement())
-            ArrayList<E>::next();
-        ArrayList<E>::insert(element);
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en orden ascendente moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void insert(E&& element) {
+        this->pos = upperBound(element);
+        ArrayList<E>::insert(std::move(element));
     }
 
     /**
@@ -53,9 +69,157 @@ public:
      * Este método es equivalente a llamar a insert(), ya que la lista
      * se mantiene ordenada automáticamente.
      *
-     * @param element Elemento a agregar.
+     * @param element Elemento a agregar, que se copia.
      */
-    void append(E element) {
+    void append(const E& element) {
         insert(element);
     }
+
+    /**
+     * @brief Agrega un elemento a la lista ordenada moviéndolo.
+     *
+     * @param element Elemento a agregar, que queda en un estado válido pero no especificado.
+     */
+    void append(E&& element) {
+        insert(std::move(element));
+    }
+
+    /**
+     * @brief Inserta un lote de elementos ya ordenados en una sola pasada.
+     *
+     * Reserva la capacidad necesaria una sola vez y mezcla el lote con los elementos
+     * existentes desde el final del arreglo hacia el inicio, por lo que el costo es
+     * O(n + m) en lugar de m inserciones con desplazamiento. El cursor queda al inicio.
+     *
+     * @param batch Arreglo con los elementos a insertar, en orden ascendente.
+     * @param count Cantidad de elementos del lote.
+     * @throws runtime_error Si la cantidad es negativa o el lote no está ordenado.
+     */
+    void insertSorted(const E* batch, int count) {
+        if (count < 0)
+            throw runtime_error("Invalid batch size.");
+        for (int i = 1; i < count; i++)
+            if (comparator(batch[i], batch[i - 1]) < 0)
+                throw runtime_error("Batch is not sorted.");
+        if (this->size + count > this->max)
+            this->reserve(this->size + count > this->max * 2 ? this->size + count : this->max * 2);
+        int i = this->size - 1;
+        int j = count - 1;
+        int k = this->size + count - 1;
+        while (j >= 0) {
+            if (i >= 0 && comparator(batch[j], this->elements[i]) < 0)
+                this->elements[k--] = std::move(this->elements[i--]);
+            else
+                this->elements[k--] = batch[j--];
+        }
+        this->size += count;
+        this->pos = 0;
+    }
+
+    /**
+     * @brief Reemplaza el contenido de la lista por el de un archivo guardado con save().
+     *
+     * Además de lo que valida ArrayList::load, verifica que los elementos estén en orden
+     * ascendente antes de reemplazar el contenido.
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error Si no se puede abrir el archivo, no guarda una secuencia de E o
+     *        los elementos no están ordenados.
+     */
+    void load(const string& path) {
+        SnapshotFile file(path, SNAPSHOT_SEQUENCE, SnapshotCodec<E>::code(), 0, true);
+        typename SnapshotCodec<E>::Column column = file.column<E>();
+        column.validate();
+        int count = file.getCount();
+        for (int i = 1; i < count; i++) {
+            bool unsorted = NaturalOrder<Compare>::value ? column.greater(i - 1, column[i])
+                                                         : comparator(column[i - 1], column[i]) > 0;
+            if (unsorted)
+                throw runtime_error("Invalid snapshot.");
+        }
+        this->assignColumn(column, count);
+    }
+
+    /**
+     * @brief Obtiene la primera posición cuyo elemento no es menor que el indicado.
+     *
+     * @param element Elemento de referencia.
+     * @return Índice del primer elemento mayor o igual, o el tamaño si no existe.
+     */
+    int lowerBound(const E& element) {
+        int low = 0;
+        int high = this->size;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (comparator(this->elements[mid], element) < 0)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return low;
+    }
+
+    /**
+     * @brief Obtiene la primera posición cuyo elemento es mayor que el indicado.
+     *
+     * @param element Elemento de referencia.
+     * @return Índice del primer elemento mayor, o el tamaño si no existe.
+     */
+    int upperBound(const E& element) {
+        int low = 0;
+        int high = this->size;
+        while (low < high) {
+            int mid = low + (high - low) / 2;
+            if (comparator(element, this->elements[mid]) < 0)
+                high = mid;
+            else
+                low = mid + 1;
+        }
+        return low;
+    }
+
+    /**
+     * @brief Obtiene el rango de posiciones que contienen elementos iguales al indicado.
+     *
+     * El rango es semiabierto: [first, last). Si el elemento no existe, ambos
+     * valores coinciden con la posición donde se insertaría.
+     *
+     * @param element Elemento a buscar.
+     * @param first Puntero donde se almacena el inicio del rango.
+     * @param last Puntero donde se almacena el final del rango.
+     */
+    void equalRange(const E& element, int* first, int* last) {
+        *first = lowerBound(element);
+        *last = upperBound(element);
+    }
+
+    /**
+     * @brief Busca el índice de un elemento mediante búsqueda binaria.
+     *
+     * @param element Elemento a buscar.
+     * @param start Posición desde la cual iniciar la búsqueda (por defecto 0).
+     * @return El índice de la primera ocurrencia a partir de start; -1 si no existe.
+     * @throws runtime_error Si la posición de inicio está fuera de los límites.
+     */
+    int indexOf(const E& element, int start = 0) {
+        if (start < 0 || start >= this->size)
+            throw runtime_error("Index out of bounds.");
+        int index = lowerBound(element);
+        if (index < start)
+            index = start;
+        if (index < this->size && comparator(element, this->elements[index]) == 0)
+            return index;
+        return -1;
+    }
+
+    /**
+     * @brief Determina si la lista contiene un elemento mediante búsqueda binaria.
+     *
+     * @param element Elemento a buscar.
+     * @return true si el elemento está presente, false en caso contrario.
+     */
+    bool contains(const E& element) {
+        int index = lowerBound(element);
+        return index < this->size && comparator(element, this->elements[index]) == 0;
+    }
 };
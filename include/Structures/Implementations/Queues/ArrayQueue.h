@@ -11,9 +11,15 @@
 
 #pragma once
 
+#include <cstring>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 #include "Structures/Abstract/Queue.h"
+#include "Structures/Common/MemoryResource.h"
+
+#define DEFAULT_MAX 1024
 
 using std::runtime_error;
 using std::cout;
@@ -24,6 +30,11 @@ using std::endl;
  * 
  * Esta clase proporciona operaciones para insertar, eliminar y consultar elementos
  * de una cola basada en un arreglo circular de tamaño fijo.
+ *
+ * Si se construye en modo creciente, en lugar de lanzar una excepción al llenarse duplica su
+ * capacidad (O(1) amortizado), y la reduce a la mitad cuando queda a un cuarto de su capacidad,
+ * sin bajar nunca de la capacidad inicial. Al cambiar de capacidad el arreglo circular se
+ * desenrolla: los elementos quedan desde la posición 0 del nuevo arreglo.
  * 
  * @tparam E Tipo de dato almacenado en la cola.
  */
@@ -31,44 +42,111 @@ template <typename E>
 class ArrayQueue : public Queue<E> {
 private:
     E* elements; ///< Arreglo dinámico para almacenar los elementos de la cola.
-    int front;   ///< Índice del primer elemento en la cola.
-    int back;    ///< Índice del último elemento insertado en la cola.
+    int head;    ///< Índice del primer elemento en la cola.
+    int tail;    ///< Índice del último elemento insertado en la cola.
     int size;    ///< Número actual de elementos en la cola.
     int max;     ///< Capacidad máxima de la cola.
+    int initial; ///< Capacidad inicial, por debajo de la cual no se reduce el arreglo.
+    bool growable; ///< Indica si la cola crece en lugar de llenarse.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
+
+    /**
+     * @brief Mueve count elementos contiguos de un arreglo a otro.
+     */
+    static void moveElements(E* destination, E* source, int count) {
+        if (std::is_trivially_copyable<E>::value)
+            memcpy((void*)destination, (const void*)source, sizeof(E) * count);
+        else
+            for (int i = 0; i < count; i++)
+                destination[i] = std::move(source[i]);
+    }
+
+    /**
+     * @brief Cambia la capacidad del arreglo, desenrollando el arreglo circular.
+     *
+     * Los elementos se mueven en a lo sumo dos tramos: de head al final del arreglo
+     * y, si la cola da la vuelta, del inicio del arreglo hasta tail.
+     *
+     * @param newMax Nueva capacidad, mayor que la cantidad de elementos.
+     */
+    void resize(int newMax) {
+        E* newElements = createArray<E>(resource, newMax);
+        int firstPart = size < max - head ? size : max - head;
+        moveElements(newElements, elements + head, firstPart);
+        moveElements(newElements + firstPart, elements, size - firstPart);
+        destroyArray(resource, elements, max);
+        elements = newElements;
+        max = newMax;
+        head = 0;
+        tail = size;
+    }
+
+    /**
+     * @brief Prepara espacio para un elemento más, creciendo o lanzando una excepción.
+     */
+    void ensureSpace() {
+        if (size == max) {
+            if (!growable)
+                throw runtime_error("Queue is full.");
+            resize(max * 2);
+        }
+    }
+
+    /**
+     * @brief Reduce la capacidad si la cola creciente quedó a un cuarto de su capacidad.
+     */
+    void shrinkIfSparse() {
+        if (growable && max > initial && size <= max / 4)
+            resize(max / 2 > initial ? max / 2 : initial);
+    }
 
 public:
     /**
      * @brief Constructor de la cola con tamaño máximo especificado.
      * 
      * @param max Capacidad máxima de la cola (por defecto DEFAULT_MAX).
+     * @param growable Si es true, la capacidad crece y se reduce según sea necesario.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
      * @throw runtime_error si el tamaño máximo es menor que 1.
      */
-    ArrayQueue(int max = DEFAULT_MAX) {
+    ArrayQueue(int max = DEFAULT_MAX, bool growable = false, MemoryResource* resource = defaultResource())
+        : resource(resource) {
         if (max < 1)
             throw runtime_error("Invalid max size.");
-        elements = new E[max];
-        size = back = front = 0;
+        elements = createArray<E>(resource, max);
+        size = tail = head = 0;
         this->max = max;
+        initial = max;
+        this->growable = growable;
     }
 
     /**
      * @brief Destructor que libera la memoria utilizada por la cola.
      */
     ~ArrayQueue() {
-        delete[] elements;
+        destroyArray(resource, elements, max);
     }
 
     /**
      * @brief Inserta un elemento al final de la cola.
      * 
-     * @param element Elemento a insertar.
-     * @throw runtime_error si la cola está llena.
-     */
-    void enqueue(E element) {
-        if (size == max)
-            throw runtime_error("Queue is full.");
-        elements[back] = element;
-        back = (back + 1) % max;
+     * @param element Elemento a insertar, que se copia.
+     * @throw runtime_error si la cola está llena y no es creciente.
+     */
+    void enqueue(const E& element) {
+        enqueue(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si la cola está llena y no es creciente.
+     */
+    void enqueue(E&& element) {
+        ensureSpace();
+        elements[tail] = std::move(element);
+        tail = (tail + 1) % max;
         size++;
     }
 
@@ -81,9 +159,11 @@ public:
     E dequeue() {
         if (size == 0)
             throw runtime_error("Queue is empty.");
-        front = (front + 1) % max;
+        E result = std::move(elements[head]);
+        head = (head + 1) % max;
         size--;
-        return elements[(front + max - 1) % max];
+        shrinkIfSparse();
+        return result;
     }
 
     /**
@@ -95,14 +175,28 @@ public:
     E frontValue() {
         if (size == 0)
             throw runtime_error("Queue is empty.");
-        return elements[front];
+        return elements[head];
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento en el frente de la cola, sin copiarlo.
+     * 
+     * @return Referencia al elemento en el frente de la cola.
+     * @throw runtime_error si la cola está vacía.
+     */
+    E& front() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[head];
     }
 
     /**
      * @brief Elimina todos los elementos de la cola.
      */
     void clear() {
-        size = back = front = 0;
+        size = tail = head = 0;
+        if (growable && max > initial)
+            resize(initial);
     }
 
     /**
@@ -123,12 +217,93 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Retorna la capacidad actual de la cola.
+     *
+     * @return La cantidad de elementos que caben sin crecer.
+     */
+    int getCapacity() {
+        return max;
+    }
+
+    /**
+     * @brief Inserta un elemento al frente de la cola.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @throw runtime_error si la cola está llena y no es creciente.
+     */
+    void enqueueFront(const E& element) {
+        enqueueFront(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al frente de la cola moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si la cola está llena y no es creciente.
+     */
+    void enqueueFront(E&& element) {
+        ensureSpace();
+        head = (head + max - 1) % max;
+        elements[head] = std::move(element);
+        size++;
+    }
+
+    /**
+     * @brief Elimina y retorna el elemento al final de la cola.
+     *
+     * @return Elemento eliminado del final de la cola.
+     * @throw runtime_error si la cola está vacía.
+     */
+    E dequeueBack() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        tail = (tail + max - 1) % max;
+        E result = std::move(elements[tail]);
+        size--;
+        shrinkIfSparse();
+        return result;
+    }
+
+    /**
+     * @brief Retorna el elemento al final de la cola sin eliminarlo.
+     *
+     * @return Elemento en el final de la cola.
+     * @throw runtime_error si la cola está vacía.
+     */
+    E backValue() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[(tail + max - 1) % max];
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento al final de la cola, sin copiarlo.
+     *
+     * @return Referencia al elemento en el final de la cola.
+     * @throw runtime_error si la cola está vacía.
+     */
+    E& back() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[(tail + max - 1) % max];
+    }
+
     /**
      * @brief Imprime el contenido de la cola.
      */
     void print() {
         cout << "[ ";
-        int pos = front;
+        int pos = head;
         for (int i = 0; i < size; i++) {
             cout << elements[pos] << " ";
             pos = (pos + 1) % max;
@@ -0,0 +1,218 @@
+/**
+ * @file BucketPriorityQueue.h
+ * @brief Implementación de una cola de prioridad por cubetas con un mapa de bits de niveles.
+ *
+ * Como LinkedPriorityQueue, guarda una cola FIFO por cada prioridad entera, pero encuentra
+ * la prioridad mínima no vacía con un mapa de bits jerárquico en lugar de recorrer todas
+ * las prioridades desde 0.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Abstract/PriorityQueue.h"
+#include "Structures/Common/LevelBitmap.h"
+#include "Structures/Implementations/Queues/ArrayQueue.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola de prioridad por cubetas (bucket queue) con prioridades en [0, priorities).
+ *
+ * Cada prioridad tiene una ArrayQueue creciente, reservada la primera vez que se usa, y
+ * un bit en un LevelBitmap que indica si su cola tiene elementos. insert() es O(1)
+ * amortizado; min() y removeMin() encuentran la cubeta mínima con un __builtin_ctzll por
+ * nivel del mapa (a lo sumo cuatro hasta 16 millones de prioridades), sin importar
+ * cuántas prioridades estén vacías. Los elementos con la misma prioridad salen en el
+ * orden en que entraron.
+ *
+ * @tparam E Tipo de dato almacenado en la cola de prioridad.
+ */
+template <typename E>
+class BucketPriorityQueue : public PriorityQueue<E> {
+private:
+    static const int BUCKET_CAPACITY = 8; ///< Capacidad inicial de la cola de cada prioridad.
+
+    ArrayQueue<E>** buckets; ///< Cola de cada prioridad; nullptr si nunca se ha usado.
+    LevelBitmap nonEmpty;    ///< Marca las prioridades cuya cola tiene elementos.
+    int priorities;          ///< Cantidad de prioridades.
+    int size;                ///< Número de elementos en la cola.
+    MemoryResource* resource; ///< Recurso del que se obtienen las colas, sus arreglos y el mapa.
+
+    /**
+     * @brief Obtiene la prioridad mínima con elementos.
+     *
+     * @throws runtime_error Si la cola está vacía.
+     */
+    int firstBucket() const {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return nonEmpty.findFirst();
+    }
+
+public:
+    /**
+     * @brief Constructor que recibe la cantidad de prioridades.
+     *
+     * @param priorities Cantidad de prioridades; las válidas van de 0 a priorities - 1.
+     * @param resource Recurso del que se obtiene la memoria de la cola (ver MemoryResource.h).
+     * @throws runtime_error Si la cantidad es menor que 1.
+     */
+    BucketPriorityQueue(int priorities, MemoryResource* resource = defaultResource())
+        : nonEmpty(priorities < 1 ? 1 : priorities, resource), resource(resource) {
+        if (priorities < 1)
+            throw runtime_error("Invalid number of priorities.");
+        this->priorities = priorities;
+        buckets = createArray<ArrayQueue<E>*>(resource, priorities, (ArrayQueue<E>*)nullptr);
+        size = 0;
+    }
+
+    /**
+     * @brief Destructor que libera las colas de cada prioridad.
+     */
+    ~BucketPriorityQueue() {
+        for (int i = 0; i < priorities; i++)
+            destroy(resource, buckets[i]);
+        destroyArray(resource, buckets, priorities);
+    }
+
+    /**
+     * @brief Inserta un elemento con la prioridad indicada.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @throws runtime_error Si la prioridad está fuera del rango permitido.
+     */
+    void insert(const E& element, int priority) {
+        insert(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento con la prioridad indicada moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @throws runtime_error Si la prioridad está fuera del rango permitido.
+     */
+    void insert(E&& element, int priority) {
+        if (priority < 0 || priority >= priorities)
+            throw runtime_error("Invalid priority.");
+        ArrayQueue<E>* bucket = buckets[priority];
+        if (bucket == nullptr)
+            bucket = buckets[priority] = create<ArrayQueue<E>>(resource, (int)BUCKET_CAPACITY, true, resource);
+        if (bucket->isEmpty())
+            nonEmpty.set(priority);
+        bucket->enqueue(std::move(element));
+        size++;
+    }
+
+    /**
+     * @brief Obtiene el elemento con la menor prioridad sin eliminarlo.
+     *
+     * @return El primero de los elementos con la prioridad mínima.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    E min() {
+        return buckets[firstBucket()]->frontValue();
+    }
+
+    /**
+     * @brief Obtiene una referencia al elemento con la menor prioridad, sin copiarlo.
+     *
+     * @return Referencia constante al primero de los elementos con la prioridad mínima.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    const E& peek() {
+        return buckets[firstBucket()]->front();
+    }
+
+    /**
+     * @brief Obtiene la prioridad mínima presente en la cola.
+     *
+     * @return La prioridad mínima.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    int minPriority() {
+        return firstBucket();
+    }
+
+    /**
+     * @brief Elimina y retorna el elemento con la menor prioridad.
+     *
+     * @return El primero de los elementos con la prioridad mínima.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    E removeMin() {
+        int priority = firstBucket();
+        ArrayQueue<E>* bucket = buckets[priority];
+        E result = bucket->dequeue();
+        if (bucket->isEmpty())
+            nonEmpty.reset(priority);
+        size--;
+        return result;
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola de prioridad.
+     *
+     * Sólo visita las prioridades con elementos; sus colas se conservan reservadas.
+     */
+    void clear() {
+        for (int p = nonEmpty.findFirst(); p >= 0; p = nonEmpty.findNext(p + 1))
+            buckets[p]->clear();
+        nonEmpty.clear();
+        size = 0;
+    }
+
+    /**
+     * @brief Retorna el número de elementos en la cola de prioridad.
+     *
+     * @return Cantidad de elementos en la cola.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtiene la memoria de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Retorna la cantidad de prioridades distintas que tienen elementos.
+     *
+     * @return Cantidad de cubetas no vacías.
+     */
+    int getUsedPriorities() {
+        return nonEmpty.count();
+    }
+
+    /**
+     * @brief Verifica si la cola de prioridad está vacía.
+     *
+     * @return true si la cola está vacía, false en caso contrario.
+     */
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    /**
+     * @brief Imprime el contenido de las prioridades que tienen elementos.
+     */
+    void print() {
+        for (int p = nonEmpty.findFirst(); p >= 0; p = nonEmpty.findNext(p + 1)) {
+            cout << "Priority " << p << ": ";
+            buckets[p]->print();
+        }
+    }
+};
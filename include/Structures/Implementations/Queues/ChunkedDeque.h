@@ -0,0 +1,348 @@
+/**
+ * @file ChunkedDeque.h
+ * @brief Implementación de una cola de doble extremo sobre bloques de tamaño fijo.
+ *
+ * Los elementos se guardan en bloques contiguos referenciados desde un mapa de punteros,
+ * por lo que insertar y extraer en cualquiera de los dos extremos es O(1) y los elementos
+ * no se mueven al crecer.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Abstract/Queue.h"
+#include "Structures/Common/MemoryResource.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola de doble extremo (deque) implementada con bloques de tamaño fijo.
+ *
+ * Los elementos ocupan las posiciones [start, start + size) de un arreglo virtual de
+ * mapSize * CHUNK_SIZE posiciones; la posición p está en el bloque p / CHUNK_SIZE. Sólo
+ * se reservan los bloques que contienen elementos. Cuando un extremo llega al borde del
+ * mapa, el mapa se duplica (o sólo se recentra si está mayormente vacío), copiando
+ * punteros a bloques y no elementos. El último bloque liberado se conserva para reutilizarlo,
+ * de modo que alternar inserciones y extracciones en el borde de un bloque no reserva
+ * memoria cada vez.
+ *
+ * Implementa todas las operaciones de Queue, incluidas las de doble extremo, en O(1)
+ * (amortizado al crecer el mapa). Además permite acceso por índice y recorrer los
+ * elementos bloque por bloque con forEachChunk().
+ *
+ * @tparam E Tipo de dato almacenado en la cola.
+ */
+template <typename E>
+class ChunkedDeque : public Queue<E> {
+private:
+    /**
+     * @brief Cantidad de elementos por bloque (bloques de unos 4 KB, con un mínimo de 8 elementos).
+     */
+    static const int CHUNK_SIZE = sizeof(E) <= 512 ? (int)(4096 / sizeof(E)) : 8;
+
+    E** map;     ///< Arreglo de punteros a bloques; nullptr si el bloque no está reservado.
+    int mapSize; ///< Cantidad de entradas del mapa.
+    int start;   ///< Posición virtual del primer elemento.
+    int size;    ///< Número de elementos en la cola.
+    E* spare;    ///< Bloque liberado que se conserva para reutilizarlo.
+    MemoryResource* resource; ///< Recurso del que se obtienen el mapa y los bloques.
+
+    /**
+     * @brief Obtiene un bloque, reutilizando el de reserva si existe.
+     */
+    E* acquireChunk() {
+        if (spare != nullptr) {
+            E* chunk = spare;
+            spare = nullptr;
+            return chunk;
+        }
+        return createArray<E>(resource, CHUNK_SIZE);
+    }
+
+    /**
+     * @brief Libera el bloque de una entrada del mapa, conservándolo como reserva si no hay otro.
+     *
+     * @param index Entrada del mapa.
+     */
+    void releaseChunk(int index) {
+        if (spare == nullptr)
+            spare = map[index];
+        else
+            destroyArray(resource, map[index], CHUNK_SIZE);
+        map[index] = nullptr;
+    }
+
+    /**
+     * @brief Reubica los bloques en uso para dejar espacio libre en ambos extremos del mapa.
+     *
+     * Si los bloques en uso ocupan menos de la mitad del mapa, sólo se recentran; si no,
+     * el mapa se duplica.
+     */
+    void growMap() {
+        int firstChunk = start / CHUNK_SIZE;
+        int used = size == 0 ? 0 : (start + size - 1) / CHUNK_SIZE - firstChunk + 1;
+        int newMapSize = used * 2 < mapSize ? mapSize : mapSize * 2;
+        int newFirstChunk = (newMapSize - used) / 2;
+        E** newMap = createArray<E*>(resource, newMapSize, (E*)nullptr);
+        for (int i = 0; i < used; i++)
+            newMap[newFirstChunk + i] = map[firstChunk + i];
+        destroyArray(resource, map, mapSize);
+        map = newMap;
+        mapSize = newMapSize;
+        start += (newFirstChunk - firstChunk) * CHUNK_SIZE;
+    }
+
+    /**
+     * @brief Obtiene la referencia a la posición virtual indicada.
+     */
+    E& at(int position) {
+        return map[position / CHUNK_SIZE][position % CHUNK_SIZE];
+    }
+
+    /**
+     * @brief Recentra start cuando la cola queda vacía, para que los extremos no se desplacen.
+     */
+    void resetIfEmpty() {
+        if (size == 0)
+            start = mapSize / 2 * CHUNK_SIZE;
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Inicializa una cola vacía.
+     *
+     * @param resource Recurso del que se obtienen el mapa y los bloques (ver MemoryResource.h).
+     */
+    explicit ChunkedDeque(MemoryResource* resource = defaultResource()) : resource(resource) {
+        mapSize = 8;
+        map = createArray<E*>(resource, mapSize, (E*)nullptr);
+        size = 0;
+        spare = nullptr;
+        resetIfEmpty();
+    }
+
+    /**
+     * @brief Destructor que libera los bloques y el mapa.
+     */
+    ~ChunkedDeque() {
+        clear();
+        destroyArray(resource, spare, CHUNK_SIZE);
+        destroyArray(resource, map, mapSize);
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola.
+     *
+     * @param element Elemento a insertar, que se copia.
+     */
+    void enqueue(const E& element) {
+        enqueue(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void enqueue(E&& element) {
+        if (start + size == mapSize * CHUNK_SIZE)
+            growMap();
+        int position = start + size;
+        if (map[position / CHUNK_SIZE] == nullptr)
+            map[position / CHUNK_SIZE] = acquireChunk();
+        at(position) = std::move(element);
+        size++;
+    }
+
+    /**
+     * @brief Elimina y retorna el elemento al frente de la cola.
+     *
+     * @return Elemento en el frente de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E dequeue() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        E result = std::move(at(start));
+        start++;
+        size--;
+        if (size == 0 || start % CHUNK_SIZE == 0)
+            releaseChunk((start - 1) / CHUNK_SIZE);
+        resetIfEmpty();
+        return result;
+    }
+
+    /**
+     * @brief Retorna el elemento al frente de la cola sin eliminarlo.
+     *
+     * @return Elemento en el frente de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E frontValue() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return at(start);
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento al frente de la cola, sin copiarlo.
+     *
+     * @return Referencia al elemento en el frente de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E& front() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return at(start);
+    }
+
+    /**
+     * @brief Inserta un elemento al frente de la cola.
+     *
+     * @param element Elemento a insertar, que se copia.
+     */
+    void enqueueFront(const E& element) {
+        enqueueFront(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al frente de la cola moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void enqueueFront(E&& element) {
+        if (start == 0)
+            growMap();
+        start--;
+        if (map[start / CHUNK_SIZE] == nullptr)
+            map[start / CHUNK_SIZE] = acquireChunk();
+        at(start) = std::move(element);
+        size++;
+    }
+
+    /**
+     * @brief Elimina y retorna el último elemento de la cola.
+     *
+     * @return Elemento en el final de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E dequeueBack() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        size--;
+        int position = start + size;
+        E result = std::move(at(position));
+        if (size == 0 || position % CHUNK_SIZE == 0)
+            releaseChunk(position / CHUNK_SIZE);
+        resetIfEmpty();
+        return result;
+    }
+
+    /**
+     * @brief Retorna el último elemento de la cola sin eliminarlo.
+     *
+     * @return Elemento en el final de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E backValue() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return at(start + size - 1);
+    }
+
+    /**
+     * @brief Retorna una referencia al último elemento de la cola, sin copiarlo.
+     *
+     * @return Referencia al elemento en el final de la cola.
+     * @throws runtime_error si la cola está vacía.
+     */
+    E& back() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return at(start + size - 1);
+    }
+
+    /**
+     * @brief Obtiene el elemento en una posición, contando desde el frente.
+     *
+     * @param index Posición del elemento (0 es el frente).
+     * @return El elemento en la posición indicada.
+     * @throws runtime_error si la posición está fuera de los límites.
+     */
+    E get(int index) {
+        if (index < 0 || index >= size)
+            throw runtime_error("Index out of bounds.");
+        return at(start + index);
+    }
+
+    /**
+     * @brief Recorre los elementos en orden, un bloque contiguo a la vez.
+     *
+     * @param visit Función que recibe un puntero al primer elemento del tramo y su cantidad.
+     */
+    template <typename F>
+    void forEachChunk(F visit) {
+        int position = start;
+        int last = start + size;
+        while (position < last) {
+            int offset = position % CHUNK_SIZE;
+            int count = CHUNK_SIZE - offset < last - position ? CHUNK_SIZE - offset : last - position;
+            visit((const E*)(map[position / CHUNK_SIZE] + offset), count);
+            position += count;
+        }
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola.
+     */
+    void clear() {
+        for (int i = 0; i < mapSize; i++)
+            if (map[i] != nullptr)
+                releaseChunk(i);
+        size = 0;
+        resetIfEmpty();
+    }
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     *
+     * @return true si la cola no contiene elementos, false en caso contrario.
+     */
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    /**
+     * @brief Retorna el número de elementos en la cola.
+     *
+     * @return La cantidad de elementos en la cola.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen el mapa y los bloques de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Imprime el contenido de la cola.
+     */
+    void print() {
+        cout << "[ ";
+        for (int i = 0; i < size; i++)
+            cout << at(start + i) << " ";
+        cout << "]" << endl;
+    }
+};
@@ -11,6 +11,7 @@
 #pragma once
 
 #include <stdexcept>
+#include <utility>
 #include "Structures/Abstract/PriorityQueue.h"
 #include "Structures/Implementations/Queues/MinHeap.h"
 #include "Structures/Common/KVPair.h"
@@ -24,33 +25,44 @@ template <typename E>
 class HeapPriorityQueue : public PriorityQueue<E> {
 private:
     MinHeap<KVPair<int, E>>* pairs; ///< Heap mínimo que almacena pares de prioridad y elementos.
+    MemoryResource* resource; ///< Recurso del que se obtienen el heap y su arreglo.
 
 public:
     /**
      * @brief Constructor de la cola de prioridad con tamaño máximo opcional.
      * 
      * @param max Capacidad máxima del heap (por defecto DEFAULT_MAX).
+     * @param resource Recurso del que se obtiene la memoria del heap (ver MemoryResource.h).
      */
-    HeapPriorityQueue(int max = DEFAULT_MAX) {
-        pairs = new MinHeap<KVPair<int, E>>(max);
+    HeapPriorityQueue(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource()) : resource(resource) {
+        pairs = create<MinHeap<KVPair<int, E>>>(resource, max, false, resource);
     }
 
     /**
      * @brief Destructor que libera la memoria utilizada por el heap.
      */
     ~HeapPriorityQueue() {
-        delete pairs;
+        destroy(resource, pairs);
     }
 
     /**
      * @brief Inserta un elemento en la cola de prioridad con una prioridad dada.
      * 
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
      */
-    void insert(E element, int priority) {
-        KVPair<int, E> p(priority, element);
-        pairs->insert(p);
+    void insert(const E& element, int priority) {
+        insert(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(E&& element, int priority) {
+        pairs->insert(KVPair<int, E>(priority, std::move(element)));
     }
 
     /**
@@ -59,8 +71,16 @@ public:
      * @return Elemento con la mayor prioridad (menor clave).
      */
     E min() {
-        KVPair<int, E> p = pairs->first();
-        return p.value;
+        return pairs->peek().value;
+    }
+
+    /**
+     * @brief Obtiene una referencia al elemento con la menor prioridad, sin copiarlo.
+     * 
+     * @return Referencia constante al elemento con la mayor prioridad (menor clave).
+     */
+    const E& peek() {
+        return pairs->peek().value;
     }
 
     /**
@@ -69,8 +89,7 @@ public:
      * @return Elemento con la mayor prioridad (menor clave).
      */
     E removeMin() {
-        KVPair<int, E> p = pairs->removeFirst();
-        return p.value;
+        return pairs->removeFirst().value;
     }
 
     /**
@@ -89,6 +108,15 @@ public:
         return pairs->getSize();
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtiene la memoria de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Verifica si la cola de prioridad está vacía.
      * 
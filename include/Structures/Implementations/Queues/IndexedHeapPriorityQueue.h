@@ -0,0 +1,440 @@
+/**
+ * @file IndexedHeapPriorityQueue.h
+ * @brief Cola de prioridad sobre un heap d-ario que permite modificar elementos ya insertados.
+ *
+ * Cada inserción retorna un identificador (handle) estable con el que luego se puede
+ * cambiar la prioridad del elemento o eliminarlo en O(log n).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Abstract/PriorityQueue.h"
+#include "Structures/Common/MemoryResource.h"
+
+#define DEFAULT_MAX 1024
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola de prioridad direccionable implementada con un heap d-ario indexado.
+ *
+ * El heap guarda pares (prioridad, handle) en un arreglo contiguo, de modo que las
+ * comparaciones no tocan los elementos. Para cada handle se guarda su elemento y su
+ * posición actual en el heap, que se actualiza en cada movimiento; así decreaseKey(),
+ * changePriority() y erase() encuentran el elemento en O(1) y lo reubican en O(log n).
+ *
+ * Un handle es válido desde que push() lo retorna hasta que su elemento sale de la cola
+ * (por removeMin(), erase() o clear()); después puede reutilizarse para otro elemento.
+ * La capacidad se duplica automáticamente.
+ *
+ * @tparam E Tipo de dato almacenado en la cola de prioridad.
+ * @tparam D Cantidad de hijos por nodo del heap (por defecto 4).
+ */
+template <typename E, int D = 4>
+class IndexedHeapPriorityQueue : public PriorityQueue<E> {
+    static_assert(D >= 2, "La aridad del heap debe ser al menos 2.");
+
+private:
+    /**
+     * @brief Posición del heap: prioridad y handle del elemento.
+     */
+    struct Slot {
+        int priority; ///< Prioridad del elemento.
+        int handle;   ///< Handle del elemento.
+    };
+
+    Slot* heap;       ///< Heap de pares (prioridad, handle).
+    int* positions;   ///< Posición en el heap de cada handle, o -1 si no está en uso.
+    E* elements;      ///< Elemento de cada handle.
+    int* freeHandles; ///< Pila de handles liberados para reutilizar.
+    int freeCount;    ///< Cantidad de handles en freeHandles.
+    int nextHandle;   ///< Siguiente handle nunca utilizado.
+    int size;         ///< Número de elementos en la cola.
+    int max;          ///< Capacidad actual de los arreglos.
+    MemoryResource* resource; ///< Recurso del que se obtienen los arreglos.
+
+    /**
+     * @brief Duplica la capacidad de todos los arreglos.
+     */
+    void expand() {
+        int newMax = max * 2;
+        Slot* newHeap = createArray<Slot>(resource, newMax);
+        int* newPositions = createArray<int>(resource, newMax);
+        E* newElements = createArray<E>(resource, newMax);
+        int* newFreeHandles = createArray<int>(resource, newMax);
+        for (int i = 0; i < max; i++) {
+            newHeap[i] = heap[i];
+            newPositions[i] = positions[i];
+            newElements[i] = std::move(elements[i]);
+            newFreeHandles[i] = freeHandles[i];
+        }
+        destroyArray(resource, heap, max);
+        destroyArray(resource, positions, max);
+        destroyArray(resource, elements, max);
+        destroyArray(resource, freeHandles, max);
+        heap = newHeap;
+        positions = newPositions;
+        elements = newElements;
+        freeHandles = newFreeHandles;
+        max = newMax;
+    }
+
+    /**
+     * @brief Verifica que un handle corresponda a un elemento de la cola.
+     *
+     * @param handle Handle a verificar.
+     * @throw runtime_error Si el handle no es válido.
+     */
+    void checkHandle(int handle) {
+        if (handle < 0 || handle >= nextHandle || positions[handle] < 0)
+            throw runtime_error("Invalid handle.");
+    }
+
+    /**
+     * @brief Mueve hacia arriba la posición indicada usando un hueco.
+     *
+     * @param pos Posición a mover.
+     */
+    void siftUp(int pos) {
+        Slot moving = heap[pos];
+        while (pos > 0) {
+            int parent = (pos - 1) / D;
+            if (!(moving.priority < heap[parent].priority))
+                break;
+            heap[pos] = heap[parent];
+            positions[heap[pos].handle] = pos;
+            pos = parent;
+        }
+        heap[pos] = moving;
+        positions[moving.handle] = pos;
+    }
+
+    /**
+     * @brief Mueve hacia abajo la posición indicada usando un hueco.
+     *
+     * @param pos Posición a mover.
+     */
+    void siftDown(int pos) {
+        Slot moving = heap[pos];
+        while (true) {
+            int first = D * pos + 1;
+            if (first >= size)
+                break;
+            int last = first + D < size ? first + D : size;
+            int best = first;
+            for (int child = first + 1; child < last; child++)
+                if (heap[child].priority < heap[best].priority)
+                    best = child;
+            if (!(heap[best].priority < moving.priority))
+                break;
+            heap[pos] = heap[best];
+            positions[heap[pos].handle] = pos;
+            pos = best;
+        }
+        heap[pos] = moving;
+        positions[moving.handle] = pos;
+    }
+
+    /**
+     * @brief Quita del heap la posición indicada y libera su handle.
+     *
+     * @param pos Posición a quitar.
+     * @return El elemento que estaba en esa posición.
+     */
+    E removeAt(int pos) {
+        int handle = heap[pos].handle;
+        E result = std::move(elements[handle]);
+        positions[handle] = -1;
+        freeHandles[freeCount++] = handle;
+        size--;
+        if (pos != size) {
+            heap[pos] = heap[size];
+            positions[heap[pos].handle] = pos;
+            if (pos > 0 && heap[pos].priority < heap[(pos - 1) / D].priority)
+                siftUp(pos);
+            else
+                siftDown(pos);
+        }
+        return result;
+    }
+
+public:
+    /**
+     * @brief Constructor de la cola con capacidad inicial opcional.
+     *
+     * @param max Capacidad inicial (por defecto DEFAULT_MAX).
+     * @param resource Recurso del que se obtienen los arreglos (ver MemoryResource.h).
+     * @throw runtime_error Si la capacidad es menor que 1.
+     */
+    IndexedHeapPriorityQueue(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource())
+        : resource(resource) {
+        if (max < 1)
+            throw runtime_error("Invalid max size.");
+        this->max = max;
+        heap = createArray<Slot>(resource, max);
+        positions = createArray<int>(resource, max);
+        elements = createArray<E>(resource, max);
+        freeHandles = createArray<int>(resource, max);
+        freeCount = nextHandle = size = 0;
+    }
+
+    /**
+     * @brief Destructor que libera la memoria utilizada por la cola.
+     */
+    ~IndexedHeapPriorityQueue() {
+        destroyArray(resource, heap, max);
+        destroyArray(resource, positions, max);
+        destroyArray(resource, elements, max);
+        destroyArray(resource, freeHandles, max);
+    }
+
+    /**
+     * @brief Inserta un elemento y retorna su handle.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @return Handle del elemento insertado.
+     */
+    int push(const E& element, int priority) {
+        return push(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento moviéndolo y retorna su handle.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @return Handle del elemento insertado.
+     */
+    int push(E&& element, int priority) {
+        int handle;
+        if (freeCount > 0) {
+            handle = freeHandles[--freeCount];
+        } else {
+            if (nextHandle == max)
+                expand();
+            handle = nextHandle++;
+        }
+        elements[handle] = std::move(element);
+        heap[size].priority = priority;
+        heap[size].handle = handle;
+        size++;
+        siftUp(size - 1);
+        return handle;
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(const E& element, int priority) {
+        push(element, priority);
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(E&& element, int priority) {
+        push(std::move(element), priority);
+    }
+
+    /**
+     * @brief Obtiene el elemento con la menor prioridad sin eliminarlo.
+     *
+     * @return Elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    E min() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[heap[0].handle];
+    }
+
+    /**
+     * @brief Obtiene una referencia al elemento con la menor prioridad, sin copiarlo.
+     *
+     * @return Referencia constante al elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    const E& peek() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[heap[0].handle];
+    }
+
+    /**
+     * @brief Obtiene la prioridad del elemento con la menor prioridad.
+     *
+     * @return La menor prioridad de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    int minPriority() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return heap[0].priority;
+    }
+
+    /**
+     * @brief Obtiene el handle del elemento con la menor prioridad.
+     *
+     * @return Handle del elemento en el frente de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    int minHandle() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return heap[0].handle;
+    }
+
+    /**
+     * @brief Elimina y retorna el elemento con la menor prioridad.
+     *
+     * @return Elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    E removeMin() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return removeAt(0);
+    }
+
+    /**
+     * @brief Reduce la prioridad de un elemento.
+     *
+     * @param handle Handle del elemento.
+     * @param priority Nueva prioridad, que no puede ser mayor que la actual.
+     * @throw runtime_error Si el handle no es válido o la prioridad es mayor que la actual.
+     */
+    void decreaseKey(int handle, int priority) {
+        checkHandle(handle);
+        int pos = positions[handle];
+        if (heap[pos].priority < priority)
+            throw runtime_error("Invalid priority.");
+        heap[pos].priority = priority;
+        siftUp(pos);
+    }
+
+    /**
+     * @brief Cambia la prioridad de un elemento, en cualquier dirección.
+     *
+     * @param handle Handle del elemento.
+     * @param priority Nueva prioridad.
+     * @throw runtime_error Si el handle no es válido.
+     */
+    void changePriority(int handle, int priority) {
+        checkHandle(handle);
+        int pos = positions[handle];
+        int old = heap[pos].priority;
+        heap[pos].priority = priority;
+        if (priority < old)
+            siftUp(pos);
+        else
+            siftDown(pos);
+    }
+
+    /**
+     * @brief Elimina un elemento cualquiera de la cola.
+     *
+     * @param handle Handle del elemento.
+     * @return El elemento eliminado.
+     * @throw runtime_error Si el handle no es válido.
+     */
+    E erase(int handle) {
+        checkHandle(handle);
+        return removeAt(positions[handle]);
+    }
+
+    /**
+     * @brief Verifica si un handle corresponde a un elemento de la cola.
+     *
+     * @param handle Handle a verificar.
+     * @return true si el elemento sigue en la cola, false en caso contrario.
+     */
+    bool contains(int handle) {
+        return handle >= 0 && handle < nextHandle && positions[handle] >= 0;
+    }
+
+    /**
+     * @brief Obtiene la prioridad actual de un elemento.
+     *
+     * @param handle Handle del elemento.
+     * @return La prioridad del elemento.
+     * @throw runtime_error Si el handle no es válido.
+     */
+    int getPriority(int handle) {
+        checkHandle(handle);
+        return heap[positions[handle]].priority;
+    }
+
+    /**
+     * @brief Obtiene el elemento asociado a un handle.
+     *
+     * @param handle Handle del elemento.
+     * @return El elemento.
+     * @throw runtime_error Si el handle no es válido.
+     */
+    E getElement(int handle) {
+        checkHandle(handle);
+        return elements[handle];
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola de prioridad.
+     *
+     * Todos los handles dejan de ser válidos.
+     */
+    void clear() {
+        for (int i = 0; i < nextHandle; i++)
+            positions[i] = -1;
+        freeCount = nextHandle = size = 0;
+    }
+
+    /**
+     * @brief Retorna el número de elementos en la cola de prioridad.
+     *
+     * @return Cantidad de elementos en la cola.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen los arreglos de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si la cola de prioridad está vacía.
+     *
+     * @return true si la cola está vacía, false en caso contrario.
+     */
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    /**
+     * @brief Imprime los pares (prioridad, elemento) en el orden del heap.
+     */
+    void print() {
+        cout << "[ ";
+        for (int i = 0; i < size; i++)
+            cout << "(" << heap[i].priority << ", " << elements[heap[i].handle] << ") ";
+        cout << "]" << endl;
+    }
+};
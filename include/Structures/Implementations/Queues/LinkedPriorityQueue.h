@@ -14,8 +14,10 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 #include "Structures/Abstract/Queue.h"
 #include "Structures/Abstract/PriorityQueue.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
 
 using std::cout;
 using std::endl;
@@ -32,17 +34,19 @@ private:
     LinkedQueue<E>* queues; ///< Arreglo de colas enlazadas, una por cada nivel de prioridad.
     int size; ///< Cantidad de elementos en la cola de prioridad.
     int priorities; ///< Número de niveles de prioridad disponibles.
+    MemoryResource* resource; ///< Recurso del que se obtienen las colas y sus nodos.
 
 public:
     /**
      * @brief Constructor que inicializa la cola de prioridad con un número de prioridades.
      * 
      * @param priorities Número de prioridades disponibles en la cola.
+     * @param resource Recurso del que se obtienen las colas y sus nodos (ver MemoryResource.h).
      * @throws std::runtime_error si priorities es menor o igual a 0.
      */
-    LinkedPriorityQueue(int priorities) {
+    LinkedPriorityQueue(int priorities, MemoryResource* resource = defaultResource()) : resource(resource) {
         if (priorities <= 0) throw runtime_error("Invalid number of priorities");
-        queues = new LinkedQueue<E>[priorities];
+        queues = createArray<LinkedQueue<E>>(resource, priorities, resource);
         size = 0;
         this->priorities = priorities;
     }
@@ -51,19 +55,30 @@ public:
      * @brief Destructor que libera la memoria utilizada por el arreglo de colas enlazadas.
      */
     ~LinkedPriorityQueue() {
-        delete[] queues;
+        destroyArray(resource, queues, priorities);
     }
 
     /**
      * @brief Inserta un elemento en la cola de prioridad con la prioridad especificada.
      * 
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      * @param priority Prioridad del elemento (por defecto 0).
      * @throws std::runtime_error si la prioridad está fuera del rango permitido.
      */
-    void insert(E element, int priority = 0) {
+    void insert(const E& element, int priority = 0) {
+        insert(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (por defecto 0).
+     * @throws std::runtime_error si la prioridad está fuera del rango permitido.
+     */
+    void insert(E&& element, int priority = 0) {
         if (priority < 0 || priority >= priorities) throw runtime_error("Invalid priority");
-        queues[priority].enqueue(element);
+        queues[priority].enqueue(std::move(element));
         size++;
     }
 
@@ -81,6 +96,20 @@ public:
         throw runtime_error("Queue not found");
     }
 
+    /**
+     * @brief Obtiene una referencia al elemento con la mayor prioridad, sin copiarlo.
+     * 
+     * @return Referencia constante al elemento con la mayor prioridad disponible.
+     * @throws std::runtime_error si la cola está vacía.
+     */
+    const E& peek() {
+        if (size == 0) throw runtime_error("Queue is empty");
+        for (int i = 0; i < priorities; i++) {
+            if (!queues[i].isEmpty()) return queues[i].front();
+        }
+        throw runtime_error("Queue not found");
+    }
+
     /**
      * @brief Elimina y retorna el elemento con la mayor prioridad.
      * 
@@ -107,6 +136,15 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen las colas y sus nodos.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Verifica si la cola de prioridad está vacía.
      * 
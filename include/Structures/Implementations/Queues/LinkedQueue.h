@@ -14,8 +14,10 @@
 
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 #include "Structures/Abstract/Queue.h"
-#include "Structures/Common/Nodes/Node.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Nodes/DNode.h"
 
 using std::cout;
 using std::endl;
@@ -26,23 +28,27 @@ using std::runtime_error;
  * @brief Implementación de una cola basada en nodos enlazados.
  *
  * Esta clase implementa una cola genérica enlazada, proporcionando operaciones 
- * como inserción, eliminación y consulta de elementos.
+ * como inserción, eliminación y consulta de elementos. Los nodos son doblemente
+ * enlazados para que dequeueBack() no tenga que recorrer la cola.
  *
  * @tparam E Tipo de dato almacenado en la cola.
  */
 template <typename E>
 class LinkedQueue : public Queue<E> {
 private:
-    Node<E>* front; ///< Puntero al nodo ficticio (cabeza) de la cola.
-    Node<E>* back;  ///< Puntero al último nodo de la cola.
+    DNode<E>* head; ///< Puntero al nodo ficticio (cabeza) de la cola.
+    DNode<E>* tail; ///< Puntero al último nodo de la cola.
     int size;       ///< Número de elementos en la cola.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
 public:
     /**
      * @brief Constructor por defecto. Inicializa una cola vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    LinkedQueue() {
-        front = back = new Node<E>(); ///< Nodo ficticio para simplificar operaciones.
+    explicit LinkedQueue(MemoryResource* resource = defaultResource()) : resource(resource) {
+        head = tail = create<DNode<E>>(resource, nullptr, nullptr); ///< Nodo ficticio para simplificar operaciones.
         size = 0;
     }
 
@@ -51,16 +57,25 @@ public:
      */
     ~LinkedQueue() {
         clear();
-        delete front;
+        destroy(resource, head);
     }
 
     /**
      * @brief Inserta un elemento al final de la cola.
      * 
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      */
-    void enqueue(E element) {
-        back = back->next = new Node<E>(element);
+    void enqueue(const E& element) {
+        enqueue(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void enqueue(E&& element) {
+        tail = tail->next = create<DNode<E>>(resource, std::move(element), nullptr, tail);
         size++;
     }
 
@@ -72,12 +87,14 @@ public:
      */
     E dequeue() {
         if (size == 0) throw runtime_error("Queue is empty");
-        Node<E>* temp = front->next;
-        E result = temp->element;
-        front->next = temp->next;
-        delete temp;
+        DNode<E>* temp = head->next;
+        E result = std::move(temp->element);
+        head->next = temp->next;
+        if (temp->next != nullptr)
+            temp->next->previous = head;
+        destroy(resource, temp);
         size--;
-        if (size == 0) back = front;
+        if (size == 0) tail = head;
         return result;
     }
 
@@ -89,19 +106,30 @@ public:
      */
     E frontValue() {
         if (size == 0) throw runtime_error("Queue is empty");
-        return front->next->element;
+        return head->next->element;
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento en el frente de la cola, sin copiarlo.
+     * 
+     * @return Referencia al elemento en el frente de la cola.
+     * @throws std::runtime_error si la cola está vacía.
+     */
+    E& front() {
+        if (size == 0) throw runtime_error("Queue is empty");
+        return head->next->element;
     }
 
     /**
      * @brief Elimina todos los elementos de la cola.
      */
     void clear() {
-        while (front->next != nullptr) {
-            Node<E>* temp = front->next;
-            front->next = temp->next;
-            delete temp;
+        while (head->next != nullptr) {
+            DNode<E>* temp = head->next;
+            head->next = temp->next;
+            destroy(resource, temp);
         }
-        back = front;
+        tail = head;
         size = 0;
     }
 
@@ -123,18 +151,36 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Inserta un elemento al frente de la cola (soporte para Deque).
      * 
-     * @param element Elemento a insertar al frente.
-     */
-    void enqueueFront(E element) {
-        Node<E>* newNode = new Node<E>(element);
-        newNode->next = front->next;
-        front->next = newNode;
-        if (size == 0) {
-            back = newNode;
-        }
+     * @param element Elemento a insertar al frente, que se copia.
+     */
+    void enqueueFront(const E& element) {
+        enqueueFront(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento al frente de la cola moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     */
+    void enqueueFront(E&& element) {
+        DNode<E>* newNode = create<DNode<E>>(resource, std::move(element), head->next, head);
+        if (size == 0)
+            tail = newNode;
+        else
+            head->next->previous = newNode;
+        head->next = newNode;
         size++;
     }
 
@@ -146,14 +192,11 @@ public:
      */
     E dequeueBack() {
         if (size == 0) throw runtime_error("Queue is empty");
-        Node<E>* temp = front;
-        while (temp->next != back) {
-            temp = temp->next;
-        }
-        E result = back->element;
-        delete back;
-        back = temp;
-        back->next = nullptr;
+        DNode<E>* temp = tail->previous;
+        E result = std::move(tail->element);
+        destroy(resource, tail);
+        tail = temp;
+        tail->next = nullptr;
         size--;
         return result;
     }
@@ -166,7 +209,18 @@ public:
      */
     E backValue() {
         if (size == 0) throw runtime_error("Queue is empty");
-        return back->element;
+        return tail->element;
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento en el final de la cola, sin copiarlo.
+     * 
+     * @return Referencia al elemento en el final de la cola.
+     * @throws std::runtime_error si la cola está vacía.
+     */
+    E& back() {
+        if (size == 0) throw runtime_error("Queue is empty");
+        return tail->element;
     }
 
     /**
@@ -174,7 +228,7 @@ public:
      */
     void print() {
         cout << "[ ";
-        Node<E>* temp = front->next;
+        DNode<E>* temp = head->next;
         while (temp != nullptr) {
             cout << temp->element << " ";
             temp = temp->next;
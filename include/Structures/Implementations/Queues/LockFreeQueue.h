@@ -0,0 +1,193 @@
+/**
+ * @file LockFreeQueue.h
+ * @brief Implementación de una cola enlazada sin bloqueos (Michael-Scott).
+ *
+ * Cualquier cantidad de hilos puede insertar y extraer al mismo tiempo. Los nodos
+ * extraídos se liberan con punteros de riesgo (hazard pointers).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Common/HazardPointers.h"
+#include "Structures/Common/Nodes/AtomicNode.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola enlazada ilimitada sin bloqueos para varios productores y consumidores.
+ *
+ * Sigue el mismo esquema que LinkedQueue: front apunta a un nodo centinela y el primer
+ * elemento está en front->next. Insertar enlaza el nodo nuevo con compare-and-swap sobre
+ * el next del último nodo y luego avanza back; extraer avanza front con compare-and-swap
+ * y el nodo centinela anterior se retira. Cualquier hilo que encuentre back atrasado lo
+ * avanza, por lo que ningún hilo bloquea a los demás.
+ *
+ * Antes de leer un nodo compartido se publica en un puntero de riesgo, y los nodos
+ * retirados se liberan sólo cuando ningún hilo los tiene publicados.
+ *
+ * A diferencia de los demás contenedores, no recibe un MemoryResource: los nodos se
+ * reservan desde varios hilos a la vez y un nodo retirado puede liberarse después de
+ * destruida la cola, por lo que siempre se obtienen con new y se liberan con delete.
+ *
+ * getSize() es aproximado mientras otros hilos modifican la cola; print() y el
+ * destructor sólo deben llamarse cuando ningún otro hilo la utiliza.
+ *
+ * @tparam E Tipo de dato almacenado en la cola.
+ */
+template <typename E>
+class LockFreeQueue {
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<AtomicNode<E>*> front; ///< Nodo centinela.
+    alignas(CACHE_LINE_SIZE) std::atomic<AtomicNode<E>*> back;  ///< Último nodo (o uno anterior).
+    alignas(CACHE_LINE_SIZE) std::atomic<int> size;             ///< Cantidad aproximada de elementos.
+
+public:
+    /**
+     * @brief Constructor de copia (eliminado).
+     */
+    LockFreeQueue(const LockFreeQueue<E>& other) = delete;
+
+    /**
+     * @brief Operador de asignación (eliminado).
+     */
+    void operator =(const LockFreeQueue<E>& other) = delete;
+
+    /**
+     * @brief Constructor por defecto. Inicializa una cola vacía.
+     */
+    LockFreeQueue() : size(0) {
+        AtomicNode<E>* dummy = new AtomicNode<E>();
+        front.store(dummy);
+        back.store(dummy);
+    }
+
+    /**
+     * @brief Destructor de la cola. Libera la memoria de los nodos.
+     */
+    ~LockFreeQueue() {
+        AtomicNode<E>* node = front.load();
+        while (node != nullptr) {
+            AtomicNode<E>* next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola.
+     *
+     * @param element Elemento a insertar.
+     */
+    void enqueue(const E& element) {
+        AtomicNode<E>* node = new AtomicNode<E>(element);
+        while (true) {
+            AtomicNode<E>* last = HazardPointers::protect(0, back);
+            AtomicNode<E>* next = last->next.load(std::memory_order_acquire);
+            if (last != back.load(std::memory_order_acquire))
+                continue;
+            if (next != nullptr) {
+                back.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            AtomicNode<E>* expected = nullptr;
+            if (last->next.compare_exchange_weak(expected, node, std::memory_order_release, std::memory_order_relaxed)) {
+                back.compare_exchange_strong(last, node, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        }
+        HazardPointers::clear(0);
+        size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Intenta extraer el elemento del frente de la cola.
+     *
+     * @param element Se asigna el elemento extraído.
+     * @return true si se extrajo, false si la cola estaba vacía.
+     */
+    bool tryDequeue(E& element) {
+        while (true) {
+            AtomicNode<E>* first = HazardPointers::protect(0, front);
+            AtomicNode<E>* next = HazardPointers::protect(1, first->next);
+            if (first != front.load(std::memory_order_acquire))
+                continue;
+            if (next == nullptr) {
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                return false;
+            }
+            AtomicNode<E>* last = back.load(std::memory_order_acquire);
+            if (first == last) {
+                back.compare_exchange_weak(last, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+            if (front.compare_exchange_strong(first, next, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                element = next->element;
+                HazardPointers::clear(0);
+                HazardPointers::clear(1);
+                HazardPointers::retire(first);
+                size.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @brief Extrae el elemento del frente de la cola, esperando si está vacía.
+     *
+     * @return El elemento extraído.
+     */
+    E dequeue() {
+        E element;
+        for (int attempt = 0; !tryDequeue(element); attempt++)
+            spinWait(attempt);
+        return element;
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola.
+     */
+    void clear() {
+        E element;
+        while (tryDequeue(element)) {}
+    }
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     *
+     * @return true si la cola no contiene elementos, false en caso contrario.
+     */
+    bool isEmpty() {
+        bool empty = HazardPointers::protect(0, front)->next.load(std::memory_order_acquire) == nullptr;
+        HazardPointers::clear(0);
+        return empty;
+    }
+
+    /**
+     * @brief Retorna el número aproximado de elementos en la cola.
+     *
+     * @return La cantidad de elementos en la cola.
+     */
+    int getSize() {
+        int current = size.load(std::memory_order_relaxed);
+        return current > 0 ? current : 0;
+    }
+
+    /**
+     * @brief Imprime el contenido de la cola.
+     */
+    void print() {
+        cout << "[ ";
+        for (AtomicNode<E>* node = front.load()->next.load(); node != nullptr; node = node->next.load())
+            cout << node->element << " ";
+        cout << "]" << endl;
+    }
+};
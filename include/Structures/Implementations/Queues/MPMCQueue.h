@@ -0,0 +1,233 @@
+/**
+ * @file MPMCQueue.h
+ * @brief Implementación de una cola circular acotada para varios productores y consumidores.
+ *
+ * Cada celda del arreglo lleva un número de secuencia que indica si está lista para
+ * escribirse o para leerse (esquema de Dmitry Vyukov), por lo que no se usan bloqueos.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Common/MemoryResource.h"
+
+#define DEFAULT_MAX 1024
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola circular acotada sin bloqueos para varios productores y consumidores.
+ *
+ * La capacidad se redondea a la siguiente potencia de dos. La celda i empieza con
+ * secuencia i. Un productor que obtiene la posición pos espera que la secuencia de su
+ * celda sea pos; reserva la posición avanzando enqueuePos con compare-and-swap, escribe
+ * el elemento y publica la secuencia pos + 1. Un consumidor en la posición pos espera
+ * la secuencia pos + 1 y, después de leer, deja la secuencia en pos + capacidad para la
+ * siguiente vuelta. Así cada operación exitosa hace un solo compare-and-swap sobre un
+ * índice compartido, y productores y consumidores usan índices en líneas de caché
+ * distintas.
+ *
+ * getSize() es aproximado mientras otros hilos modifican la cola; print() sólo debe
+ * llamarse cuando ningún otro hilo la utiliza.
+ *
+ * @tparam E Tipo de dato almacenado en la cola.
+ */
+template <typename E>
+class MPMCQueue {
+private:
+    /**
+     * @brief Celda del arreglo circular.
+     */
+    struct Cell {
+        std::atomic<std::size_t> sequence; ///< Número de secuencia de la celda.
+        E element;                         ///< Elemento almacenado.
+    };
+
+    Cell* cells;           ///< Arreglo circular de celdas.
+    std::size_t capacity;  ///< Capacidad de la cola (potencia de dos).
+    std::size_t mask;      ///< capacity - 1, para reducir una posición a una celda.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueuePos; ///< Siguiente posición a escribir.
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeuePos; ///< Siguiente posición a leer.
+
+public:
+    /**
+     * @brief Constructor de copia (eliminado).
+     */
+    MPMCQueue(const MPMCQueue<E>& other) = delete;
+
+    /**
+     * @brief Operador de asignación (eliminado).
+     */
+    void operator =(const MPMCQueue<E>& other) = delete;
+
+    /**
+     * @brief Constructor de la cola con capacidad mínima especificada.
+     *
+     * @param max Capacidad mínima; se redondea a la siguiente potencia de dos.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
+     * @throw runtime_error si la capacidad es menor que 2.
+     */
+    MPMCQueue(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource())
+        : resource(resource), enqueuePos(0), dequeuePos(0) {
+        if (max < 2)
+            throw runtime_error("Invalid max size.");
+        capacity = 1;
+        while (capacity < (std::size_t)max)
+            capacity <<= 1;
+        mask = capacity - 1;
+        cells = createArray<Cell>(resource, capacity);
+        for (std::size_t i = 0; i < capacity; i++)
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Destructor que libera la memoria utilizada por la cola.
+     */
+    ~MPMCQueue() {
+        destroyArray(resource, cells, capacity);
+    }
+
+    /**
+     * @brief Intenta insertar un elemento al final de la cola.
+     *
+     * @param element Elemento a insertar.
+     * @return true si se insertó, false si la cola estaba llena.
+     */
+    bool tryEnqueue(const E& element) {
+        std::size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = (std::intptr_t)sequence - (std::intptr_t)pos;
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->element = element;
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola, esperando si está llena.
+     *
+     * @param element Elemento a insertar.
+     */
+    void enqueue(const E& element) {
+        for (int attempt = 0; !tryEnqueue(element); attempt++)
+            spinWait(attempt);
+    }
+
+    /**
+     * @brief Intenta extraer el elemento del frente de la cola.
+     *
+     * @param element Se asigna el elemento extraído.
+     * @return true si se extrajo, false si la cola estaba vacía.
+     */
+    bool tryDequeue(E& element) {
+        std::size_t pos = dequeuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells[pos & mask];
+            std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            std::intptr_t diff = (std::intptr_t)sequence - (std::intptr_t)(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+        element = cell->element;
+        cell->sequence.store(pos + capacity, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Extrae el elemento del frente de la cola, esperando si está vacía.
+     *
+     * @return El elemento extraído.
+     */
+    E dequeue() {
+        E element;
+        for (int attempt = 0; !tryDequeue(element); attempt++)
+            spinWait(attempt);
+        return element;
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola.
+     */
+    void clear() {
+        E element;
+        while (tryDequeue(element)) {}
+    }
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     *
+     * @return true si la cola no contiene elementos, false en caso contrario.
+     */
+    bool isEmpty() {
+        return getSize() == 0;
+    }
+
+    /**
+     * @brief Retorna el número aproximado de elementos en la cola.
+     *
+     * @return La cantidad de elementos en la cola.
+     */
+    int getSize() {
+        std::size_t first = dequeuePos.load(std::memory_order_acquire);
+        std::size_t last = enqueuePos.load(std::memory_order_acquire);
+        return last > first ? (int)(last - first) : 0;
+    }
+
+    /**
+     * @brief Retorna la capacidad de la cola.
+     *
+     * @return La cantidad máxima de elementos que puede contener.
+     */
+    int getCapacity() {
+        return (int)capacity;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Imprime el contenido de la cola.
+     */
+    void print() {
+        cout << "[ ";
+        std::size_t last = enqueuePos.load();
+        for (std::size_t pos = dequeuePos.load(); pos < last; pos++)
+            cout << cells[pos & mask].element << " ";
+        cout << "]" << endl;
+    }
+};
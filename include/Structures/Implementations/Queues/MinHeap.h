@@ -3,15 +3,22 @@
  * @brief Este archivo contiene la implementación de la clase MinHeap, que representa un heap mínimo.
  * 
  * @author Profesor Mauricio Aviles Cisneros
+ * @author Mauricio González Prendas
  */
 
 #pragma once
 
 #define DEFAULT_MAX 1024
 
+#include <cstdint>
 #include <stdexcept>
 #include <iostream>
 #include <cmath>
+#include <utility>
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Common/Instrumentation.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Snapshot.h"
 
 using std::runtime_error;
 using std::cout;
@@ -23,103 +30,176 @@ using std::endl;
  * 
  * Un heap mínimo es una estructura de datos en la que el elemento más pequeño siempre está en la raíz.
  * Esta clase permite insertar elementos, eliminar el elemento mínimo, y realizar otras operaciones básicas.
+ *
+ * La aridad D es configurable: con D = 4 u 8 el árbol es más bajo y los hijos de un nodo
+ * son contiguos en memoria, lo que reduce los fallos de caché en heaps grandes a cambio
+ * de más comparaciones por nivel al bajar.
+ *
+ * Si se construye en modo creciente, en lugar de lanzar una excepción al llenarse duplica
+ * su capacidad (O(1) amortizado por inserción).
  * 
  * @tparam E Tipo de los elementos almacenados en el heap.
+ * @tparam D Cantidad de hijos por nodo (por defecto 2, heap binario).
  */
-template <typename E>
+template <typename E, int D = 2>
 class MinHeap {
+    static_assert(D >= 2, "La aridad del heap debe ser al menos 2.");
+
 private:
-    E* elements; ///< Arreglo que almacena los elementos del heap.
+    E* storage;  ///< Arreglo reservado, con espacio extra para alinear los grupos de hermanos.
+    int reserved; ///< Cantidad de elementos de storage.
+    E* elements; ///< Arreglo que almacena los elementos del heap (dentro de storage).
     int max;     ///< Capacidad máxima del heap.
     int size;    ///< Número actual de elementos en el heap.
+    bool growable; ///< Indica si el heap crece en lugar de llenarse.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
 
     /**
-     * @brief Realiza un sift-up para mantener la propiedad del heap.
-     * 
-     * @param pos Posición del elemento a mover hacia arriba.
+     * @brief Operaciones instrumentadas; su trabajo es la cantidad de niveles recorridos.
      */
-    void siftUp(int pos) {
-        while (pos != 0 && elements[pos] < elements[parent(pos)]) {
-            swap(pos, parent(pos));
-            pos = parent(pos);
-        }
+    enum Operation { INSERT, REMOVE, REPLACE_TOP, OPERATION_COUNT };
+
+    /**
+     * @brief Contadores instrumentados.
+     */
+    enum Counter { RESIZES, COUNTER_COUNT };
+
+    typedef Instrumentation<OPERATION_COUNT, COUNTER_COUNT> Instruments; ///< Política de instrumentación.
+    Instruments instrumentation; ///< Mediciones de las operaciones (vacías si no se compila con STRUCTURES_INSTRUMENTATION).
+
+    /**
+     * @brief Reserva el arreglo de elementos alineando los grupos de hermanos.
+     *
+     * Los hijos de pos ocupan las posiciones D * pos + 1 a D * pos + D. Si el tamaño
+     * de E divide al de una línea de caché, se reservan elementos extra y se desplaza
+     * el inicio del arreglo para que la posición 1 quede al inicio de una línea; así,
+     * cuando D * sizeof(E) también divide al tamaño de línea, cada grupo de hermanos
+     * queda dentro de una sola línea de caché.
+     *
+     * @param capacity Cantidad de elementos a reservar.
+     */
+    void allocate(int capacity) {
+        int padding = (CACHE_LINE_SIZE % sizeof(E) == 0) ? (int)(CACHE_LINE_SIZE / sizeof(E)) : 0;
+        reserved = capacity + padding;
+        storage = createArray<E>(resource, reserved);
+        int offset = 0;
+        while (offset < padding && ((std::uintptr_t)(storage + offset + 1)) % CACHE_LINE_SIZE != 0)
+            offset++;
+        elements = storage + (offset < padding ? offset : 0);
     }
 
     /**
-     * @brief Realiza un sift-down para mantener la propiedad del heap.
-     * 
-     * @param pos Posición del elemento a mover hacia abajo.
+     * @brief Cambia la capacidad del heap conservando los elementos.
+     *
+     * @param newMax Nueva capacidad, mayor o igual que la cantidad de elementos.
      */
-    void siftDown(int pos) {
-        while (!isLeaf(pos) && elements[pos] > elements[minChild(pos)]) {
-            int mChild = minChild(pos);
-            swap(pos, mChild);
-            pos = mChild;
-        }
+    void resize(int newMax) {
+        instrumentation.count(RESIZES);
+        E* oldStorage = storage;
+        E* oldElements = elements;
+        int oldReserved = reserved;
+        allocate(newMax);
+        for (int i = 0; i < size; i++)
+            elements[i] = std::move(oldElements[i]);
+        destroyArray(resource, oldStorage, oldReserved);
+        max = newMax;
     }
 
     /**
-     * @brief Obtiene la posición del padre de un nodo.
-     * 
-     * @param pos Posición del nodo.
-     * @return Posición del padre.
+     * @brief Garantiza espacio para reemplazar el contenido del heap por un lote.
+     *
+     * @param count Cantidad de elementos del lote.
+     * @throw runtime_error Si la cantidad es negativa o excede la capacidad de un heap no creciente.
      */
-    int parent(int pos) {
-        return (pos - 1) / 2;
+    void prepareBatch(int count) {
+        if (count < 0)
+            throw runtime_error("Invalid batch size.");
+        if (count > max) {
+            if (!growable)
+                throw runtime_error("Heap is full.");
+            size = 0;
+            resize(count);
+        }
     }
 
     /**
-     * @brief Obtiene la posición del hijo izquierdo de un nodo.
-     * 
-     * @param pos Posición del nodo.
-     * @return Posición del hijo izquierdo.
+     * @brief Restablece el orden de heap de todo el arreglo con el algoritmo de Floyd.
      */
-    int leftChild(int pos) {
-        return 2 * pos + 1;
+    void buildHeap() {
+        for (int pos = parent(size - 1); size > 1 && pos >= 0; pos--)
+            siftDown(pos);
     }
 
     /**
-     * @brief Obtiene la posición del hijo derecho de un nodo.
+     * @brief Realiza un sift-up para mantener la propiedad del heap.
+     *
+     * En lugar de intercambiar en cada nivel, el elemento se guarda aparte, los padres
+     * mayores se bajan un nivel y el elemento se escribe una sola vez en el hueco final.
      * 
-     * @param pos Posición del nodo.
-     * @return Posición del hijo derecho.
+     * @param pos Posición del elemento a mover hacia arriba.
+     * @return Cantidad de niveles que subió el elemento.
      */
-    int rightChild(int pos) {
-        return 2 * pos + 2;
+    int siftUp(int pos) {
+        E moving = std::move(elements[pos]);
+        int levels = 0;
+        while (pos != 0 && moving < elements[parent(pos)]) {
+            elements[pos] = std::move(elements[parent(pos)]);
+            pos = parent(pos);
+            levels++;
+        }
+        elements[pos] = std::move(moving);
+        return levels;
     }
 
     /**
-     * @brief Verifica si un nodo es una hoja.
+     * @brief Realiza un sift-down para mantener la propiedad del heap.
+     *
+     * En cada nivel se busca el menor de los D hijos; si es menor que el elemento,
+     * sube al hueco. El elemento se escribe una sola vez al final.
      * 
-     * @param pos Posición del nodo.
-     * @return true si el nodo es una hoja, false en caso contrario.
+     * @param pos Posición del elemento a mover hacia abajo.
+     * @return Cantidad de niveles que bajó el elemento.
      */
-    bool isLeaf(int pos) {
-        return leftChild(pos) >= size;
+    int siftDown(int pos) {
+        E moving = std::move(elements[pos]);
+        int levels = 0;
+        while (true) {
+            int first = firstChild(pos);
+            if (first >= size)
+                break;
+            int last = first + D < size ? first + D : size;
+            int best = first;
+            for (int child = first + 1; child < last; child++)
+                if (elements[child] < elements[best])
+                    best = child;
+            if (!(elements[best] < moving))
+                break;
+            elements[pos] = std::move(elements[best]);
+            pos = best;
+            levels++;
+        }
+        elements[pos] = std::move(moving);
+        return levels;
     }
 
     /**
-     * @brief Intercambia dos elementos en el heap.
+     * @brief Obtiene la posición del padre de un nodo.
      * 
-     * @param pos1 Posición del primer elemento.
-     * @param pos2 Posición del segundo elemento.
+     * @param pos Posición del nodo.
+     * @return Posición del padre.
      */
-    void swap(int pos1, int pos2) {
-        E temp = elements[pos1];
-        elements[pos1] = elements[pos2];
-        elements[pos2] = temp;
+    int parent(int pos) {
+        return (pos - 1) / D;
     }
 
     /**
-     * @brief Obtiene la posición del hijo con el valor mínimo.
+     * @brief Obtiene la posición del primero de los D hijos de un nodo.
      * 
      * @param pos Posición del nodo.
-     * @return Posición del hijo con el valor mínimo.
+     * @return Posición del primer hijo.
      */
-    int minChild(int pos) {
-        if (rightChild(pos) >= size || elements[leftChild(pos)] < elements[rightChild(pos)])
-            return leftChild(pos);
-        return rightChild(pos);
+    int firstChild(int pos) {
+        return D * pos + 1;
     }
 
 public:
@@ -127,35 +207,53 @@ public:
      * @brief Constructor de la clase MinHeap.
      * 
      * @param max Capacidad máxima del heap.
+     * @param growable Si es true, la capacidad se duplica cuando el heap se llena.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
      * @throw runtime_error Si la capacidad máxima es menor que 1.
      */
-    MinHeap(int max = DEFAULT_MAX) {
+    MinHeap(int max = DEFAULT_MAX, bool growable = false, MemoryResource* resource = defaultResource())
+        : resource(resource) {
         if (max < 1)
             throw runtime_error("Invalid max size.");
-        elements = new E[max];
+        allocate(max);
         size = 0;
         this->max = max;
+        this->growable = growable;
     }
 
     /**
      * @brief Destructor de la clase MinHeap.
      */
     ~MinHeap() {
-        delete[] elements;
+        destroyArray(resource, storage, reserved);
     }
 
     /**
      * @brief Inserta un elemento en el heap.
      * 
-     * @param element Elemento a insertar.
-     * @throw runtime_error Si el heap está lleno.
+     * @param element Elemento a insertar, que se copia.
+     * @throw runtime_error Si el heap está lleno y no es creciente.
      */
-    void insert(E element) {
-        if (size == max)
-            throw runtime_error("Heap is full.");
-        elements[size] = element;
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en el heap moviéndolo.
+     * 
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si el heap está lleno y no es creciente.
+     */
+    void insert(E&& element) {
+        typename Instruments::Scope scope(instrumentation, INSERT);
+        if (size == max) {
+            if (!growable)
+                throw runtime_error("Heap is full.");
+            resize(max * 2);
+        }
+        elements[size] = std::move(element);
         size++;
-        siftUp(size - 1);
+        scope.addWork(siftUp(size - 1));
     }
 
     /**
@@ -170,6 +268,20 @@ public:
         return elements[0];
     }
 
+    /**
+     * @brief Obtiene una referencia al primer elemento del heap (el mínimo), sin copiarlo.
+     *
+     * La referencia es válida hasta la siguiente modificación del heap.
+     * 
+     * @return Referencia constante al elemento mínimo.
+     * @throw runtime_error Si el heap está vacío.
+     */
+    const E& peek() {
+        if (size == 0)
+            throw runtime_error("Heap is empty.");
+        return elements[0];
+    }
+
     /**
      * @brief Elimina y devuelve el primer elemento del heap (el mínimo).
      * 
@@ -180,21 +292,183 @@ public:
         return remove(0);
     }
 
+    /**
+     * @brief Intenta eliminar el primer elemento del heap, sin lanzar excepciones si está vacío.
+     * 
+     * @param element Se asigna el elemento mínimo; no cambia si el heap está vacío.
+     * @return true si se eliminó un elemento, false si el heap estaba vacío.
+     */
+    bool tryRemoveFirst(E& element) {
+        if (size == 0)
+            return false;
+        element = remove(0);
+        return true;
+    }
+
     /**
      * @brief Elimina y devuelve un elemento en una posición específica.
+     *
+     * El último elemento ocupa el lugar del eliminado y se mueve hacia arriba o hacia
+     * abajo según sea menor que su nuevo padre o no.
      * 
      * @param pos Posición del elemento a eliminar.
      * @return El elemento eliminado.
      * @throw runtime_error Si la posición está fuera de los límites.
      */
     E remove(int pos) {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
         if (pos < 0 || pos >= size)
             throw runtime_error("Index out of bounds.");
 
-        swap(pos, size - 1);
+        E result = std::move(elements[pos]);
         size--;
-        siftDown(pos);
-        return elements[size];
+        if (pos != size) {
+            elements[pos] = std::move(elements[size]);
+            if (pos != 0 && elements[pos] < elements[parent(pos)])
+                scope.addWork(siftUp(pos));
+            else
+                scope.addWork(siftDown(pos));
+        }
+        return result;
+    }
+
+    /**
+     * @brief Inserta un elemento y luego extrae el mínimo, con un solo sift-down.
+     *
+     * Si el heap está vacío o el elemento no es mayor que el mínimo, el heap no cambia y
+     * se retorna el mismo elemento. Sirve para mantener los k mayores de una secuencia.
+     *
+     * @param element Elemento a insertar.
+     * @return El menor entre el elemento y el mínimo anterior del heap.
+     */
+    E pushPop(E element) {
+        if (size == 0 || !(elements[0] < element))
+            return element;
+        return replaceTop(std::move(element));
+    }
+
+    /**
+     * @brief Extrae el mínimo y luego inserta un elemento, con un solo sift-down.
+     *
+     * A diferencia de pushPop(), el elemento se inserta aunque sea menor que el mínimo.
+     *
+     * @param element Elemento a insertar.
+     * @return El mínimo anterior del heap.
+     * @throw runtime_error Si el heap está vacío.
+     */
+    E replaceTop(E element) {
+        typename Instruments::Scope scope(instrumentation, REPLACE_TOP);
+        if (size == 0)
+            throw runtime_error("Heap is empty.");
+        E result = std::move(elements[0]);
+        elements[0] = std::move(element);
+        scope.addWork(siftDown(0));
+        return result;
+    }
+
+    /**
+     * @brief Inserta varios elementos de un arreglo.
+     *
+     * Si el lote tiene al menos tantos elementos como el heap, se agregan al final y se
+     * reconstruye todo el heap con el algoritmo de Floyd (O(n + k)); si no, se insertan
+     * uno por uno con sift-up (O(k log n)).
+     *
+     * @param array Elementos a insertar.
+     * @param count Cantidad de elementos.
+     * @throw runtime_error Si la cantidad es negativa o no caben en un heap no creciente.
+     */
+    void insertBatch(const E* array, int count) {
+        if (count < 0)
+            throw runtime_error("Invalid batch size.");
+        if (size + count > max) {
+            if (!growable)
+                throw runtime_error("Heap is full.");
+            resize(size + count > max * 2 ? size + count : max * 2);
+        }
+        if (count >= size) {
+            for (int i = 0; i < count; i++)
+                elements[size + i] = array[i];
+            size += count;
+            buildHeap();
+        } else {
+            for (int i = 0; i < count; i++) {
+                elements[size] = array[i];
+                size++;
+                siftUp(size - 1);
+            }
+        }
+    }
+
+    /**
+     * @brief Extrae hasta k elementos en orden ascendente.
+     *
+     * @param k Cantidad máxima de elementos a extraer.
+     * @param out Arreglo de al menos k posiciones donde se guardan los elementos.
+     * @return Cantidad de elementos extraídos (k, o menos si el heap tenía menos).
+     * @throw runtime_error Si k es negativo.
+     */
+    int popN(int k, E* out) {
+        if (k < 0)
+            throw runtime_error("Invalid batch size.");
+        int count = k < size ? k : size;
+        for (int i = 0; i < count; i++)
+            out[i] = remove(0);
+        return count;
+    }
+
+    /**
+     * @brief Reemplaza el contenido del heap con los elementos de un arreglo.
+     *
+     * Utiliza el algoritmo de Floyd: copia los elementos y aplica sift-down desde el
+     * último nodo interno hasta la raíz, en O(n) en lugar de O(n log n).
+     *
+     * @param array Elementos a cargar.
+     * @param count Cantidad de elementos.
+     * @throw runtime_error Si la cantidad es negativa o excede la capacidad de un heap no creciente.
+     */
+    void heapify(const E* array, int count) {
+        prepareBatch(count);
+        for (int i = 0; i < count; i++)
+            elements[i] = array[i];
+        size = count;
+        buildHeap();
+    }
+
+    /**
+     * @brief Guarda los elementos en un archivo binario de instantánea (ver Snapshot.h).
+     *
+     * Se escribe el arreglo tal como está, en orden de heap. Sólo está disponible si E es
+     * trivialmente copiable o string.
+     *
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error Si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        SnapshotWriter writer(path, SNAPSHOT_SEQUENCE, 0, SnapshotCodec<E>::code(), 0, (uint64_t)size);
+        SnapshotCodec<E>::writeArray(writer, elements, size);
+        writer.finish();
+    }
+
+    /**
+     * @brief Reemplaza el contenido del heap por el de un archivo de instantánea.
+     *
+     * Copia el arreglo de una vez y lo reordena con el algoritmo de Floyd, de modo que
+     * acepta cualquier secuencia guardada; si proviene de save() ya está en orden de heap
+     * y el recorrido sólo compara.
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error Si no se puede abrir el archivo, no guarda una secuencia de E o
+     *        excede la capacidad de un heap no creciente.
+     */
+    void load(const string& path) {
+        SnapshotFile file(path, SNAPSHOT_SEQUENCE, SnapshotCodec<E>::code(), 0, true);
+        typename SnapshotCodec<E>::Column column = file.column<E>();
+        column.validate();
+        int count = file.getCount();
+        prepareBatch(count);
+        column.copyTo(elements);
+        size = count;
+        buildHeap();
     }
 
     /**
@@ -222,6 +496,39 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo del heap.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Obtiene la capacidad actual del heap.
+     *
+     * @return Cantidad de elementos que caben sin crecer.
+     */
+    int getCapacity() {
+        return max;
+    }
+
+    /**
+     * @brief Obtiene las mediciones del heap.
+     *
+     * Si no se compiló con STRUCTURES_INSTRUMENTATION, la instantánea está vacía.
+     * El trabajo de cada operación es la cantidad de niveles que subió o bajó el elemento
+     * movido; replaceTop incluye las llamadas a pushPop que reemplazan el mínimo.
+     *
+     * @return Instantánea de las mediciones.
+     */
+    Stats stats() const {
+        static const char* const operations[] = { "insert", "remove", "replaceTop" };
+        static const char* const counters[] = { "resizes" };
+        return instrumentation.snapshot(operations, counters);
+    }
+
     /**
      * @brief Imprime el contenido del heap como si fuera un árbol.
      */
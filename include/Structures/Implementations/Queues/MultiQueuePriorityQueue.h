@@ -0,0 +1,418 @@
+/**
+ * @file MultiQueuePriorityQueue.h
+ * @brief Implementación de una cola de prioridad concurrente de tipo MultiQueue.
+ *
+ * Reparte los elementos entre varios heaps independientes, cada uno con su propio
+ * candado, para que varios hilos puedan insertar y extraer sin competir por un único
+ * candado global.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Abstract/PriorityQueue.h"
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Common/KVPair.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Implementations/Queues/MinHeap.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola de prioridad concurrente con varios heaps (MultiQueue).
+ *
+ * Se usan QUEUES_PER_THREAD heaps por cada hilo esperado. insert() agrega el elemento a
+ * un heap elegido al azar, probando con otro si su candado está ocupado. En modo relajado
+ * (el predeterminado), removeMin() elige dos heaps al azar y extrae del que tenga el menor
+ * mínimo, así que no siempre retorna el mínimo global, pero con alta probabilidad retorna
+ * uno de los O(cantidad de heaps) menores, y los hilos casi nunca compiten por el mismo
+ * candado. El mínimo de cada heap se publica en una variable atómica para compararlos
+ * sin tomar su candado.
+ *
+ * En modo estricto, removeMin() y min() toman los candados de todos los heaps (siempre en
+ * el mismo orden) y retornan el mínimo global, como una cola con un candado único; sirve
+ * cuando el orden exacto importa más que la escalabilidad.
+ *
+ * getSize() e isEmpty() son aproximados mientras otros hilos modifican la cola. Los hilos
+ * consumidores deben usar tryRemoveMin(), ya que removeMin() lanza una excepción si la
+ * cola está vacía.
+ *
+ * @tparam E Tipo de dato almacenado en la cola de prioridad.
+ * @tparam D Aridad de los heaps internos (por defecto 4).
+ */
+template <typename E, int D = 4>
+class MultiQueuePriorityQueue : public PriorityQueue<E> {
+private:
+    static const int QUEUES_PER_THREAD = 2;  ///< Heaps por cada hilo esperado.
+    static const int INITIAL_CAPACITY = 64;  ///< Capacidad inicial de cada heap.
+    static const long long EMPTY = LLONG_MAX; ///< Mínimo publicado por un heap vacío.
+
+    /**
+     * @brief Heap con su candado y su mínimo publicado, en su propia línea de caché.
+     */
+    struct alignas(CACHE_LINE_SIZE) Shard {
+        std::atomic<bool> locked;           ///< Candado de espera activa del heap.
+        std::atomic<long long> top;         ///< Prioridad mínima del heap, o EMPTY.
+        MinHeap<KVPair<int, E>, D>* heap;   ///< Elementos del heap con su prioridad como clave.
+    };
+
+    Shard* shards;          ///< Arreglo de heaps.
+    int count;              ///< Cantidad de heaps.
+    bool strict;            ///< Indica si removeMin() retorna siempre el mínimo global.
+    std::atomic<int> size;  ///< Número aproximado de elementos.
+    MemoryResource* resource; ///< Recurso del que se obtienen los heaps y sus arreglos.
+
+    /**
+     * @brief Genera un número pseudoaleatorio con un estado xorshift propio de cada hilo.
+     */
+    static uint32_t nextRandom() {
+        static std::atomic<uint32_t> seeds(0x9E3779B9u);
+        thread_local uint32_t state = seeds.fetch_add(0x9E3779B9u) | 1;
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    /**
+     * @brief Elige un heap al azar.
+     */
+    Shard* randomShard() {
+        return &shards[(int)(((uint64_t)nextRandom() * (uint64_t)count) >> 32)];
+    }
+
+    /**
+     * @brief Intenta tomar el candado de un heap sin esperar.
+     */
+    static bool tryLock(Shard* shard) {
+        return !shard->locked.load(std::memory_order_relaxed) &&
+               !shard->locked.exchange(true, std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Toma el candado de un heap, esperando si está ocupado.
+     */
+    static void lock(Shard* shard) {
+        for (int attempt = 0; !tryLock(shard); attempt++)
+            spinWait(attempt);
+    }
+
+    /**
+     * @brief Libera el candado de un heap.
+     */
+    static void unlock(Shard* shard) {
+        shard->locked.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Toma los candados de todos los heaps, en orden.
+     */
+    void lockAll() {
+        for (int i = 0; i < count; i++)
+            lock(&shards[i]);
+    }
+
+    /**
+     * @brief Libera los candados de todos los heaps.
+     */
+    void unlockAll() {
+        for (int i = 0; i < count; i++)
+            unlock(&shards[i]);
+    }
+
+    /**
+     * @brief Publica el mínimo actual de un heap cuyo candado se tiene.
+     */
+    static void publishTop(Shard* shard) {
+        long long top = shard->heap->isEmpty() ? EMPTY : (long long)shard->heap->peek().key;
+        shard->top.store(top, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene el heap con el menor mínimo publicado.
+     *
+     * @return El heap, o nullptr si todos están vacíos.
+     */
+    Shard* bestShard() {
+        Shard* best = nullptr;
+        long long bestTop = EMPTY;
+        for (int i = 0; i < count; i++) {
+            long long top = shards[i].top.load(std::memory_order_relaxed);
+            if (top < bestTop) {
+                bestTop = top;
+                best = &shards[i];
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Extrae el mínimo de un heap cuyo candado se tiene.
+     */
+    E popFrom(Shard* shard) {
+        E element = shard->heap->removeFirst().value;
+        publishTop(shard);
+        size.fetch_sub(1, std::memory_order_relaxed);
+        return element;
+    }
+
+    /**
+     * @brief Extrae el mínimo global tomando todos los candados.
+     */
+    bool tryRemoveStrict(E& element) {
+        lockAll();
+        Shard* best = bestShard();
+        if (best != nullptr)
+            element = popFrom(best);
+        unlockAll();
+        return best != nullptr;
+    }
+
+public:
+    /**
+     * @brief Constructor de la cola para una cantidad esperada de hilos.
+     *
+     * @param threads Cantidad de hilos que usarán la cola a la vez.
+     * @param strict Si es true, removeMin() y min() retornan siempre el mínimo global.
+     * @param resource Recurso del que se obtienen los heaps (ver MemoryResource.h). Los heaps
+     *                 crecen desde varios hilos a la vez, por lo que debe admitir llamadas
+     *                 concurrentes, como newDeleteResource().
+     * @throws runtime_error Si la cantidad de hilos es menor que 1.
+     */
+    MultiQueuePriorityQueue(int threads, bool strict = false, MemoryResource* resource = defaultResource())
+        : size(0), resource(resource) {
+        if (threads < 1)
+            throw runtime_error("Invalid number of threads.");
+        count = threads * QUEUES_PER_THREAD;
+        this->strict = strict;
+        shards = createArray<Shard>(resource, count);
+        for (int i = 0; i < count; i++) {
+            shards[i].locked.store(false);
+            shards[i].top.store(EMPTY);
+            shards[i].heap = create<MinHeap<KVPair<int, E>, D>>(resource, (int)INITIAL_CAPACITY, true, resource);
+        }
+    }
+
+    /**
+     * @brief Destructor que libera los heaps.
+     */
+    ~MultiQueuePriorityQueue() {
+        for (int i = 0; i < count; i++)
+            destroy(resource, shards[i].heap);
+        destroyArray(resource, shards, count);
+    }
+
+    /**
+     * @brief Inserta un elemento con la prioridad indicada en un heap elegido al azar.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(const E& element, int priority) {
+        insert(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento moviéndolo, con la prioridad indicada, en un heap elegido al azar.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(E&& element, int priority) {
+        Shard* shard = randomShard();
+        for (int attempt = 0; !tryLock(shard); attempt++) {
+            spinWait(attempt);
+            shard = randomShard();
+        }
+        shard->heap->insert(KVPair<int, E>(priority, std::move(element)));
+        if (priority < shard->top.load(std::memory_order_relaxed))
+            shard->top.store(priority, std::memory_order_relaxed);
+        unlock(shard);
+        size.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Intenta extraer un elemento de prioridad mínima (o cercana a la mínima).
+     *
+     * En modo relajado compara el mínimo de dos heaps al azar y extrae del menor; si
+     * ambos están vacíos, busca en todos. Sólo retorna false si no encontró ningún heap
+     * con elementos.
+     *
+     * @param element Variable donde se guarda el elemento extraído.
+     * @return true si se extrajo un elemento, false si la cola estaba vacía.
+     */
+    bool tryRemoveMin(E& element) {
+        if (strict)
+            return tryRemoveStrict(element);
+        for (int attempt = 0;; attempt++) {
+            Shard* first = randomShard();
+            Shard* second = randomShard();
+            long long firstTop = first->top.load(std::memory_order_relaxed);
+            long long secondTop = second->top.load(std::memory_order_relaxed);
+            Shard* shard = secondTop < firstTop ? second : first;
+            if ((secondTop < firstTop ? secondTop : firstTop) == EMPTY) {
+                shard = bestShard();
+                if (shard == nullptr)
+                    return false;
+            }
+            if (tryLock(shard)) {
+                if (!shard->heap->isEmpty()) {
+                    element = popFrom(shard);
+                    unlock(shard);
+                    return true;
+                }
+                unlock(shard);
+            }
+            spinWait(attempt);
+        }
+    }
+
+    /**
+     * @brief Elimina y retorna un elemento de prioridad mínima (o cercana a la mínima).
+     *
+     * @return El elemento extraído.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    E removeMin() {
+        E element;
+        if (!tryRemoveMin(element))
+            throw runtime_error("Queue is empty.");
+        return element;
+    }
+
+    /**
+     * @brief Obtiene el elemento del heap con el menor mínimo sin eliminarlo.
+     *
+     * En modo relajado, otro hilo puede extraerlo o insertar uno menor en cualquier momento.
+     *
+     * @return El elemento de menor prioridad.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    E min() {
+        if (strict) {
+            lockAll();
+            Shard* best = bestShard();
+            if (best == nullptr) {
+                unlockAll();
+                throw runtime_error("Queue is empty.");
+            }
+            E element = best->heap->peek().value;
+            unlockAll();
+            return element;
+        }
+        for (int attempt = 0;; attempt++) {
+            Shard* best = bestShard();
+            if (best == nullptr)
+                throw runtime_error("Queue is empty.");
+            lock(best);
+            if (!best->heap->isEmpty()) {
+                E element = best->heap->peek().value;
+                unlock(best);
+                return element;
+            }
+            unlock(best);
+            spinWait(attempt);
+        }
+    }
+
+    /**
+     * @brief Obtiene una referencia al elemento del heap con el menor mínimo, sin copiarlo.
+     *
+     * La referencia apunta dentro de un heap cuyo candado ya se liberó, por lo que sólo
+     * es válida mientras ningún otro hilo modifique la cola; con hilos concurrentes debe
+     * usarse min() o tryRemoveMin().
+     *
+     * @return Referencia constante al elemento de menor prioridad.
+     * @throws runtime_error Si la cola está vacía.
+     */
+    const E& peek() {
+        lockAll();
+        Shard* best = bestShard();
+        if (best == nullptr) {
+            unlockAll();
+            throw runtime_error("Queue is empty.");
+        }
+        const E& element = best->heap->peek().value;
+        unlockAll();
+        return element;
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola de prioridad.
+     */
+    void clear() {
+        lockAll();
+        for (int i = 0; i < count; i++) {
+            shards[i].heap->clear();
+            publishTop(&shards[i]);
+        }
+        size.store(0, std::memory_order_relaxed);
+        unlockAll();
+    }
+
+    /**
+     * @brief Retorna el número aproximado de elementos en la cola de prioridad.
+     *
+     * @return Cantidad de elementos en la cola.
+     */
+    int getSize() {
+        return size.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtiene la memoria de los heaps.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si la cola de prioridad está vacía (aproximado).
+     *
+     * @return true si la cola está vacía, false en caso contrario.
+     */
+    bool isEmpty() {
+        return getSize() == 0;
+    }
+
+    /**
+     * @brief Retorna la cantidad de heaps internos.
+     *
+     * @return Cantidad de heaps.
+     */
+    int getQueueCount() {
+        return count;
+    }
+
+    /**
+     * @brief Verifica si la cola está en modo estricto.
+     *
+     * @return true si removeMin() retorna siempre el mínimo global.
+     */
+    bool isStrict() {
+        return strict;
+    }
+
+    /**
+     * @brief Imprime el contenido de cada heap.
+     */
+    void print() {
+        lockAll();
+        for (int i = 0; i < count; i++) {
+            cout << "Queue " << i << ": ";
+            shards[i].heap->print();
+        }
+        unlockAll();
+    }
+};
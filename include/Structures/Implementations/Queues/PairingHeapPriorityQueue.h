@@ -0,0 +1,406 @@
+/**
+ * @file PairingHeapPriorityQueue.h
+ * @brief Cola de prioridad sobre un pairing heap, con decreaseKey en O(1) amortizado.
+ *
+ * Cada inserción retorna un handle (el nodo del elemento) con el que luego se puede
+ * cambiar la prioridad del elemento o eliminarlo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "Structures/Abstract/PriorityQueue.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Nodes/PairingNode.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola de prioridad direccionable implementada con un pairing heap.
+ *
+ * El heap es un árbol general en el que cada nodo tiene prioridad menor o igual que sus
+ * hijos. Insertar y reducir una prioridad sólo enlazan un árbol con la raíz (O(1));
+ * removeMin() combina los hijos de la raíz en dos pasadas (O(log n) amortizado). Por eso
+ * rinde mejor que un heap binario cuando hay muchas llamadas a decreaseKey(), como en
+ * Dijkstra.
+ *
+ * Un handle es el puntero al nodo del elemento y es válido hasta que el elemento sale de
+ * la cola (por removeMin(), erase() o clear()).
+ *
+ * @tparam E Tipo de dato almacenado en la cola de prioridad.
+ */
+template <typename E>
+class PairingHeapPriorityQueue : public PriorityQueue<E> {
+public:
+    typedef PairingNode<E>* Handle; ///< Identificador de un elemento de la cola.
+
+private:
+    PairingNode<E>* root; ///< Raíz del heap.
+    int size;             ///< Número de elementos en la cola.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
+
+    /**
+     * @brief Enlaza dos árboles: la raíz de mayor prioridad pasa a ser el primer hijo de la otra.
+     *
+     * Ambas raíces deben tener next y previous en nullptr.
+     *
+     * @return La raíz del árbol resultante.
+     */
+    static PairingNode<E>* meld(PairingNode<E>* first, PairingNode<E>* second) {
+        if (first == nullptr)
+            return second;
+        if (second == nullptr)
+            return first;
+        if (second->priority < first->priority) {
+            PairingNode<E>* temp = first;
+            first = second;
+            second = temp;
+        }
+        second->previous = first;
+        second->next = first->child;
+        if (first->child != nullptr)
+            first->child->previous = second;
+        first->child = second;
+        return first;
+    }
+
+    /**
+     * @brief Combina una lista de hermanos en un solo árbol (método de dos pasadas).
+     *
+     * La primera pasada enlaza los hermanos de dos en dos de izquierda a derecha y apila
+     * los resultados; la segunda los enlaza de derecha a izquierda.
+     *
+     * @param first Primer nodo de la lista de hermanos.
+     * @return La raíz del árbol resultante.
+     */
+    static PairingNode<E>* combine(PairingNode<E>* first) {
+        PairingNode<E>* stack = nullptr;
+        while (first != nullptr) {
+            PairingNode<E>* a = first;
+            PairingNode<E>* b = a->next;
+            a->previous = nullptr;
+            if (b == nullptr) {
+                a->next = stack;
+                stack = a;
+                break;
+            }
+            first = b->next;
+            a->next = b->next = b->previous = nullptr;
+            PairingNode<E>* pair = meld(a, b);
+            pair->next = stack;
+            stack = pair;
+        }
+        PairingNode<E>* result = nullptr;
+        while (stack != nullptr) {
+            PairingNode<E>* tree = stack;
+            stack = tree->next;
+            tree->next = nullptr;
+            result = meld(tree, result);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Separa un subárbol (que no es la raíz) de su padre y hermanos.
+     *
+     * @param node Raíz del subárbol a separar.
+     */
+    static void detach(PairingNode<E>* node) {
+        if (node->previous->child == node)
+            node->previous->child = node->next;
+        else
+            node->previous->next = node->next;
+        if (node->next != nullptr)
+            node->next->previous = node->previous;
+        node->next = node->previous = nullptr;
+    }
+
+    /**
+     * @brief Verifica que un handle no sea nulo.
+     *
+     * @throw runtime_error Si el handle es nulo.
+     */
+    static void checkHandle(Handle handle) {
+        if (handle == nullptr)
+            throw runtime_error("Invalid handle.");
+    }
+
+    /**
+     * @brief Agrega a una lista los nodos de un árbol.
+     */
+    static void collect(PairingNode<E>* node, std::vector<PairingNode<E>*>& nodes) {
+        std::vector<PairingNode<E>*> pending;
+        if (node != nullptr)
+            pending.push_back(node);
+        while (!pending.empty()) {
+            PairingNode<E>* current = pending.back();
+            pending.pop_back();
+            nodes.push_back(current);
+            for (PairingNode<E>* child = current->child; child != nullptr; child = child->next)
+                pending.push_back(child);
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor por defecto. Inicializa una cola vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
+     */
+    explicit PairingHeapPriorityQueue(MemoryResource* resource = defaultResource()) : resource(resource) {
+        root = nullptr;
+        size = 0;
+    }
+
+    /**
+     * @brief Destructor que libera los nodos de la cola.
+     */
+    ~PairingHeapPriorityQueue() {
+        clear();
+    }
+
+    /**
+     * @brief Inserta un elemento y retorna su handle.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @return Handle del elemento insertado.
+     */
+    Handle push(const E& element, int priority) {
+        return push(E(element), priority);
+    }
+
+    /**
+     * @brief Inserta un elemento moviéndolo y retorna su handle.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     * @return Handle del elemento insertado.
+     */
+    Handle push(E&& element, int priority) {
+        PairingNode<E>* node = create<PairingNode<E>>(resource, std::move(element), priority);
+        root = meld(root, node);
+        size++;
+        return node;
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(const E& element, int priority) {
+        push(element, priority);
+    }
+
+    /**
+     * @brief Inserta un elemento en la cola de prioridad moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @param priority Prioridad del elemento (menor valor significa mayor prioridad).
+     */
+    void insert(E&& element, int priority) {
+        push(std::move(element), priority);
+    }
+
+    /**
+     * @brief Obtiene el elemento con la menor prioridad sin eliminarlo.
+     *
+     * @return Elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    E min() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return root->element;
+    }
+
+    /**
+     * @brief Obtiene una referencia al elemento con la menor prioridad, sin copiarlo.
+     *
+     * @return Referencia constante al elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    const E& peek() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return root->element;
+    }
+
+    /**
+     * @brief Obtiene la prioridad del elemento con la menor prioridad.
+     *
+     * @return La menor prioridad de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    int minPriority() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return root->priority;
+    }
+
+    /**
+     * @brief Obtiene el handle del elemento con la menor prioridad.
+     *
+     * @return Handle del elemento en el frente de la cola.
+     * @throw runtime_error Si la cola está vacía.
+     */
+    Handle minHandle() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        return root;
+    }
+
+    /**
+     * @brief Elimina y retorna el elemento con la menor prioridad.
+     *
+     * @return Elemento con la mayor prioridad (menor clave).
+     * @throw runtime_error Si la cola está vacía.
+     */
+    E removeMin() {
+        if (size == 0)
+            throw runtime_error("Queue is empty.");
+        PairingNode<E>* old = root;
+        root = combine(root->child);
+        E result = std::move(old->element);
+        destroy(resource, old);
+        size--;
+        return result;
+    }
+
+    /**
+     * @brief Reduce la prioridad de un elemento.
+     *
+     * @param handle Handle del elemento.
+     * @param priority Nueva prioridad, que no puede ser mayor que la actual.
+     * @throw runtime_error Si el handle es nulo o la prioridad es mayor que la actual.
+     */
+    void decreaseKey(Handle handle, int priority) {
+        checkHandle(handle);
+        if (handle->priority < priority)
+            throw runtime_error("Invalid priority.");
+        handle->priority = priority;
+        if (handle != root) {
+            detach(handle);
+            root = meld(root, handle);
+        }
+    }
+
+    /**
+     * @brief Cambia la prioridad de un elemento, en cualquier dirección.
+     *
+     * Aumentar la prioridad separa a los hijos del nodo, por lo que cuesta O(log n)
+     * amortizado.
+     *
+     * @param handle Handle del elemento.
+     * @param priority Nueva prioridad.
+     * @throw runtime_error Si el handle es nulo.
+     */
+    void changePriority(Handle handle, int priority) {
+        checkHandle(handle);
+        if (priority <= handle->priority) {
+            decreaseKey(handle, priority);
+            return;
+        }
+        bool wasRoot = handle == root;
+        if (!wasRoot)
+            detach(handle);
+        PairingNode<E>* children = combine(handle->child);
+        handle->child = nullptr;
+        handle->priority = priority;
+        root = wasRoot ? children : meld(root, children);
+        root = meld(root, handle);
+    }
+
+    /**
+     * @brief Elimina un elemento cualquiera de la cola.
+     *
+     * @param handle Handle del elemento.
+     * @return El elemento eliminado.
+     * @throw runtime_error Si el handle es nulo.
+     */
+    E erase(Handle handle) {
+        checkHandle(handle);
+        if (handle == root)
+            return removeMin();
+        detach(handle);
+        root = meld(root, combine(handle->child));
+        E result = std::move(handle->element);
+        destroy(resource, handle);
+        size--;
+        return result;
+    }
+
+    /**
+     * @brief Obtiene la prioridad actual de un elemento.
+     *
+     * @param handle Handle del elemento.
+     * @return La prioridad del elemento.
+     * @throw runtime_error Si el handle es nulo.
+     */
+    int getPriority(Handle handle) {
+        checkHandle(handle);
+        return handle->priority;
+    }
+
+    /**
+     * @brief Elimina todos los elementos de la cola de prioridad.
+     *
+     * Todos los handles dejan de ser válidos.
+     */
+    void clear() {
+        std::vector<PairingNode<E>*> nodes;
+        collect(root, nodes);
+        for (size_t i = 0; i < nodes.size(); i++)
+            destroy(resource, nodes[i]);
+        root = nullptr;
+        size = 0;
+    }
+
+    /**
+     * @brief Retorna el número de elementos en la cola de prioridad.
+     *
+     * @return Cantidad de elementos en la cola.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si la cola de prioridad está vacía.
+     *
+     * @return true si la cola está vacía, false en caso contrario.
+     */
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    /**
+     * @brief Imprime los pares (prioridad, elemento) recorriendo el árbol en preorden.
+     */
+    void print() {
+        std::vector<PairingNode<E>*> nodes;
+        collect(root, nodes);
+        cout << "[ ";
+        for (size_t i = 0; i < nodes.size(); i++)
+            cout << "(" << nodes[i]->priority << ", " << nodes[i]->element << ") ";
+        cout << "]" << endl;
+    }
+};
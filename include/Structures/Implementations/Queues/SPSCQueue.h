@@ -0,0 +1,286 @@
+/**
+ * @file SPSCQueue.h
+ * @brief Implementación de una cola sin bloqueos para un productor y un consumidor.
+ *
+ * Utiliza un arreglo circular de capacidad potencia de dos, como ArrayQueue, pero con
+ * índices atómicos para que un hilo inserte y otro extraiga al mismo tiempo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Common/MemoryResource.h"
+
+#define DEFAULT_MAX 1024
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Cola circular sin bloqueos para exactamente un productor y un consumidor.
+ *
+ * Los índices head (siguiente a extraer) y tail (siguiente a escribir) crecen sin
+ * límite y se reducen a una posición con una máscara, por lo que la capacidad se
+ * redondea a la siguiente potencia de dos. Cada índice está en su propia línea de
+ * caché junto con la copia que su dueño guarda del índice del otro hilo; esa copia
+ * sólo se actualiza cuando la cola parece llena (productor) o vacía (consumidor), así
+ * que en estado estable ningún hilo lee la línea de caché que escribe el otro.
+ *
+ * enqueue(), tryEnqueue() y enqueueN() sólo pueden llamarse desde el hilo productor;
+ * dequeue(), tryDequeue(), dequeueN() y frontValue() sólo desde el hilo consumidor.
+ * getSize() e isEmpty() pueden llamarse desde cualquier hilo, pero su resultado es
+ * sólo aproximado mientras el otro hilo trabaja.
+ *
+ * @tparam E Tipo de dato almacenado en la cola.
+ */
+template <typename E>
+class SPSCQueue {
+private:
+    E* elements;           ///< Arreglo circular de elementos.
+    std::size_t capacity;  ///< Capacidad de la cola (potencia de dos).
+    std::size_t mask;      ///< capacity - 1, para reducir un índice a una posición.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head; ///< Siguiente índice a extraer.
+    std::size_t cachedTail; ///< Última copia de tail que leyó el consumidor.
+
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail; ///< Siguiente índice a escribir.
+    std::size_t cachedHead; ///< Última copia de head que leyó el productor.
+
+    /**
+     * @brief Obtiene cuántos espacios libres ve el productor, refrescando head si hace falta.
+     *
+     * @param t Valor actual de tail.
+     * @param wanted Cantidad de espacios que se desean.
+     * @return Cantidad de espacios libres.
+     */
+    std::size_t freeSlots(std::size_t t, std::size_t wanted) {
+        std::size_t available = capacity - (t - cachedHead);
+        if (available < wanted) {
+            cachedHead = head.load(std::memory_order_acquire);
+            available = capacity - (t - cachedHead);
+        }
+        return available;
+    }
+
+    /**
+     * @brief Obtiene cuántos elementos ve el consumidor, refrescando tail si hace falta.
+     *
+     * @param h Valor actual de head.
+     * @param wanted Cantidad de elementos que se desean.
+     * @return Cantidad de elementos disponibles.
+     */
+    std::size_t usedSlots(std::size_t h, std::size_t wanted) {
+        std::size_t available = cachedTail - h;
+        if (available < wanted) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            available = cachedTail - h;
+        }
+        return available;
+    }
+
+public:
+    /**
+     * @brief Constructor de copia (eliminado).
+     */
+    SPSCQueue(const SPSCQueue<E>& other) = delete;
+
+    /**
+     * @brief Operador de asignación (eliminado).
+     */
+    void operator =(const SPSCQueue<E>& other) = delete;
+
+    /**
+     * @brief Constructor de la cola con capacidad mínima especificada.
+     *
+     * @param max Capacidad mínima; se redondea a la siguiente potencia de dos.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
+     * @throw runtime_error si la capacidad es menor que 1.
+     */
+    SPSCQueue(int max = DEFAULT_MAX, MemoryResource* resource = defaultResource())
+        : resource(resource), head(0), cachedTail(0), tail(0), cachedHead(0) {
+        if (max < 1)
+            throw runtime_error("Invalid max size.");
+        capacity = 1;
+        while (capacity < (std::size_t)max)
+            capacity <<= 1;
+        mask = capacity - 1;
+        elements = createArray<E>(resource, capacity);
+    }
+
+    /**
+     * @brief Destructor que libera la memoria utilizada por la cola.
+     */
+    ~SPSCQueue() {
+        destroyArray(resource, elements, capacity);
+    }
+
+    /**
+     * @brief Intenta insertar un elemento al final de la cola (sólo productor).
+     *
+     * @param element Elemento a insertar.
+     * @return true si se insertó, false si la cola estaba llena.
+     */
+    bool tryEnqueue(const E& element) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (freeSlots(t, 1) == 0)
+            return false;
+        elements[t & mask] = element;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Inserta un elemento al final de la cola, esperando si está llena (sólo productor).
+     *
+     * @param element Elemento a insertar.
+     */
+    void enqueue(const E& element) {
+        for (int attempt = 0; !tryEnqueue(element); attempt++)
+            spinWait(attempt);
+    }
+
+    /**
+     * @brief Inserta hasta count elementos al final de la cola (sólo productor).
+     *
+     * Los elementos se publican juntos con una sola escritura de tail. No espera:
+     * inserta tantos como quepan.
+     *
+     * @param items Elementos a insertar.
+     * @param count Cantidad de elementos.
+     * @return Cantidad de elementos insertados.
+     */
+    int enqueueN(const E* items, int count) {
+        if (count <= 0)
+            return 0;
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        std::size_t n = freeSlots(t, (std::size_t)count);
+        if (n > (std::size_t)count)
+            n = (std::size_t)count;
+        for (std::size_t i = 0; i < n; i++)
+            elements[(t + i) & mask] = items[i];
+        tail.store(t + n, std::memory_order_release);
+        return (int)n;
+    }
+
+    /**
+     * @brief Intenta extraer el elemento del frente de la cola (sólo consumidor).
+     *
+     * @param element Se asigna el elemento extraído.
+     * @return true si se extrajo, false si la cola estaba vacía.
+     */
+    bool tryDequeue(E& element) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (usedSlots(h, 1) == 0)
+            return false;
+        element = elements[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Extrae el elemento del frente de la cola, esperando si está vacía (sólo consumidor).
+     *
+     * @return El elemento extraído.
+     */
+    E dequeue() {
+        E element;
+        for (int attempt = 0; !tryDequeue(element); attempt++)
+            spinWait(attempt);
+        return element;
+    }
+
+    /**
+     * @brief Extrae hasta count elementos del frente de la cola (sólo consumidor).
+     *
+     * Los espacios se liberan juntos con una sola escritura de head. No espera:
+     * extrae tantos como haya.
+     *
+     * @param items Arreglo donde se copian los elementos extraídos.
+     * @param count Cantidad máxima de elementos a extraer.
+     * @return Cantidad de elementos extraídos.
+     */
+    int dequeueN(E* items, int count) {
+        if (count <= 0)
+            return 0;
+        std::size_t h = head.load(std::memory_order_relaxed);
+        std::size_t n = usedSlots(h, (std::size_t)count);
+        if (n > (std::size_t)count)
+            n = (std::size_t)count;
+        for (std::size_t i = 0; i < n; i++)
+            items[i] = elements[(h + i) & mask];
+        head.store(h + n, std::memory_order_release);
+        return (int)n;
+    }
+
+    /**
+     * @brief Retorna el elemento del frente de la cola sin extraerlo (sólo consumidor).
+     *
+     * @return Elemento en el frente de la cola.
+     * @throw runtime_error si la cola está vacía.
+     */
+    E frontValue() {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (usedSlots(h, 1) == 0)
+            throw runtime_error("Queue is empty.");
+        return elements[h & mask];
+    }
+
+    /**
+     * @brief Verifica si la cola está vacía.
+     *
+     * @return true si la cola no contiene elementos, false en caso contrario.
+     */
+    bool isEmpty() {
+        return getSize() == 0;
+    }
+
+    /**
+     * @brief Retorna el número aproximado de elementos en la cola.
+     *
+     * @return La cantidad de elementos en la cola.
+     */
+    int getSize() {
+        std::size_t h = head.load(std::memory_order_acquire);
+        std::size_t t = tail.load(std::memory_order_acquire);
+        return t > h ? (int)(t - h) : 0;
+    }
+
+    /**
+     * @brief Retorna la capacidad de la cola.
+     *
+     * @return La cantidad máxima de elementos que puede contener.
+     */
+    int getCapacity() {
+        return (int)capacity;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo de la cola.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Imprime el contenido de la cola.
+     *
+     * Sólo debe llamarse mientras ningún otro hilo utiliza la cola.
+     */
+    void print() {
+        cout << "[ ";
+        std::size_t t = tail.load(std::memory_order_acquire);
+        for (std::size_t i = head.load(std::memory_order_acquire); i < t; i++)
+            cout << elements[i & mask] << " ";
+        cout << "]" << endl;
+    }
+};
@@ -0,0 +1,402 @@
+/**
+ * @file TimingWheel.h
+ * @brief Implementación de una rueda de tiempo jerárquica para programar temporizadores.
+ *
+ * Programar, cancelar y reprogramar un temporizador cuestan O(1), y avanzar el reloj
+ * salta directamente a la siguiente ranura ocupada en lugar de recorrer tick por tick.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <climits>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Common/Nodes/TimerNode.h"
+
+using std::runtime_error;
+using std::cout;
+using std::endl;
+
+/**
+ * @brief Rueda de tiempo jerárquica (hierarchical timing wheel).
+ *
+ * El tiempo se mide en ticks enteros. Hay LEVELS niveles de SLOTS ranuras: el nivel l
+ * corresponde al dígito l del tick en base 64, así que once niveles cubren los 64 bits.
+ * Un temporizador que vence en d se guarda en el nivel del dígito más alto en que d
+ * difiere del tick actual, en la ranura de ese dígito de d. Cuando el reloj llega al
+ * inicio del bloque de una ranura de nivel l > 0, sus temporizadores se reubican en
+ * niveles más bajos (cascada); los de la ranura de nivel 0 del tick actual vencen. Cada
+ * temporizador baja a lo sumo LEVELS veces, por lo que avanzar el reloj cuesta O(1)
+ * amortizado por temporizador.
+ *
+ * Cada ranura es una lista circular doblemente enlazada con un centinela, y cada nivel
+ * tiene una palabra de 64 bits con las ranuras ocupadas; advance() busca con
+ * __builtin_ctzll la siguiente ranura ocupada de cada nivel y salta hasta ella.
+ *
+ * schedule() retorna un handle (el nodo del temporizador) con el que se puede cancelar o
+ * reprogramar en O(1). El handle es válido hasta que el temporizador vence, se cancela o
+ * se llama a clear().
+ *
+ * @tparam E Tipo de dato asociado a cada temporizador.
+ */
+template <typename E>
+class TimingWheel {
+public:
+    typedef TimerNode<E>* Handle; ///< Identificador de un temporizador programado.
+
+private:
+    static const int BITS = 6;              ///< Bits del tick que corresponden a cada nivel.
+    static const int SLOTS = 1 << BITS;     ///< Ranuras por nivel.
+    static const int LEVELS = (64 + BITS - 1) / BITS; ///< Niveles necesarios para cubrir 64 bits.
+
+    TimerNode<E>* slots;              ///< Centinelas de las ranuras, nivel por nivel.
+    unsigned long long occupied[LEVELS]; ///< Ranuras ocupadas de cada nivel.
+    unsigned long long now;           ///< Tick actual.
+    int size;                         ///< Cantidad de temporizadores programados.
+    MemoryResource* resource;         ///< Recurso del que se obtienen las ranuras y los temporizadores.
+
+    /**
+     * @brief Constructor de copia privado para evitar copiar la rueda.
+     */
+    TimingWheel(const TimingWheel<E>& other) {}
+
+    /**
+     * @brief Operador de asignación privado para evitar asignar la rueda.
+     */
+    void operator=(const TimingWheel<E>& other) {}
+
+    /**
+     * @brief Obtiene el dígito de un nivel de un tick.
+     */
+    static int digit(unsigned long long tick, int level) {
+        return (int)((tick >> (level * BITS)) & (SLOTS - 1));
+    }
+
+    /**
+     * @brief Enlaza un nodo en la ranura que le corresponde según el tick actual.
+     *
+     * El vencimiento debe ser mayor o igual que el tick actual; si es igual, el nodo
+     * queda en la ranura de nivel 0 del tick actual.
+     */
+    void place(TimerNode<E>* node) {
+        unsigned long long difference = node->deadline ^ now;
+        int level = difference == 0 ? 0 : (63 - __builtin_clzll(difference)) / BITS;
+        int slot = digit(node->deadline, level);
+        TimerNode<E>* sentinel = &slots[level * SLOTS + slot];
+        node->slot = level * SLOTS + slot;
+        node->next = sentinel;
+        node->previous = sentinel->previous;
+        sentinel->previous->next = node;
+        sentinel->previous = node;
+        occupied[level] |= 1ULL << slot;
+    }
+
+    /**
+     * @brief Quita un nodo de su ranura, marcándola libre si queda vacía.
+     */
+    void unlink(TimerNode<E>* node) {
+        node->previous->next = node->next;
+        node->next->previous = node->previous;
+        TimerNode<E>* sentinel = &slots[node->slot];
+        if (sentinel->next == sentinel)
+            occupied[node->slot / SLOTS] &= ~(1ULL << (node->slot % SLOTS));
+        node->slot = -1;
+    }
+
+    /**
+     * @brief Mueve todos los nodos de una ranura a la lista del centinela indicado.
+     */
+    void detach(int index, TimerNode<E>* batch) {
+        TimerNode<E>* sentinel = &slots[index];
+        batch->next = sentinel->next;
+        batch->previous = sentinel->previous;
+        batch->next->previous = batch;
+        batch->previous->next = batch;
+        sentinel->next = sentinel->previous = sentinel;
+        occupied[index / SLOTS] &= ~(1ULL << (index % SLOTS));
+    }
+
+    /**
+     * @brief Calcula el siguiente tick en que alguna ranura debe procesarse.
+     *
+     * En cada nivel, las ranuras ocupadas tienen un dígito mayor que el del tick actual;
+     * la primera se procesa al inicio de su bloque.
+     *
+     * @return El tick, o ULLONG_MAX si no hay temporizadores.
+     */
+    unsigned long long nextEvent() {
+        unsigned long long best = ULLONG_MAX;
+        for (int level = 0; level < LEVELS; level++) {
+            int current = digit(now, level);
+            unsigned long long ahead = current == SLOTS - 1 ? 0 : occupied[level] & (~0ULL << (current + 1));
+            if (ahead == 0)
+                continue;
+            int shift = (level + 1) * BITS;
+            unsigned long long block = shift >= 64 ? 0 : (now >> shift) << shift;
+            unsigned long long tick = block | ((unsigned long long)__builtin_ctzll(ahead) << (level * BITS));
+            if (tick < best)
+                best = tick;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Baja a niveles inferiores las ranuras cuyo bloque comienza en el tick actual.
+     */
+    void cascade() {
+        TimerNode<E> batch;
+        for (int level = LEVELS - 1; level > 0; level--) {
+            if ((now & ((1ULL << (level * BITS)) - 1)) != 0)
+                continue;
+            int slot = digit(now, level);
+            if ((occupied[level] & (1ULL << slot)) == 0)
+                continue;
+            detach(level * SLOTS + slot, &batch);
+            while (batch.next != &batch) {
+                TimerNode<E>* node = batch.next;
+                batch.next = node->next;
+                place(node);
+            }
+            batch.next = batch.previous = &batch;
+        }
+    }
+
+    /**
+     * @brief Vence los temporizadores de la ranura de nivel 0 del tick actual.
+     *
+     * Si onExpire lanza una excepción, los temporizadores que aún no vencieron vuelven a
+     * la ranura, donde siguen programados y contados en el tamaño.
+     *
+     * @return Cantidad de temporizadores vencidos.
+     */
+    template <typename F>
+    int expire(F& onExpire) {
+        int slot = digit(now, 0);
+        if ((occupied[0] & (1ULL << slot)) == 0)
+            return 0;
+        TimerNode<E> batch;
+        detach(slot, &batch);
+        int expired = 0;
+        while (batch.next != &batch) {
+            TimerNode<E>* node = batch.next;
+            batch.next = node->next;
+            node->next->previous = &batch;
+            size--;
+            expired++;
+            E element = std::move(node->element);
+            destroy(resource, node);
+            try {
+                onExpire(element);
+            } catch (...) {
+                while (batch.next != &batch) {
+                    TimerNode<E>* pending = batch.next;
+                    batch.next = pending->next;
+                    place(pending);
+                }
+                throw;
+            }
+        }
+        return expired;
+    }
+
+public:
+    /**
+     * @brief Constructor que crea una rueda vacía en el tick 0.
+     *
+     * @param resource Recurso del que se obtienen las ranuras y los temporizadores (ver MemoryResource.h).
+     */
+    explicit TimingWheel(MemoryResource* resource = defaultResource()) : resource(resource) {
+        slots = createArray<TimerNode<E>>(resource, LEVELS * SLOTS);
+        for (int level = 0; level < LEVELS; level++)
+            occupied[level] = 0;
+        now = 0;
+        size = 0;
+    }
+
+    /**
+     * @brief Destructor que libera los temporizadores pendientes.
+     */
+    ~TimingWheel() {
+        clear();
+        destroyArray(resource, slots, LEVELS * SLOTS);
+    }
+
+    /**
+     * @brief Programa un temporizador que vence dentro de la cantidad de ticks indicada.
+     *
+     * @param element Elemento asociado al temporizador.
+     * @param ticks Ticks hasta el vencimiento; 0 equivale a 1 (vence en el siguiente tick).
+     * @return Handle del temporizador.
+     * @throws runtime_error Si los ticks son negativos.
+     */
+    Handle schedule(E element, long long ticks) {
+        if (ticks < 0)
+            throw runtime_error("Invalid delay.");
+        TimerNode<E>* node = create<TimerNode<E>>(resource, std::move(element), now + (ticks == 0 ? 1 : (unsigned long long)ticks));
+        place(node);
+        size++;
+        return node;
+    }
+
+    /**
+     * @brief Cancela un temporizador pendiente.
+     *
+     * @param handle Handle del temporizador; deja de ser válido.
+     * @return El elemento asociado al temporizador.
+     * @throws runtime_error Si el handle es nulo.
+     */
+    E cancel(Handle handle) {
+        if (handle == nullptr || handle->slot < 0)
+            throw runtime_error("Invalid handle.");
+        unlink(handle);
+        E element = std::move(handle->element);
+        destroy(resource, handle);
+        size--;
+        return element;
+    }
+
+    /**
+     * @brief Cambia el vencimiento de un temporizador pendiente.
+     *
+     * @param handle Handle del temporizador; sigue siendo válido.
+     * @param ticks Ticks, a partir del tick actual, hasta el nuevo vencimiento.
+     * @throws runtime_error Si el handle es nulo o los ticks son negativos.
+     */
+    void reschedule(Handle handle, long long ticks) {
+        if (handle == nullptr || handle->slot < 0)
+            throw runtime_error("Invalid handle.");
+        if (ticks < 0)
+            throw runtime_error("Invalid delay.");
+        unlink(handle);
+        handle->deadline = now + (ticks == 0 ? 1 : (unsigned long long)ticks);
+        place(handle);
+    }
+
+    /**
+     * @brief Avanza el reloj y vence, por ranuras completas, los temporizadores alcanzados.
+     *
+     * Salta de una ranura ocupada a la siguiente, así que el costo no depende de la
+     * cantidad de ticks sin temporizadores. onExpire puede programar o cancelar otros
+     * temporizadores.
+     *
+     * Si onExpire lanza una excepción, ésta se propaga y el reloj queda en el tick que se
+     * estaba procesando. Los temporizadores de ese tick que aún no vencieron siguen
+     * programados y vencen al comienzo de la siguiente llamada a advance().
+     *
+     * @param ticks Cantidad de ticks a avanzar.
+     * @param onExpire Función que recibe el elemento de cada temporizador vencido.
+     * @return Cantidad de temporizadores vencidos.
+     * @throws runtime_error Si los ticks son negativos.
+     */
+    template <typename F>
+    int advance(long long ticks, F onExpire) {
+        if (ticks < 0)
+            throw runtime_error("Invalid delay.");
+        unsigned long long target = now + (unsigned long long)ticks;
+        int expired = expire(onExpire);
+        while (true) {
+            unsigned long long next = nextEvent();
+            if (next > target)
+                break;
+            now = next;
+            cascade();
+            expired += expire(onExpire);
+        }
+        now = target;
+        return expired;
+    }
+
+    /**
+     * @brief Obtiene el tick en que vence un temporizador pendiente.
+     *
+     * @param handle Handle del temporizador.
+     * @return El tick de vencimiento.
+     * @throws runtime_error Si el handle es nulo.
+     */
+    unsigned long long getDeadline(Handle handle) {
+        if (handle == nullptr || handle->slot < 0)
+            throw runtime_error("Invalid handle.");
+        return handle->deadline;
+    }
+
+    /**
+     * @brief Obtiene el elemento de un temporizador pendiente.
+     *
+     * @param handle Handle del temporizador.
+     * @return El elemento asociado.
+     * @throws runtime_error Si el handle es nulo.
+     */
+    E getElement(Handle handle) {
+        if (handle == nullptr || handle->slot < 0)
+            throw runtime_error("Invalid handle.");
+        return handle->element;
+    }
+
+    /**
+     * @brief Retorna el tick actual.
+     */
+    unsigned long long getTime() {
+        return now;
+    }
+
+    /**
+     * @brief Cancela todos los temporizadores pendientes sin vencerlos.
+     */
+    void clear() {
+        for (int index = 0; index < LEVELS * SLOTS; index++) {
+            TimerNode<E>* sentinel = &slots[index];
+            while (sentinel->next != sentinel) {
+                TimerNode<E>* node = sentinel->next;
+                sentinel->next = node->next;
+                destroy(resource, node);
+            }
+            sentinel->previous = sentinel;
+        }
+        for (int level = 0; level < LEVELS; level++)
+            occupied[level] = 0;
+        size = 0;
+    }
+
+    /**
+     * @brief Retorna la cantidad de temporizadores pendientes.
+     */
+    int getSize() {
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtienen las ranuras y los temporizadores.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Verifica si no hay temporizadores pendientes.
+     */
+    bool isEmpty() {
+        return size == 0;
+    }
+
+    /**
+     * @brief Imprime los temporizadores pendientes de cada ranura ocupada.
+     */
+    void print() {
+        cout << "Time " << now << endl;
+        for (int index = 0; index < LEVELS * SLOTS; index++) {
+            TimerNode<E>* sentinel = &slots[index];
+            if (sentinel->next == sentinel)
+                continue;
+            cout << "Level " << index / SLOTS << ", slot " << index % SLOTS << ": [ ";
+            for (TimerNode<E>* node = sentinel->next; node != sentinel; node = node->next)
+                cout << node->element << "@" << node->deadline << " ";
+            cout << "]" << endl;
+        }
+    }
+};
@@ -9,9 +9,15 @@
 
 #pragma once
 
+#include <cstring>
 #include <stdexcept>
 #include <iostream>
+#include <type_traits>
+#include <utility>
 #include "Structures/Abstract/Stack.h"
+#include "Structures/Common/MemoryResource.h"
+
+#define DEFAULT_MAX 1024
 
 using std::runtime_error;
 using std::cout;
@@ -23,6 +29,10 @@ using std::endl;
  * Esta clase permite almacenar elementos en una estructura de pila (LIFO: Last In, First Out)
  * con un tamaño máximo definido durante la inicialización.
  *
+ * Si se construye en modo creciente, en lugar de lanzar una excepción al llenarse duplica su
+ * capacidad (O(1) amortizado), y la reduce a la mitad cuando queda a un cuarto de su capacidad,
+ * sin bajar nunca de la capacidad inicial.
+ *
  * @tparam E Tipo de dato almacenado en la pila.
  */
 template <typename E>
@@ -30,41 +40,79 @@ class ArrayStack : public Stack<E> {
 private:
     E* elements; ///< Arreglo dinámico que almacena los elementos de la pila.
     int max;     ///< Capacidad máxima de la pila.
-    int top;     ///< Índice del elemento en la parte superior de la pila.
+    int size;    ///< Número de elementos; la parte superior de la pila está en size - 1.
+    int initial; ///< Capacidad inicial, por debajo de la cual no se reduce el arreglo.
+    bool growable; ///< Indica si la pila crece en lugar de desbordarse.
+    MemoryResource* resource; ///< Recurso del que se obtiene el arreglo.
+
+    /**
+     * @brief Cambia la capacidad del arreglo conservando los elementos.
+     *
+     * @param newMax Nueva capacidad, mayor o igual que la cantidad de elementos.
+     */
+    void resize(int newMax) {
+        E* newElements = createArray<E>(resource, newMax);
+        if (std::is_trivially_copyable<E>::value)
+            memcpy((void*)newElements, (const void*)elements, sizeof(E) * size);
+        else
+            for (int i = 0; i < size; i++)
+                newElements[i] = std::move(elements[i]);
+        destroyArray(resource, elements, max);
+        elements = newElements;
+        max = newMax;
+    }
 
 public:
     /**
      * @brief Constructor que inicializa la pila con una capacidad máxima.
      *
      * @param max Capacidad máxima de la pila. Si no se especifica, se utiliza DEFAULT_MAX.
+     * @param growable Si es true, la capacidad crece y se reduce según sea necesario.
+     * @param resource Recurso del que se obtiene el arreglo (ver MemoryResource.h).
      * @throw runtime_error Si el tamaño máximo es menor que 1.
      */
-    ArrayStack(int max = DEFAULT_MAX) {
+    ArrayStack(int max = DEFAULT_MAX, bool growable = false, MemoryResource* resource = defaultResource())
+        : resource(resource) {
         if (max < 1)
             throw runtime_error("Invalid max size.");
-        elements = new E[max];
+        elements = createArray<E>(resource, max);
         this->max = max;
-        top = 0;
+        size = 0;
+        initial = max;
+        this->growable = growable;
     }
 
     /**
      * @brief Destructor que libera la memoria utilizada por el arreglo dinámico.
      */
     ~ArrayStack() {
-        delete[] elements;
+        destroyArray(resource, elements, max);
     }
 
     /**
      * @brief Inserta un elemento en la parte superior de la pila.
      *
-     * @param element Elemento a insertar en la pila.
-     * @throw runtime_error Si la pila está llena (desbordamiento).
+     * @param element Elemento a insertar en la pila, que se copia.
+     * @throw runtime_error Si la pila está llena (desbordamiento) y no es creciente.
      */
-    void push(E element) {
-        if (top == max)
-            throw runtime_error("Stack overflow.");
-        elements[top] = element;
-        top++;
+    void push(const E& element) {
+        push(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la parte superior de la pila moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si la pila está llena (desbordamiento) y no es creciente.
+     */
+    void push(E&& element) {
+        if (size == max) {
+            if (!growable)
+                throw runtime_error("Stack overflow.");
+            resize(max * 2);
+        }
+        elements[size] = std::move(element);
+        size++;
     }
 
     /**
@@ -74,10 +122,13 @@ public:
      * @throw runtime_error Si la pila está vacía.
      */
     E pop() {
-        if (top == 0)
+        if (size == 0)
             throw runtime_error("Stack is empty.");
-        top--;
-        return elements[top];
+        size--;
+        E result = std::move(elements[size]);
+        if (growable && max > initial && size <= max / 4)
+            resize(max / 2 > initial ? max / 2 : initial);
+        return result;
     }
 
     /**
@@ -87,20 +138,33 @@ public:
      * @throw runtime_error Si la pila está vacía.
      */
     E topValue() {
-        if (top == 0)
+        if (size == 0)
             throw runtime_error("Stack is empty.");
-        return elements[top - 1];
+        return elements[size - 1];
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento en la parte superior de la pila, sin copiarlo.
+     *
+     * @return Referencia al elemento en la parte superior de la pila.
+     * @throw runtime_error Si la pila está vacía.
+     */
+    E& top() {
+        if (size == 0)
+            throw runtime_error("Stack is empty.");
+        return elements[size - 1];
     }
 
     /**
      * @brief Elimina todos los elementos de la pila.
      *
-     * Reinicia el índice `top` a cero, indicando que la pila está vacía.
+     * Reinicia `size` a cero, indicando que la pila está vacía. En modo
+     * creciente, además, se regresa a la capacidad inicial.
      */
     void clear() {
-        top = 0;
-        //delete[] elements;
-        //elements = new E[max];
+        size = 0;
+        if (growable && max > initial)
+            resize(initial);
     }
 
     /**
@@ -109,7 +173,7 @@ public:
      * @return true si la pila no contiene elementos, false en caso contrario.
      */
     bool isEmpty() {
-        return top == 0;
+        return size == 0;
     }
 
     /**
@@ -118,7 +182,25 @@ public:
      * @return El tamaño actual de la pila.
      */
     int getSize() {
-        return top;
+        return size;
+    }
+
+    /**
+     * @brief Obtiene el recurso del que se obtiene el arreglo de la pila.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
+    /**
+     * @brief Retorna la capacidad actual de la pila.
+     *
+     * @return La cantidad de elementos que caben sin crecer.
+     */
+    int getCapacity() {
+        return max;
     }
 
     /**
@@ -128,7 +210,7 @@ public:
      */
     void print() {
         cout << "[ ";
-        for (int i = top - 1; i >= 0; i--)
+        for (int i = size - 1; i >= 0; i--)
             cout << elements[i] << " ";
         cout << "]" << endl;
     }
@@ -11,7 +11,9 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "Structures/Abstract/Stack.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/Node.h"
 
 using std::runtime_error;
@@ -29,17 +31,20 @@ using std::endl;
 template <typename E>
 class LinkedStack : public Stack<E> {
 private:
-    Node<E>* top; ///< Puntero al nodo en la parte superior de la pila.
+    Node<E>* head; ///< Puntero al nodo en la parte superior de la pila.
     int size;     ///< Número de elementos actualmente en la pila.
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
 public:
     /**
      * @brief Constructor por defecto.
      *
      * Inicializa la pila vacía.
+     *
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    LinkedStack() {
-        top = nullptr;
+    explicit LinkedStack(MemoryResource* resource = defaultResource()) : resource(resource) {
+        head = nullptr;
         size = 0;
     }
 
@@ -55,10 +60,19 @@ public:
     /**
      * @brief Inserta un elemento en la parte superior de la pila.
      *
-     * @param element Elemento a insertar en la pila.
+     * @param element Elemento a insertar en la pila, que se copia.
+     */
+    void push(const E& element) {
+        push(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en la parte superior de la pila moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
      */
-    void push(E element) {
-        top = new Node<E>(element, top);
+    void push(E&& element) {
+        head = create<Node<E>>(resource, std::move(element), head);
         size++;
     }
 
@@ -71,10 +85,10 @@ public:
     E pop() {
         if (size == 0)
             throw runtime_error("Stack is empty.");
-        E result = top->element;
-        Node<E>* temp = top;
-        top = top->next;
-        delete temp;
+        E result = std::move(head->element);
+        Node<E>* temp = head;
+        head = head->next;
+        destroy(resource, temp);
         size--;
         return result;
     }
@@ -88,7 +102,19 @@ public:
     E topValue() {
         if (size == 0)
             throw runtime_error("Stack is empty.");
-        return top->element;
+        return head->element;
+    }
+
+    /**
+     * @brief Retorna una referencia al elemento en la parte superior de la pila, sin copiarlo.
+     *
+     * @return Referencia al elemento en la parte superior de la pila.
+     * @throw runtime_error Si la pila está vacía.
+     */
+    E& top() {
+        if (size == 0)
+            throw runtime_error("Stack is empty.");
+        return head->element;
     }
 
     /**
@@ -97,10 +123,10 @@ public:
      * Libera la memoria de todos los nodos y reinicia el tamaño a cero.
      */
     void clear() {
-        while (top != nullptr) {
-            Node<E>* temp = top;
-            top = top->next;
-            delete temp;
+        while (head != nullptr) {
+            Node<E>* temp = head;
+            head = head->next;
+            destroy(resource, temp);
         }
         size = 0;
     }
@@ -123,6 +149,15 @@ public:
         return size;
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos de la pila.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Imprime el contenido de la pila.
      *
@@ -130,7 +165,7 @@ public:
      */
     void print() {
         cout << "[ ";
-        Node<E>* temp = top;
+        Node<E>* temp = head;
         while (temp != nullptr) {
             cout << temp->element << " ";
             temp = temp->next;
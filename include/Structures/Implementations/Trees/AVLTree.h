@@ -13,7 +13,14 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <utility>
+#include "Structures/Common/Compare.h"
+#include "Structures/Common/Instrumentation.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/AVLNode.h"
+#include "Structures/Common/Snapshot.h"
+#include "Structures/Common/TreeIterator.h"
 #include "Structures/Implementations/Lists/DLinkedList.h"
 
 using std::runtime_error;
@@ -29,35 +36,54 @@ using std::endl;
  * eliminación y búsqueda.
  *
  * @tparam E Tipo de los elementos almacenados en el árbol AVL.
+ * @tparam Compare Comparador de tres vías de las claves (ver Compare.h); por defecto, su orden natural.
  */
-template <typename E>
+template <typename E, typename Compare = DefaultCompare>
 class AVLTree {
 private:
     // El árbol AVL no permite copia ni asignación
-    AVLTree(const AVLTree<E>& other) {}
-    void operator=(const AVLTree<E>& other) {}
+    AVLTree(const AVLTree<E, Compare>& other) {}
+    void operator=(const AVLTree<E, Compare>& other) {}
 
     AVLNode<E>* root; ///< Puntero a la raíz del árbol AVL.
+    Compare comparator; ///< Comparador de tres vías de las claves (ver Compare.h).
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
     int rotationCount; ///< Contador de las rotaciones realizadas para mantener el balance.
 
+    /**
+     * @brief Operaciones instrumentadas; el trabajo de insert y remove son sus rotaciones.
+     */
+    enum Operation { INSERT, REMOVE, CONTAINS, FIND, OPERATION_COUNT };
+
+    /**
+     * @brief Contadores instrumentados.
+     */
+    enum Counter { ROTATIONS, COUNTER_COUNT };
+
+    typedef Instrumentation<OPERATION_COUNT, COUNTER_COUNT> Instruments; ///< Política de instrumentación.
+    Instruments instrumentation; ///< Mediciones de las operaciones (vacías si no se compila con STRUCTURES_INSTRUMENTATION).
+
     /**
      * @brief Función auxiliar para insertar un elemento en el árbol.
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar; sólo se mueve al crear el nodo.
+     * @param duplicated Se asigna true si el elemento ya existe; el árbol no cambia.
      * @return Puntero al nodo actualizado después de la inserción.
-     * @throw runtime_error Si el elemento ya existe en el árbol.
      */
-    AVLNode<E>* insertAux(AVLNode<E>* current, E element) {
+    AVLNode<E>* insertAux(AVLNode<E>* current, E&& element, bool* duplicated) {
         if (current == nullptr)
-            return new AVLNode<E>(element);
+            return create<AVLNode<E>>(resource, std::move(element));
 
-        if (element == current->element)
-            throw runtime_error("Duplicated element.");
+        int order = comparator(keyOf(element), keyOf(current->element));
+        if (order == 0) {
+            *duplicated = true;
+            return current;
+        }
 
-        if (element < current->element) {
-            current->left = insertAux(current->left, element);
+        if (order < 0) {
+            current->left = insertAux(current->left, std::move(element), duplicated);
         } else {
-            current->right = insertAux(current->right, element);
+            current->right = insertAux(current->right, std::move(element), duplicated);
         }
 
         current->updateHeight();
@@ -67,18 +93,20 @@ private:
     /**
      * @brief Función auxiliar para verificar si el árbol contiene un elemento.
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a buscar.
+     * @param key Elemento o clave a buscar (ver keyOf).
      * @return true si el elemento se encuentra, false en caso contrario.
      */
-    bool containsAux(AVLNode<E>* current, E element) {
+    template <typename Q>
+    bool containsAux(AVLNode<E>* current, const Q& key) {
         if (current == nullptr)
             return false;
-        if (element == current->element)
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order == 0)
             return true;
-        if (element < current->element)
-            return containsAux(current->left, element);
+        if (order < 0)
+            return containsAux(current->left, key);
         else
-            return containsAux(current->right, element);
+            return containsAux(current->right, key);
     }
 
     /**
@@ -88,48 +116,67 @@ private:
      * @return El elemento encontrado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E findAux(AVLNode<E>* current, E element) {
-        if (current == nullptr)
+    E findAux(AVLNode<E>* current, const E& element) {
+        E* found = searchAux(current, element);
+        if (found == nullptr)
             throw runtime_error("Element not found.");
-        if (element == current->element)
-            return current->element;
-        if (element < current->element)
-            return findAux(current->left, element);
-        else
-            return findAux(current->right, element);
+        return *found;
+    }
+
+    /**
+     * @brief Función auxiliar para buscar un elemento sin copiarlo.
+     * @param current Nodo desde el cual se inicia la búsqueda.
+     * @param key Elemento o clave a buscar (ver keyOf).
+     * @return Puntero al elemento dentro del árbol, o nullptr si no se encuentra.
+     */
+    template <typename Q>
+    E* searchAux(AVLNode<E>* current, const Q& key) {
+        while (current != nullptr) {
+            int order = comparator(keyOf(key), keyOf(current->element));
+            if (order == 0)
+                return &current->element;
+            current = order < 0 ? current->left : current->right;
+        }
+        return nullptr;
     }
 
     /**
      * @brief Función auxiliar para eliminar un elemento del árbol.
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a eliminar.
+     * @param key Elemento o clave a eliminar (ver keyOf).
      * @param result Puntero para almacenar el elemento eliminado.
+     * @param found Se asigna true si el elemento se encontró y se eliminó.
      * @return Puntero al nodo actualizado después de la eliminación.
-     * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    AVLNode<E>* removeAux(AVLNode<E>* current, E element, E* result) {
+    template <typename Q>
+    AVLNode<E>* removeAux(AVLNode<E>* current, const Q& key, E* result, bool* found) {
         if (current == nullptr)
-            throw runtime_error("Element not found.");
+            return nullptr;
 
-        if (element < current->element) {
-            current->left = removeAux(current->left, element, result);
-        } else if (element > current->element) {
-            current->right = removeAux(current->right, element, result);
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order < 0) {
+            current->left = removeAux(current->left, key, result, found);
+        } else if (order > 0) {
+            current->right = removeAux(current->right, key, result, found);
         } else {
-            *result = current->element;
+            *found = true;
             int childrenCount = current->childrenCount();
             if (childrenCount == 0) {
-                delete current;
+                *result = std::move(current->element);
+                destroy(resource, current);
                 return nullptr;
             }
             if (childrenCount == 1) {
+                *result = std::move(current->element);
                 AVLNode<E>* child = current->onlyChild();
-                delete current;
+                destroy(resource, current);
                 return child;
             } else {
+                // Se busca por el elemento del sucesor y no por element, que podría ser
+                // una referencia al elemento de este nodo y cambiar con el intercambio.
                 AVLNode<E>* successor = findMin(current->right);
                 swap(current, successor);
-                current->right = removeAux(current->right, element, result);
+                current->right = removeAux(current->right, successor->element, result, found);
             }
         }
 
@@ -154,9 +201,9 @@ private:
      * @param n2 Segundo nodo.
      */
     void swap(AVLNode<E>* n1, AVLNode<E>* n2) {
-        E temp = n1->element;
-        n1->element = n2->element;
-        n2->element = temp;
+        E temp = std::move(n1->element);
+        n1->element = std::move(n2->element);
+        n2->element = std::move(temp);
     }
 
     /**
@@ -168,7 +215,7 @@ private:
             return;
         clearAux(current->left);
         clearAux(current->right);
-        delete current;
+        destroy(resource, current);
     }
 
     /**
@@ -207,6 +254,7 @@ private:
         current->updateHeight();
         temp->updateHeight();
         rotationCount++;
+        instrumentation.count(ROTATIONS);
         return temp;
     }
 
@@ -222,6 +270,7 @@ private:
         current->updateHeight();
         temp->updateHeight();
         rotationCount++;
+        instrumentation.count(ROTATIONS);
         return temp;
     }
 
@@ -245,15 +294,51 @@ private:
         return current;
     }
 
+    /**
+     * @brief Construye un subárbol perfectamente balanceado con un rango de elementos ordenados.
+     *
+     * Toma el elemento central como raíz y construye los lados recursivamente. Los
+     * elementos se piden en orden creciente de posición.
+     *
+     * @param low Primera posición del rango.
+     * @param high Última posición del rango.
+     * @param element Función que recibe una posición y retorna el elemento.
+     * @return Raíz del subárbol, o nullptr si el rango está vacío.
+     */
+    template <typename Source>
+    AVLNode<E>* buildAux(int low, int high, Source& element) {
+        if (low > high)
+            return nullptr;
+        int middle = low + (high - low) / 2;
+        AVLNode<E>* left = buildAux(low, middle - 1, element);
+        AVLNode<E>* current = create<AVLNode<E>>(resource, element(middle));
+        current->left = left;
+        current->right = buildAux(middle + 1, high, element);
+        current->updateHeight();
+        return current;
+    }
+
 public:
+    typedef TreeIterator<AVLNode<E>, E> Iterator; ///< Iterador en orden sobre los elementos.
+
     /**
-     * @brief Constructor por defecto que inicializa un árbol AVL vacío.
+     * @brief Constructor que inicializa un árbol AVL vacío.
+     * @param comparator Comparador de las claves; por defecto, su orden natural.
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    AVLTree() {
+    explicit AVLTree(const Compare& comparator = Compare(), MemoryResource* resource = defaultResource())
+        : comparator(comparator), resource(resource) {
         root = nullptr;
         rotationCount = 0;
     }
 
+    /**
+     * @brief Constructor que inicializa un árbol vacío con el comparador por defecto y el recurso indicado.
+     *
+     * @param resource Recurso del que se obtienen los nodos.
+     */
+    explicit AVLTree(MemoryResource* resource) : AVLTree(Compare(), resource) {}
+
     /**
      * @brief Destructor que limpia el árbol y libera la memoria.
      */
@@ -263,19 +348,57 @@ public:
 
     /**
      * @brief Inserta un elemento en el árbol.
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     * @throw runtime_error Si el elemento ya existe en el árbol.
      */
-    void insert(E element) {
-        root = insertAux(root, element);
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en el árbol moviéndolo.
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si el elemento ya existe en el árbol.
+     */
+    void insert(E&& element) {
+        if (!tryInsert(std::move(element)))
+            throw runtime_error("Duplicated element.");
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol, sin lanzar excepciones si ya existe.
+     * @param element Elemento a insertar, que se copia.
+     * @return true si se insertó, false si el elemento ya existía.
+     */
+    bool tryInsert(const E& element) {
+        return tryInsert(E(element));
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol moviéndolo, sin lanzar excepciones si ya existe.
+     * @param element Elemento a insertar; sólo se mueve si se inserta.
+     * @return true si se insertó, false si el elemento ya existía.
+     */
+    bool tryInsert(E&& element) {
+        typename Instruments::Scope scope(instrumentation, INSERT);
+        int rotations = rotationCount;
+        bool duplicated = false;
+        root = insertAux(root, std::move(element), &duplicated);
+        scope.addWork(rotationCount - rotations);
+        return !duplicated;
     }
 
     /**
      * @brief Verifica si el árbol contiene un elemento.
-     * @param element Elemento a buscar.
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
      * @return true si el elemento se encuentra en el árbol, false en caso contrario.
      */
-    bool contains(E element) {
-        return containsAux(root, element);
+    template <typename Q>
+    bool contains(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, CONTAINS);
+        return containsAux(root, key);
     }
 
     /**
@@ -284,22 +407,61 @@ public:
      * @return El elemento encontrado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E find(E element) {
+    E find(const E& element) {
+        typename Instruments::Scope scope(instrumentation, FIND);
         return findAux(root, element);
     }
 
+    /**
+     * @brief Busca un elemento en el árbol sin copiarlo y sin lanzar excepciones.
+     *
+     * El elemento apuntado no debe modificarse de forma que cambie su orden.
+     *
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
+     * @return Puntero al elemento dentro del árbol, o nullptr si no se encuentra.
+     */
+    template <typename Q>
+    E* search(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, FIND);
+        return searchAux(root, key);
+    }
+
     /**
      * @brief Elimina un elemento del árbol.
-     * @param element Elemento a eliminar.
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
      * @return El elemento eliminado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E remove(E element) {
+    template <typename Q>
+    E remove(const Q& key) {
         E result;
-        root = removeAux(root, element, &result);
+        if (!tryRemove(key, result))
+            throw runtime_error("Element not found.");
         return result;
     }
 
+    /**
+     * @brief Intenta eliminar un elemento del árbol, sin lanzar excepciones si no existe.
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
+     * @param element Se asigna el elemento eliminado; no cambia si no se encuentra.
+     * @return true si se eliminó, false si el elemento no existía.
+     */
+    template <typename Q>
+    bool tryRemove(const Q& key, E& element) {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
+        int rotations = rotationCount;
+        bool found = false;
+        root = removeAux(root, key, &element, &found);
+        scope.addWork(rotationCount - rotations);
+        return found;
+    }
+
     /**
      * @brief Limpia el árbol y libera la memoria.
      */
@@ -318,6 +480,103 @@ public:
         return elements;
     }
 
+    /**
+     * @brief Obtiene un iterador al menor elemento, para recorrer el árbol en orden.
+     *
+     * El recorrido no copia los elementos ni modifica la forma del árbol.
+     *
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(root);
+    }
+
+    /**
+     * @brief Obtiene el iterador de fin del recorrido.
+     *
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator();
+    }
+
+    /**
+     * @brief Reemplaza el contenido del árbol por una secuencia estrictamente creciente.
+     *
+     * Construye en O(n) un árbol perfectamente balanceado, sin comparaciones ni
+     * rotaciones; el llamador garantiza el orden de la secuencia.
+     *
+     * @param count Cantidad de elementos.
+     * @param element Función que recibe una posición entre 0 y count - 1 y retorna el
+     *        elemento en esa posición; se llama una vez por posición, en orden.
+     */
+    template <typename Source>
+    void assignSorted(int count, Source element) {
+        clear();
+        root = buildAux(0, count - 1, element);
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento en orden, sin copiarlos.
+     *
+     * @param visit Función que recibe una referencia a cada elemento.
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (Iterator it = begin(); it != end(); ++it)
+            visit(*it);
+    }
+
+    /**
+     * @brief Guarda los elementos en orden en un archivo binario de instantánea (ver Snapshot.h).
+     *
+     * Sólo está disponible si E es trivialmente copiable o string. El archivo se marca
+     * como ordenado (SNAPSHOT_SORTED) sólo si el comparador es el orden natural.
+     *
+     * @param path Ruta del archivo, que se reemplaza si existe.
+     * @throw runtime_error Si no se puede escribir el archivo.
+     */
+    void save(const string& path) {
+        int count = getSize();
+        const E** ordered = new const E*[count > 0 ? count : 1];
+        int filled = 0;
+        forEach([ordered, &filled](E& element) { ordered[filled++] = &element; });
+        try {
+            uint32_t flags = NaturalOrder<Compare>::value ? SNAPSHOT_SORTED : 0;
+            SnapshotWriter writer(path, SNAPSHOT_SEQUENCE, flags, SnapshotCodec<E>::code(), 0, (uint64_t)count);
+            SnapshotCodec<E>::write(writer, count, [ordered](int i) -> const E& { return *ordered[i]; });
+            writer.finish();
+        } catch (...) {
+            delete[] ordered;
+            throw;
+        }
+        delete[] ordered;
+    }
+
+    /**
+     * @brief Reemplaza el contenido del árbol por el de un archivo de instantánea.
+     *
+     * Verifica que los elementos estén en orden estrictamente creciente según el
+     * comparador y construye el árbol balanceado directamente, en O(n) y sin rotaciones.
+     *
+     * @param path Ruta del archivo.
+     * @throw runtime_error Si no se puede abrir el archivo, no guarda una secuencia de E o
+     *        los elementos no están en orden estrictamente creciente.
+     */
+    void load(const string& path) {
+        SnapshotFile file(path, SNAPSHOT_SEQUENCE, SnapshotCodec<E>::code(), 0, true);
+        typename SnapshotCodec<E>::Column column = file.column<E>();
+        column.validate();
+        if (NaturalOrder<Compare>::value) {
+            checkSnapshotSorted(column, file.getCount());
+        } else {
+            for (int i = 1; i < file.getCount(); i++)
+                if (comparator(keyOf(column[i - 1]), keyOf(column[i])) >= 0)
+                    throw runtime_error("Invalid snapshot.");
+        }
+        assignSorted(file.getCount(), [&column](int i) { return E(column[i]); });
+    }
+
     /**
      * @brief Obtiene el tamaño del árbol.
      * @return Número de elementos en el árbol.
@@ -326,6 +585,15 @@ public:
         return getSizeAux(root);
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos del árbol.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Obtiene la altura del árbol.
      * @return Altura del árbol.
@@ -342,6 +610,20 @@ public:
         return rotationCount;
     }
 
+    /**
+     * @brief Obtiene las mediciones del árbol.
+     *
+     * Si no se compiló con STRUCTURES_INSTRUMENTATION, la instantánea está vacía.
+     * El trabajo de insert y remove es la cantidad de rotaciones que hicieron.
+     *
+     * @return Instantánea de las mediciones.
+     */
+    Stats stats() const {
+        static const char* const operations[] = { "insert", "remove", "contains", "find" };
+        static const char* const counters[] = { "rotations" };
+        return instrumentation.snapshot(operations, counters);
+    }
+
     /**
      * @brief Imprime el contenido del árbol en orden.
      */
@@ -12,7 +12,12 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include "Structures/Common/Compare.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/BSTNode.h"
+#include "Structures/Common/TreeIterator.h"
 #include "Structures/Implementations/Lists/DLinkedList.h"
 
 using std::runtime_error;
@@ -27,15 +32,18 @@ using std::endl;
  * - Todos los elementos en el subárbol derecho son mayores que el nodo raíz.
  *
  * @tparam E Tipo de los elementos almacenados en el BST.
+ * @tparam Compare Comparador de tres vías de las claves (ver Compare.h); por defecto, su orden natural.
  */
-template <typename E>
+template <typename E, typename Compare = DefaultCompare>
 class BSTree {
 private:
     // El árbol BST no permite la copia ni la asignación
-    BSTree(const BSTree<E>& other) {}
-    void operator=(const BSTree<E>& other) {}
+    BSTree(const BSTree<E, Compare>& other) {}
+    void operator=(const BSTree<E, Compare>& other) {}
 
     BSTNode<E>* root; ///< Puntero a la raíz del árbol.
+    Compare comparator; ///< Comparador de tres vías de las claves (ver Compare.h).
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
 
     /**
      * @brief Función auxiliar para insertar un elemento en el árbol.
@@ -43,20 +51,23 @@ private:
      * Realiza la inserción recursiva en el árbol.
      *
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar; sólo se mueve al crear el nodo.
+     * @param duplicated Se asigna true si el elemento ya existe; el árbol no cambia.
      * @return Puntero al nodo actualizado después de la inserción.
-     * @throw runtime_error Si el elemento ya existe en el árbol.
      */
-    BSTNode<E>* insertAux(BSTNode<E>* current, E element) {
+    BSTNode<E>* insertAux(BSTNode<E>* current, E&& element, bool* duplicated) {
         if (current == nullptr)
-            return new BSTNode<E>(element);
+            return create<BSTNode<E>>(resource, std::move(element));
         // Si se desea permitir elementos duplicados, eliminar este bloque
-        if (element == current->element)
-            throw runtime_error("Duplicated element.");
-        if (element < current->element)
-            current->left = insertAux(current->left, element);
+        int order = comparator(keyOf(element), keyOf(current->element));
+        if (order == 0) {
+            *duplicated = true;
+            return current;
+        }
+        if (order < 0)
+            current->left = insertAux(current->left, std::move(element), duplicated);
         else
-            current->right = insertAux(current->right, element);
+            current->right = insertAux(current->right, std::move(element), duplicated);
         return current;
     }
 
@@ -66,18 +77,20 @@ private:
      * Realiza una búsqueda recursiva en el árbol.
      *
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a buscar.
+     * @param key Elemento o clave a buscar (ver keyOf).
      * @return true si el elemento se encuentra en el árbol, false en caso contrario.
      */
-    bool containsAux(BSTNode<E>* current, E element) {
+    template <typename Q>
+    bool containsAux(BSTNode<E>* current, const Q& key) {
         if (current == nullptr)
             return false;
-        if (element == current->element)
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order == 0)
             return true;
-        if (element < current->element)
-            return containsAux(current->left, element);
+        if (order < 0)
+            return containsAux(current->left, key);
         else
-            return containsAux(current->right, element);
+            return containsAux(current->right, key);
     }
 
     /**
@@ -90,15 +103,31 @@ private:
      * @return El elemento encontrado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E findAux(BSTNode<E>* current, E element) {
-        if (current == nullptr)
+    E findAux(BSTNode<E>* current, const E& element) {
+        E* found = searchAux(current, element);
+        if (found == nullptr)
             throw runtime_error("Element not found.");
-        if (element == current->element)
-            return current->element;
-        if (element < current->element)
-            return findAux(current->left, element);
-        else
-            return findAux(current->right, element);
+        return *found;
+    }
+
+    /**
+     * @brief Función auxiliar para buscar un elemento sin copiarlo.
+     *
+     * Realiza una búsqueda iterativa desde el nodo indicado.
+     *
+     * @param current Nodo desde el cual se inicia la búsqueda.
+     * @param key Elemento o clave a buscar (ver keyOf).
+     * @return Puntero al elemento dentro del árbol, o nullptr si no se encuentra.
+     */
+    template <typename Q>
+    E* searchAux(BSTNode<E>* current, const Q& key) {
+        while (current != nullptr) {
+            int order = comparator(keyOf(key), keyOf(current->element));
+            if (order == 0)
+                return &current->element;
+            current = order < 0 ? current->left : current->right;
+        }
+        return nullptr;
     }
 
     /**
@@ -107,36 +136,42 @@ private:
      * Realiza la eliminación recursiva en el árbol.
      *
      * @param current Nodo actual en el recorrido del árbol.
-     * @param element Elemento a eliminar.
+     * @param key Elemento o clave a eliminar (ver keyOf).
      * @param result Puntero para almacenar el elemento eliminado.
+     * @param found Se asigna true si el elemento se encontró y se eliminó.
      * @return Puntero al nodo actualizado después de la eliminación.
-     * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    BSTNode<E>* removeAux(BSTNode<E>* current, E element, E* result) {
+    template <typename Q>
+    BSTNode<E>* removeAux(BSTNode<E>* current, const Q& key, E* result, bool* found) {
         if (current == nullptr)
-            throw runtime_error("Element not found.");
-        if (element < current->element) {
-            current->left = removeAux(current->left, element, result);
+            return nullptr;
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order < 0) {
+            current->left = removeAux(current->left, key, result, found);
             return current;
         }
-        if (element > current->element) {
-            current->right = removeAux(current->right, element, result);
+        if (order > 0) {
+            current->right = removeAux(current->right, key, result, found);
             return current;
         } else {
-            *result = current->element;
+            *found = true;
             int childrenCount = current->childrenCount();
             if (childrenCount == 0) {
-                delete current;
+                *result = std::move(current->element);
+                destroy(resource, current);
                 return nullptr;
             }
             if (childrenCount == 1) {
+                *result = std::move(current->element);
                 BSTNode<E>* child = current->onlyChild();
-                delete current;
+                destroy(resource, current);
                 return child;
             } else {
+                // Se busca por el elemento del sucesor y no por element, que podría ser
+                // una referencia al elemento de este nodo y cambiar con el intercambio.
                 BSTNode<E>* successor = findMin(current->right);
                 swap(current, successor);
-                current->right = removeAux(current->right, element, result);
+                current->right = removeAux(current->right, successor->element, result, found);
                 return current;
             }
         }
@@ -161,9 +196,9 @@ private:
      * @param n2 Segundo nodo.
      */
     void swap(BSTNode<E>* n1, BSTNode<E>* n2) {
-        E temp = n1->element;
-        n1->element = n2->element;
-        n2->element = temp;
+        E temp = std::move(n1->element);
+        n1->element = std::move(n2->element);
+        n2->element = std::move(temp);
     }
 
     /**
@@ -178,7 +213,7 @@ private:
             return;
         clearAux(current->left);
         clearAux(current->right);
-        delete current;
+        destroy(resource, current);
     }
 
     /**
@@ -225,14 +260,50 @@ private:
         return 1 + (lh > rh ? lh : rh);
     }
 
+    /**
+     * @brief Construye un subárbol perfectamente balanceado con un rango de elementos ordenados.
+     *
+     * Toma el elemento central como raíz y construye los lados recursivamente. Los
+     * elementos se piden en orden creciente de posición.
+     *
+     * @param low Primera posición del rango.
+     * @param high Última posición del rango.
+     * @param element Función que recibe una posición y retorna el elemento.
+     * @return Raíz del subárbol, o nullptr si el rango está vacío.
+     */
+    template <typename Source>
+    BSTNode<E>* buildAux(int low, int high, Source& element) {
+        if (low > high)
+            return nullptr;
+        int middle = low + (high - low) / 2;
+        BSTNode<E>* left = buildAux(low, middle - 1, element);
+        BSTNode<E>* current = create<BSTNode<E>>(resource, element(middle));
+        current->left = left;
+        current->right = buildAux(middle + 1, high, element);
+        return current;
+    }
+
 public:
+    typedef TreeIterator<BSTNode<E>, E> Iterator; ///< Iterador en orden sobre los elementos.
+
     /**
-     * @brief Constructor por defecto que inicializa un árbol BST vacío.
+     * @brief Constructor que inicializa un árbol BST vacío.
+     *
+     * @param comparator Comparador de las claves; por defecto, su orden natural.
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    BSTree() {
+    explicit BSTree(const Compare& comparator = Compare(), MemoryResource* resource = defaultResource())
+        : comparator(comparator), resource(resource) {
         root = nullptr;
     }
 
+    /**
+     * @brief Constructor que inicializa un árbol vacío con el comparador por defecto y el recurso indicado.
+     *
+     * @param resource Recurso del que se obtienen los nodos.
+     */
+    explicit BSTree(MemoryResource* resource) : BSTree(Compare(), resource) {}
+
     /**
      * @brief Destructor que limpia el árbol y libera la memoria.
      */
@@ -243,20 +314,57 @@ public:
     /**
      * @brief Inserta un elemento en el árbol.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
+     * @throw runtime_error Si el elemento ya existe en el árbol.
+     */
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en el árbol moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error Si el elemento ya existe en el árbol.
+     */
+    void insert(E&& element) {
+        if (!tryInsert(std::move(element)))
+            throw runtime_error("Duplicated element.");
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol, sin lanzar excepciones si ya existe.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @return true si se insertó, false si el elemento ya existía.
+     */
+    bool tryInsert(const E& element) {
+        return tryInsert(E(element));
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol moviéndolo, sin lanzar excepciones si ya existe.
+     *
+     * @param element Elemento a insertar; sólo se mueve si se inserta.
+     * @return true si se insertó, false si el elemento ya existía.
      */
-    void insert(E element) {
-        root = insertAux(root, element);
+    bool tryInsert(E&& element) {
+        bool duplicated = false;
+        root = insertAux(root, std::move(element), &duplicated);
+        return !duplicated;
     }
 
     /**
      * @brief Verifica si el árbol contiene un elemento.
      *
-     * @param element Elemento a buscar.
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
      * @return true si el elemento se encuentra en el árbol, false en caso contrario.
      */
-    bool contains(E element) {
-        return containsAux(root, element);
+    template <typename Q>
+    bool contains(const Q& key) {
+        return containsAux(root, key);
     }
 
     /**
@@ -266,23 +374,58 @@ public:
      * @return El elemento encontrado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E find(E element) {
+    E find(const E& element) {
         return findAux(root, element);
     }
 
+    /**
+     * @brief Busca un elemento en el árbol sin copiarlo y sin lanzar excepciones.
+     *
+     * El elemento apuntado no debe modificarse de forma que cambie su orden.
+     *
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
+     * @return Puntero al elemento dentro del árbol, o nullptr si no se encuentra.
+     */
+    template <typename Q>
+    E* search(const Q& key) {
+        return searchAux(root, key);
+    }
+
     /**
      * @brief Elimina un elemento del árbol.
      *
-     * @param element Elemento a eliminar.
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
      * @return El elemento eliminado.
      * @throw runtime_error Si el elemento no se encuentra en el árbol.
      */
-    E remove(E element) {
+    template <typename Q>
+    E remove(const Q& key) {
         E result;
-        root = removeAux(root, element, &result);
+        if (!tryRemove(key, result))
+            throw runtime_error("Element not found.");
         return result;
     }
 
+    /**
+     * @brief Intenta eliminar un elemento del árbol, sin lanzar excepciones si no existe.
+     *
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
+     * @param element Se asigna el elemento eliminado; no cambia si no se encuentra.
+     * @return true si se eliminó, false si el elemento no existía.
+     */
+    template <typename Q>
+    bool tryRemove(const Q& key, E& element) {
+        bool found = false;
+        root = removeAux(root, key, &element, &found);
+        return found;
+    }
+
     /**
      * @brief Limpia el árbol y libera la memoria.
      */
@@ -302,6 +445,53 @@ public:
         return elements;
     }
 
+    /**
+     * @brief Obtiene un iterador al menor elemento, para recorrer el árbol en orden.
+     *
+     * El recorrido no copia los elementos ni modifica la forma del árbol.
+     *
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(root);
+    }
+
+    /**
+     * @brief Obtiene el iterador de fin del recorrido.
+     *
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator();
+    }
+
+    /**
+     * @brief Reemplaza el contenido del árbol por una secuencia estrictamente creciente.
+     *
+     * Construye en O(n) un árbol perfectamente balanceado, sin comparaciones ni
+     * rotaciones; el llamador garantiza el orden de la secuencia.
+     *
+     * @param count Cantidad de elementos.
+     * @param element Función que recibe una posición entre 0 y count - 1 y retorna el
+     *        elemento en esa posición; se llama una vez por posición, en orden.
+     */
+    template <typename Source>
+    void assignSorted(int count, Source element) {
+        clear();
+        root = buildAux(0, count - 1, element);
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento en orden, sin copiarlos.
+     *
+     * @param visit Función que recibe una referencia a cada elemento.
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (Iterator it = begin(); it != end(); ++it)
+            visit(*it);
+    }
+
     /**
      * @brief Obtiene el tamaño del árbol.
      *
@@ -311,6 +501,15 @@ public:
         return getSizeAux(root);
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos del árbol.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Imprime los elementos del árbol en orden.
      */
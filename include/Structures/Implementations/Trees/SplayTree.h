@@ -13,7 +13,13 @@
 
 #include <stdexcept>
 #include <iostream>
+#include <utility>
+#include "Structures/Common/Compare.h"
+#include "Structures/Common/Instrumentation.h"
+#include "Structures/Common/KeyLookup.h"
+#include "Structures/Common/MemoryResource.h"
 #include "Structures/Common/Nodes/SNode.h"
+#include "Structures/Common/TreeIterator.h"
 #include "Structures/Implementations/Lists/DLinkedList.h"
 
 using std::cout;
@@ -25,146 +31,152 @@ using std::runtime_error;
  *        mueve los elementos recientemente accedidos a la raíz mediante operaciones de rotación.
  *
  * @tparam E Tipo de los elementos almacenados en el árbol.
+ * @tparam Compare Comparador de tres vías de las claves (ver Compare.h); por defecto, su orden natural.
  */
-template <typename E>
+template <typename E, typename Compare = DefaultCompare>
 class SplayTree {
 private:
     SNode<E>* root; ///< Nodo raíz del árbol Splay.
     SNode<E>* last; ///< Último nodo accedido (para la Operación de splay).
+    Compare comparator; ///< Comparador de tres vías de las claves (ver Compare.h).
+    MemoryResource* resource; ///< Recurso del que se obtienen los nodos.
+
+    /**
+     * @brief Operaciones instrumentadas; su trabajo es la profundidad del nodo llevado a la raíz.
+     */
+    enum Operation { INSERT, REMOVE, CONTAINS, FIND, OPERATION_COUNT };
+
+    /**
+     * @brief Contadores instrumentados.
+     */
+    enum Counter { ROTATIONS, COUNTER_COUNT };
+
+    typedef Instrumentation<OPERATION_COUNT, COUNTER_COUNT> Instruments; ///< Política de instrumentación.
+    Instruments instrumentation; ///< Mediciones de las operaciones (vacías si no se compila con STRUCTURES_INSTRUMENTATION).
 
     /**
      * @brief Función auxiliar para insertar un elemento en el árbol.
      *
      * @param current Nodo actual en el que se intenta insertar el elemento.
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar; sólo se mueve al crear el nodo.
+     * @param duplicated Se asigna true si el elemento ya existe; el árbol no cambia.
      * @return Nodo raíz después de la inserción.
-     * @throw runtime_error si el elemento ya existe en el árbol.
      */
-    SNode<E>* insertAux(SNode<E>* current, E element) {
+    SNode<E>* insertAux(SNode<E>* current, E&& element, bool* duplicated) {
         if (current == nullptr) {
-            SNode<E>* result = new SNode<E>(element);
+            SNode<E>* result = create<SNode<E>>(resource, std::move(element));
             last = result;
             return result;
         }
-        if (element == current->element) {
+        int order = comparator(keyOf(element), keyOf(current->element));
+        if (order == 0) {
             last = current;
-            throw runtime_error("Duplicated element.");
+            *duplicated = true;
+            return current;
         }
-        if (element < current->element) {
-            current->left = insertAux(current->left, element);
+        if (order < 0) {
+            current->left = insertAux(current->left, std::move(element), duplicated);
             current->left->parent = current;
             return current;
         }
         else {
-            current->right = insertAux(current->right, element);
+            current->right = insertAux(current->right, std::move(element), duplicated);
             current->right->parent = current;
             return current;
         }
     }
 
     /**
-     * @brief Función auxiliar para encontrar un elemento en el árbol.
+     * @brief Función auxiliar para buscar un elemento sin lanzar excepciones.
      *
-     * @param current Nodo actual donde se busca el elemento.
-     * @param element Elemento a buscar.
-     * @return El elemento encontrado.
-     * @throw runtime_error si el elemento no existe en el árbol.
-     */
-    E findAux(SNode<E>* current, E element) {
-        if (current == nullptr)
-            throw runtime_error("Element not found.");
-        last = current;
-        if (element == current->element) {
-            return current->element;
-        }
-        if (element < current->element)
-            return findAux(current->left, element);
-        else
-            return findAux(current->right, element);
-    }
-
-    /**
-     * @brief Función auxiliar para obtener un puntero a un elemento en el árbol.
+     * Deja en last el último nodo visitado, para llevarlo a la raíz con splay().
      *
-     * @param current Nodo actual donde se busca el elemento.
-     * @param element Elemento a buscar.
-     * @return Puntero al elemento encontrado.
-     * @throw runtime_error si el elemento no existe en el árbol.
+     * @param current Nodo desde el cual se inicia la búsqueda.
+     * @param key Elemento o clave a buscar (ver keyOf).
+     * @return Puntero al elemento encontrado, o nullptr si no existe.
      */
-    E* findPointerAux(SNode<E>* current, E element) {
-        if (current == nullptr)
-            throw runtime_error("Element not found.");
-        last = current;
-        if (element == current->element)
-            return &(current->element);
-        if (element < current->element)
-            return findPointerAux(current->left, element);
-        else
-            return findPointerAux(current->right, element);
+    template <typename Q>
+    E* searchAux(SNode<E>* current, const Q& key) {
+        while (current != nullptr) {
+            last = current;
+            int order = comparator(keyOf(key), keyOf(current->element));
+            if (order == 0)
+                return &current->element;
+            current = order < 0 ? current->left : current->right;
+        }
+        return nullptr;
     }
 
     /**
      * @brief Función auxiliar para verificar si un elemento existe en el árbol.
      *
      * @param current Nodo actual donde se busca el elemento.
-     * @param element Elemento a buscar.
+     * @param key Elemento o clave a buscar (ver keyOf).
      * @return true si el elemento existe, false en caso contrario.
      */
-    bool containsAux(SNode<E>* current, E element) {
+    template <typename Q>
+    bool containsAux(SNode<E>* current, const Q& key) {
         if (current == nullptr)
             return false;
         last = current;
-        if (element == current->element)
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order == 0)
             return true;
-        if (element < current->element)
-            return containsAux(current->left, element);
+        if (order < 0)
+            return containsAux(current->left, key);
         else
-            return containsAux(current->right, element);
+            return containsAux(current->right, key);
     }
 
     /**
      * @brief Función auxiliar para eliminar un elemento del árbol.
      *
      * @param current Nodo actual donde se intenta eliminar el elemento.
-     * @param element Elemento a eliminar.
+     * @param key Elemento o clave a eliminar (ver keyOf).
      * @param result Puntero donde se almacenará el valor del elemento eliminado.
+     * @param found Se asigna true si el elemento se encontró y se eliminó.
      * @return Nodo raíz después de la eliminación.
-     * @throw runtime_error si el elemento no existe en el árbol.
      */
-    SNode<E>* removeAux(SNode<E>* current, E element, E* result) {
+    template <typename Q>
+    SNode<E>* removeAux(SNode<E>* current, const Q& key, E* result, bool* found) {
         if (current == nullptr)
-            throw runtime_error("Element not found.");
-        if (element < current->element) {
+            return nullptr;
+        int order = comparator(keyOf(key), keyOf(current->element));
+        if (order < 0) {
             last = current;
-            current->left = removeAux(current->left, element, result);
+            current->left = removeAux(current->left, key, result, found);
             if (current->left != nullptr)
                 current->left->parent = current;
             return current;
         }
-        if (element > current->element) {
+        if (order > 0) {
             last = current;
-            current->right = removeAux(current->right, element, result);
+            current->right = removeAux(current->right, key, result, found);
             if (current->right != nullptr)
                 current->right->parent = current;
             return current;
         }
         else {
+            *found = true;
             last = current->parent;
-            *result = current->element;
             if (current->childrenCount() == 0) {
-                delete current;
+                *result = std::move(current->element);
+                destroy(resource, current);
                 return nullptr;
             }
             if (current->childrenCount() == 1) {
+                *result = std::move(current->element);
                 SNode<E>* child = current->getUniqueChild();
                 child->parent = current->parent;
-                delete current;
+                destroy(resource, current);
                 return child;
             }
             else {
+                // Se busca por el elemento del sucesor y no por element, que podría ser
+                // una referencia al elemento de este nodo y cambiar con el intercambio.
                 SNode<E>* successor = getSuccessor(current);
                 swap(current, successor);
-                current->right = removeAux(current->right, element, result);
+                current->right = removeAux(current->right, successor->element, result, found);
                 if (current->right != nullptr)
                     current->right->parent = current;
                 return current;
@@ -192,9 +204,9 @@ private:
      * @param n2 Segundo nodo.
      */
     void swap(SNode<E>* n1, SNode<E>* n2) {
-        E temp = n1->element;
-        n1->element = n2->element;
-        n2->element = temp;
+        E temp = std::move(n1->element);
+        n1->element = std::move(n2->element);
+        n2->element = std::move(temp);
     }
 
     /**
@@ -207,7 +219,7 @@ private:
             return;
         clearAux(current->left);
         clearAux(current->right);
-        delete current;
+        destroy(resource, current);
     }
 
     /**
@@ -300,21 +312,27 @@ private:
 
     /**
      * @brief Operación de splay que mueve el último nodo accedido a la raíz.
+     *
+     * @return Profundidad que tenía el nodo, igual a la cantidad de rotaciones hechas.
      */
-    void splay() {
+    int splay() {
         if (last == nullptr)
-            return;
+            return 0;
         SNode<E>* current = last;
+        int depth = 0;
         while (last != root) {
             if (current == root->left) {
                 rotateRight(root);
                 root->parent = nullptr;
+                depth++;
             }
             else if (current == root->right) {
                 rotateLeft(root);
                 root->parent = nullptr;
+                depth++;
             }
             else {
+                depth += 2;
                 SNode<E>* grand = current->parent->parent;
                 if (grand->left != nullptr && grand->left->left == current) {
                     rotateRight(grand);
@@ -334,17 +352,59 @@ private:
                 }
             }
         }
+        instrumentation.count(ROTATIONS, depth);
+        return depth;
+    }
+
+    /**
+     * @brief Construye un subárbol perfectamente balanceado con un rango de elementos ordenados.
+     *
+     * Toma el elemento central como raíz y construye los lados recursivamente. Los
+     * elementos se piden en orden creciente de posición.
+     *
+     * @param low Primera posición del rango.
+     * @param high Última posición del rango.
+     * @param element Función que recibe una posición y retorna el elemento.
+     * @return Raíz del subárbol, o nullptr si el rango está vacío.
+     */
+    template <typename Source>
+    SNode<E>* buildAux(int low, int high, Source& element) {
+        if (low > high)
+            return nullptr;
+        int middle = low + (high - low) / 2;
+        SNode<E>* left = buildAux(low, middle - 1, element);
+        SNode<E>* current = create<SNode<E>>(resource, element(middle));
+        current->left = left;
+        current->right = buildAux(middle + 1, high, element);
+        if (current->left != nullptr)
+            current->left->parent = current;
+        if (current->right != nullptr)
+            current->right->parent = current;
+        return current;
     }
 
 public:
+    typedef TreeIterator<SNode<E>, E> Iterator; ///< Iterador en orden sobre los elementos.
+
     /**
-     * @brief Constructor por defecto. Inicializa un árbol Splay vacío.
+     * @brief Constructor. Inicializa un árbol Splay vacío.
+     *
+     * @param comparator Comparador de las claves; por defecto, su orden natural.
+     * @param resource Recurso del que se obtienen los nodos (ver MemoryResource.h).
      */
-    SplayTree() {
+    explicit SplayTree(const Compare& comparator = Compare(), MemoryResource* resource = defaultResource())
+        : comparator(comparator), resource(resource) {
         root = nullptr;
         last = nullptr;
     }
 
+    /**
+     * @brief Constructor que inicializa un árbol vacío con el comparador por defecto y el recurso indicado.
+     *
+     * @param resource Recurso del que se obtienen los nodos.
+     */
+    explicit SplayTree(MemoryResource* resource) : SplayTree(Compare(), resource) {}
+
     /**
      * @brief Destructor. Libera todos los recursos utilizados.
      */
@@ -355,19 +415,49 @@ public:
     /**
      * @brief Inserta un elemento en el árbol.
      *
-     * @param element Elemento a insertar.
+     * @param element Elemento a insertar, que se copia.
      * @throw runtime_error si el elemento ya existe.
      */
-    void insert(E element) {
-        try {
-            root = insertAux(root, element);
-            root->parent = nullptr;
-            splay();
-        }
-        catch (runtime_error& e) {
-            splay();
-            throw e;
-        }
+    void insert(const E& element) {
+        insert(E(element));
+    }
+
+    /**
+     * @brief Inserta un elemento en el árbol moviéndolo.
+     *
+     * @param element Elemento a insertar, que queda en un estado válido pero no especificado.
+     * @throw runtime_error si el elemento ya existe.
+     */
+    void insert(E&& element) {
+        if (!tryInsert(std::move(element)))
+            throw runtime_error("Duplicated element.");
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol, sin lanzar excepciones si ya existe.
+     *
+     * Igual que insert(), lleva a la raíz el nodo insertado o el ya existente.
+     *
+     * @param element Elemento a insertar, que se copia.
+     * @return true si se insertó, false si el elemento ya existía.
+     */
+    bool tryInsert(const E& element) {
+        return tryInsert(E(element));
+    }
+
+    /**
+     * @brief Intenta insertar un elemento en el árbol moviéndolo, sin lanzar excepciones si ya existe.
+     *
+     * @param element Elemento a insertar; sólo se mueve si se inserta.
+     * @return true si se insertó, false si el elemento ya existía.
+     */
+    bool tryInsert(E&& element) {
+        typename Instruments::Scope scope(instrumentation, INSERT);
+        bool duplicated = false;
+        root = insertAux(root, std::move(element), &duplicated);
+        root->parent = nullptr;
+        scope.addWork(splay());
+        return !duplicated;
     }
 
     /**
@@ -377,68 +467,99 @@ public:
      * @return El elemento encontrado.
      * @throw runtime_error si el elemento no existe.
      */
-    E find(E element) {
-        try {
-            E result = findAux(root, element);
-            splay();
-            return result;
-        }
-        catch (runtime_error& e) {
-            splay();
-            throw e;
-        }
+    E find(const E& element) {
+        return *findPointer(element);
     }
 
     /**
      * @brief Busca un puntero al elemento en el árbol.
      *
+     * Lleva a la raíz el nodo encontrado o el último visitado antes de lanzar la
+     * excepción, por lo que la búsqueda no necesita capturarla para hacer el splay.
+     *
      * @param element Elemento a buscar.
      * @return Puntero al elemento encontrado.
      * @throw runtime_error si el elemento no existe.
      */
-    E* findPointer(E element) {
-        try {
-            E* result = findPointerAux(root, element);
-            splay();
-            return result;
-        }
-        catch (runtime_error& e) {
-            splay();
-            throw e;
-        }
+    E* findPointer(const E& element) {
+        E* result = search(element);
+        if (result == nullptr)
+            throw runtime_error("Element not found.");
+        return result;
     }
 
     /**
      * @brief Verifica si el árbol contiene un elemento.
      *
-     * @param element Elemento a verificar.
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
      * @return true si el elemento existe, false en caso contrario.
      */
-    bool contains(E element) {
-        bool result = containsAux(root, element);
-        splay();
+    template <typename Q>
+    bool contains(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, CONTAINS);
+        bool result = containsAux(root, key);
+        scope.addWork(splay());
+        return result;
+    }
+
+    /**
+     * @brief Busca un elemento en el árbol sin copiarlo y sin lanzar excepciones.
+     *
+     * Igual que find(), lleva a la raíz el nodo encontrado o el último visitado. El
+     * elemento apuntado no debe modificarse de forma que cambie su orden.
+     *
+     * @tparam Q Tipo de la clave buscada: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a buscar.
+     * @return Puntero al elemento dentro del árbol, o nullptr si no existe.
+     */
+    template <typename Q>
+    E* search(const Q& key) {
+        typename Instruments::Scope scope(instrumentation, FIND);
+        E* result = searchAux(root, key);
+        scope.addWork(splay());
         return result;
     }
 
     /**
      * @brief Elimina un elemento del árbol.
      *
-     * @param element Elemento a eliminar.
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
      * @return El valor del elemento eliminado.
      * @throw runtime_error si el elemento no existe.
      */
-    E remove(E element) {
-        try {
-            E result;
-            root = removeAux(root, element, &result);
-            if (root != nullptr) root->parent = nullptr;
-            splay();
-            return result;
-        }
-        catch (runtime_error& e) {
-            splay();
-            throw e;
-        }
+    template <typename Q>
+    E remove(const Q& key) {
+        E result;
+        if (!tryRemove(key, result))
+            throw runtime_error("Element not found.");
+        return result;
+    }
+
+    /**
+     * @brief Intenta eliminar un elemento del árbol, sin lanzar excepciones si no existe.
+     *
+     * Igual que remove(), lleva a la raíz el padre del nodo eliminado o el último
+     * nodo visitado.
+     *
+     * @tparam Q Tipo de la clave a eliminar: E, o un tipo comparable con la clave de los
+     *         elementos mediante el comparador (ver keyOf), sin construir un E para compararla.
+     * @param key Elemento o clave a eliminar.
+     * @param element Se asigna el elemento eliminado; no cambia si no se encuentra.
+     * @return true si se eliminó, false si el elemento no existía.
+     */
+    template <typename Q>
+    bool tryRemove(const Q& key, E& element) {
+        typename Instruments::Scope scope(instrumentation, REMOVE);
+        bool found = false;
+        root = removeAux(root, key, &element, &found);
+        if (root != nullptr) root->parent = nullptr;
+        scope.addWork(splay());
+        return found;
     }
 
     /**
@@ -460,6 +581,53 @@ public:
         return elements;
     }
 
+    /**
+     * @brief Obtiene un iterador al menor elemento, para recorrer el árbol en orden.
+     *
+     * El recorrido no copia los elementos ni modifica la forma del árbol.
+     *
+     * @return Iterador al inicio del recorrido.
+     */
+    Iterator begin() {
+        return Iterator(root);
+    }
+
+    /**
+     * @brief Obtiene el iterador de fin del recorrido.
+     *
+     * @return Iterador de fin.
+     */
+    Iterator end() {
+        return Iterator();
+    }
+
+    /**
+     * @brief Reemplaza el contenido del árbol por una secuencia estrictamente creciente.
+     *
+     * Construye en O(n) un árbol perfectamente balanceado, sin comparaciones ni
+     * rotaciones; el llamador garantiza el orden de la secuencia.
+     *
+     * @param count Cantidad de elementos.
+     * @param element Función que recibe una posición entre 0 y count - 1 y retorna el
+     *        elemento en esa posición; se llama una vez por posición, en orden.
+     */
+    template <typename Source>
+    void assignSorted(int count, Source element) {
+        clear();
+        root = buildAux(0, count - 1, element);
+    }
+
+    /**
+     * @brief Aplica una función a cada elemento en orden, sin copiarlos.
+     *
+     * @param visit Función que recibe una referencia a cada elemento.
+     */
+    template <typename F>
+    void forEach(F visit) {
+        for (Iterator it = begin(); it != end(); ++it)
+            visit(*it);
+    }
+
     /**
      * @brief Retorna el tamaño del árbol (número de nodos).
      *
@@ -469,6 +637,15 @@ public:
         return getSizeAux(root);
     }
 
+    /**
+     * @brief Obtiene el recurso del que se obtienen los nodos del árbol.
+     *
+     * @return El recurso de memoria.
+     */
+    MemoryResource* getResource() const {
+        return resource;
+    }
+
     /**
      * @brief Retorna la altura del árbol.
      *
@@ -478,6 +655,20 @@ public:
         return height(root);
     }
 
+    /**
+     * @brief Obtiene las mediciones del árbol.
+     *
+     * Si no se compiló con STRUCTURES_INSTRUMENTATION, la instantánea está vacía.
+     * El trabajo de cada operación es la profundidad del nodo que llevó a la raíz.
+     *
+     * @return Instantánea de las mediciones.
+     */
+    Stats stats() const {
+        static const char* const operations[] = { "insert", "remove", "contains", "find" };
+        static const char* const counters[] = { "rotations" };
+        return instrumentation.snapshot(operations, counters);
+    }
+
     /**
      * @brief Imprime todos los elementos del árbol.
      */
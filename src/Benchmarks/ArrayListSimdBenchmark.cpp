@@ -0,0 +1,64 @@
+/**
+ * @file ArrayListSimdBenchmark.cpp
+ * @brief Mide el rendimiento de las rutinas vectorizadas de ArrayList.
+ *
+ * Para cada nivel de instrucciones soportado (escalar, SSE2, AVX2) y para tamaños
+ * que van desde la caché L1 hasta la memoria principal, mide indexOf, count, sum,
+ * minElement y equals sobre un ArrayList<int>, en millones de elementos por segundo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <random>
+#include "Benchmark.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+
+const long long TOTAL_ELEMENTS = 1LL << 26; ///< Elementos procesados por cada caso.
+
+/**
+ * @brief Repite una operación sobre la lista y reporta su rendimiento.
+ *
+ * @param name Nombre del caso.
+ * @param n Tamaño de la lista.
+ * @param operation Operación que recorre la lista completa una vez.
+ */
+template <typename F>
+void run(const string& name, int n, F operation) {
+    long long repeats = TOTAL_ELEMENTS / n > 0 ? TOTAL_ELEMENTS / n : 1;
+    double ms = measure([&]() {
+        for (long long r = 0; r < repeats; r++)
+            operation();
+    });
+    reportRate(name, n, ms, repeats * n);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ */
+int main() {
+    // 16 KB (L1), 256 KB (L2), 4 MB (L3) y 64 MB (memoria principal) de enteros.
+    int sizes[] = { 4096, 65536, 1048576, 16777216 };
+    const char* levelNames[] = { "escalar", "SSE2", "AVX2" };
+    SimdLevel best = detectSimdLevel();
+    std::mt19937 rng(11);
+
+    for (int n : sizes) {
+        ArrayList<int> a(n);
+        ArrayList<int> b(n);
+        for (int i = 0; i < n; i++) {
+            int value = (int)(rng() % 1000000);
+            a.append(value);
+            b.append(value);
+        }
+        for (int level = SIMD_SCALAR; level <= best; level++) {
+            setSimdLevel((SimdLevel)level);
+            string suffix = string(" (") + levelNames[level] + ")";
+            run("indexOf" + suffix, n, [&]() { doNotOptimize(a.indexOf(-1)); });
+            run("count" + suffix, n, [&]() { doNotOptimize(a.count(7)); });
+            run("sum" + suffix, n, [&]() { doNotOptimize(a.sum()); });
+            run("minElement" + suffix, n, [&]() { doNotOptimize(a.minElement()); });
+            run("equals" + suffix, n, [&]() { doNotOptimize(a.equals(&b)); });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file Benchmark.h
+ * @brief Utilidades mínimas para medir tiempos en los programas de benchmark.
+ *
+ * Proporciona un cronómetro basado en std::chrono y una función que evita que el
+ * compilador elimine los resultados de las operaciones medidas.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using std::cout;
+using std::endl;
+using std::string;
+
+/**
+ * @brief Cronómetro de alta resolución.
+ *
+ * Comienza a medir al construirse y puede reiniciarse con reset().
+ */
+class Timer {
+private:
+    std::chrono::steady_clock::time_point start; ///< Instante de inicio de la medición.
+
+public:
+    /**
+     * @brief Constructor que inicia la medición.
+     */
+    Timer() {
+        reset();
+    }
+
+    /**
+     * @brief Reinicia la medición.
+     */
+    void reset() {
+        start = std::chrono::steady_clock::now();
+    }
+
+    /**
+     * @brief Obtiene el tiempo transcurrido desde el inicio.
+     *
+     * @return Tiempo transcurrido en milisegundos.
+     */
+    double elapsedMs() {
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    }
+};
+
+/**
+ * @brief Evita que el compilador descarte un valor calculado durante la medición.
+ *
+ * @param value Valor que debe considerarse utilizado.
+ */
+template <typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Devuelve al sistema la memoria libre del montículo entre dos casos medidos.
+ *
+ * Tras liberar millones de nodos, glibc los consolida en la siguiente reserva grande,
+ * lo que cargaría ese costo al caso siguiente. En otras bibliotecas no hace nada.
+ */
+inline void settleHeap() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+/**
+ * @brief Ejecuta una operación y retorna el tiempo que tardó.
+ *
+ * @param operation Función sin parámetros a medir.
+ * @return Tiempo de ejecución en milisegundos.
+ */
+template <typename F>
+double measure(F operation) {
+    Timer timer;
+    operation();
+    return timer.elapsedMs();
+}
+
+/**
+ * @brief Imprime una fila de resultados con formato uniforme.
+ *
+ * @param name Nombre del caso medido.
+ * @param n Tamaño del problema.
+ * @param ms Tiempo en milisegundos.
+ */
+inline void report(const string& name, long long n, double ms) {
+    cout << std::left << std::setw(40) << name
+         << std::right << std::setw(12) << n
+         << std::setw(14) << std::fixed << std::setprecision(3) << ms << " ms" << endl;
+}
+
+/**
+ * @brief Imprime una fila de resultados junto con el costo promedio por operación.
+ *
+ * @param name Nombre del caso medido.
+ * @param n Tamaño del problema.
+ * @param ms Tiempo total en milisegundos.
+ * @param ops Cantidad de operaciones realizadas durante la medición.
+ */
+inline void report(const string& name, long long n, double ms, long long ops) {
+    cout << std::left << std::setw(40) << name
+         << std::right << std::setw(12) << n
+         << std::setw(14) << std::fixed << std::setprecision(3) << ms << " ms"
+         << std::setw(12) << std::setprecision(2) << (ms * 1e6 / (double)ops) << " ns/op" << endl;
+}
+
+/**
+ * @brief Imprime una fila de resultados expresada como elementos procesados por segundo.
+ *
+ * @param name Nombre del caso medido.
+ * @param n Tamaño del problema.
+ * @param ms Tiempo total en milisegundos.
+ * @param items Cantidad de elementos procesados durante la medición.
+ */
+inline void reportRate(const string& name, long long n, double ms, long long items) {
+    cout << std::left << std::setw(40) << name
+         << std::right << std::setw(12) << n
+         << std::setw(14) << std::fixed << std::setprecision(3) << ms << " ms"
+         << std::setw(12) << std::setprecision(1) << ((double)items / (ms * 1e3)) << " Melem/s" << endl;
+}
@@ -0,0 +1,173 @@
+/**
+ * @file BucketQueueBenchmark.cpp
+ * @brief Compara BucketPriorityQueue con LinkedPriorityQueue y HeapPriorityQueue.
+ *
+ * Cada caso llena la cola y luego alterna removeMin + insert (modelo "hold"). Con
+ * prioridades uniformes la cubeta mínima casi siempre está cerca de 0; con prioridades
+ * monótonas (cada inserción es la prioridad extraída más un incremento, como en Dijkstra
+ * o en una simulación de eventos) el mínimo avanza y LinkedPriorityQueue tiene que
+ * recorrer cada vez más cubetas vacías desde 0. Lo mismo ocurre con muchas prioridades
+ * uniformes, porque las cubetas bajas se vacían antes de volver a llenarse; en esos casos
+ * LinkedPriorityQueue se mide con una fracción de las operaciones.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+#include "Structures/Implementations/Queues/LinkedPriorityQueue.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/BucketPriorityQueue.h"
+
+const int HELD = 100000;        ///< Elementos en la cola durante la carga uniforme.
+const int MONOTONE_HELD = 1000; ///< Elementos en la cola durante la carga monótona.
+const int MONOTONE_STEP = 64;   ///< Incremento máximo de prioridad en la carga monótona.
+const int LINKED_DIVISOR = 100; ///< Fracción de las operaciones que se mide con LinkedPriorityQueue en los casos lentos.
+
+/**
+ * @brief Llena la cola y alterna removeMin + insert con prioridades uniformes.
+ *
+ * El elemento guardado es su propia prioridad, para verificar el orden con una suma.
+ */
+template <typename Q>
+long long uniformHold(Q& queue, const std::vector<int>& priorities, int operations) {
+    long long sum = 0;
+    for (int i = 0; i < HELD; i++)
+        queue.insert(priorities[i], priorities[i]);
+    for (int i = 0; i < operations / 2; i++) {
+        sum += queue.removeMin();
+        int priority = priorities[HELD + i];
+        queue.insert(priority, priority);
+    }
+    return sum;
+}
+
+/**
+ * @brief Llena la cola y alterna removeMin + insert con prioridades crecientes.
+ */
+template <typename Q>
+long long monotoneHold(Q& queue, const std::vector<int>& steps, int operations) {
+    long long sum = 0;
+    for (int i = 0; i < MONOTONE_HELD; i++)
+        queue.insert(steps[i], steps[i]);
+    for (int i = 0; i < operations / 2; i++) {
+        int priority = queue.removeMin();
+        sum += priority;
+        priority += steps[MONOTONE_HELD + i];
+        queue.insert(priority, priority);
+    }
+    return sum;
+}
+
+/**
+ * @brief Mide los tres tipos de cola con prioridades uniformes en [0, range).
+ *
+ * @param divisor Fracción de las operaciones que se mide con LinkedPriorityQueue.
+ */
+void runUniform(int range, int operations, int divisor, std::mt19937& rng) {
+    std::vector<int> priorities(HELD + operations / 2);
+    for (size_t i = 0; i < priorities.size(); i++)
+        priorities[i] = (int)(rng() % range);
+    string suffix = " uniforme " + std::to_string(range);
+    long long expected = 0;
+    long long sum = 0;
+
+    settleHeap();
+    {
+        BucketPriorityQueue<int> queue(range);
+        double ms = measure([&]() { expected = uniformHold(queue, priorities, operations); });
+        report("BucketPriorityQueue" + suffix, range, ms, operations);
+    }
+    settleHeap();
+    {
+        int fewer = operations / divisor;
+        LinkedPriorityQueue<int> queue(range);
+        double ms = measure([&]() { sum = uniformHold(queue, priorities, fewer); });
+        report("LinkedPriorityQueue" + suffix + (divisor > 1 ? " (1/" + std::to_string(divisor) + ")" : ""),
+               range, ms, fewer);
+        if (divisor == 1 && sum != expected)
+            cout << "Error: orden distinto" << endl;
+    }
+    settleHeap();
+    {
+        HeapPriorityQueue<int> queue(HELD + 1);
+        double ms = measure([&]() { sum = uniformHold(queue, priorities, operations); });
+        report("HeapPriorityQueue" + suffix, range, ms, operations);
+        if (sum != expected)
+            cout << "Error: orden distinto" << endl;
+    }
+    cout << endl;
+}
+
+/**
+ * @brief Mide los tres tipos de cola con prioridades monótonas.
+ */
+void runMonotone(int operations, std::mt19937& rng) {
+    std::vector<int> steps(MONOTONE_HELD + operations / 2);
+    for (size_t i = 0; i < steps.size(); i++)
+        steps[i] = 1 + (int)(rng() % MONOTONE_STEP);
+
+    int range = 1;
+    long long expected = 0;
+    long long sum = 0;
+    {
+        // La cantidad de prioridades necesaria se obtiene con una pasada previa sobre un heap.
+        HeapPriorityQueue<int> queue(MONOTONE_HELD + 1);
+        int highest = 0;
+        for (int i = 0; i < MONOTONE_HELD; i++)
+            queue.insert(steps[i], steps[i]);
+        for (int i = 0; i < operations / 2; i++) {
+            int priority = queue.removeMin() + steps[MONOTONE_HELD + i];
+            if (priority > highest)
+                highest = priority;
+            queue.insert(priority, priority);
+        }
+        range = highest + 1;
+    }
+    string suffix = " monótona";
+
+    settleHeap();
+    {
+        BucketPriorityQueue<int> queue(range);
+        double ms = measure([&]() { expected = monotoneHold(queue, steps, operations); });
+        report("BucketPriorityQueue" + suffix, range, ms, operations);
+    }
+    settleHeap();
+    {
+        HeapPriorityQueue<int> queue(MONOTONE_HELD + 1);
+        double ms = measure([&]() { sum = monotoneHold(queue, steps, operations); });
+        report("HeapPriorityQueue" + suffix, range, ms, operations);
+        if (sum != expected)
+            cout << "Error: orden distinto" << endl;
+    }
+    settleHeap();
+    {
+        int fewer = operations / LINKED_DIVISOR;
+        LinkedPriorityQueue<int> queue(range);
+        double ms = measure([&]() { sum = monotoneHold(queue, steps, fewer); });
+        report("LinkedPriorityQueue" + suffix + " (1/" + std::to_string(LINKED_DIVISOR) + ")",
+               range, ms, fewer);
+    }
+    cout << endl;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de operaciones por caso como primer argumento
+ * (por defecto 1e7, la mitad extracciones y la mitad inserciones).
+ */
+int main(int argc, char** argv) {
+    int operations = argc > 1 ? atoi(argv[1]) : 10000000;
+    std::mt19937 rng(37);
+    cout << "Caso / cantidad de prioridades" << endl;
+    runUniform(16, operations, 1, rng);
+    runUniform(1024, operations, 1, rng);
+    runUniform(65536, operations, LINKED_DIVISOR, rng);
+    runMonotone(operations, rng);
+    return 0;
+}
@@ -0,0 +1,107 @@
+/**
+ * @file DequeBenchmark.cpp
+ * @brief Compara ChunkedDeque con LinkedQueue usadas como colas de doble extremo.
+ *
+ * Mide una carga FIFO, una carga de deque con operaciones aleatorias en ambos extremos
+ * alrededor de un tamaño fijo, y el recorrido completo de los elementos.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/ChunkedDeque.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+
+/**
+ * @brief Inserta n elementos al final y luego los extrae del frente.
+ */
+double fifo(Queue<int>* queue, int n) {
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            queue->enqueue(i);
+        for (int i = 0; i < n; i++)
+            sum += queue->dequeue();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Llena la cola con n elementos y aplica operaciones aleatorias en ambos extremos.
+ */
+double churn(Queue<int>* queue, int n, const std::vector<int>& operations) {
+    for (int i = 0; i < n; i++)
+        queue->enqueue(i);
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (size_t i = 0; i < operations.size(); i++) {
+            int operation = queue->isEmpty() ? 0 : operations[i];
+            switch (operation) {
+            case 0: queue->enqueue((int)i); break;
+            case 1: queue->enqueueFront((int)i); break;
+            case 2: sum += queue->dequeue(); break;
+            default: sum += queue->dequeueBack(); break;
+            }
+        }
+    });
+    doNotOptimize(sum);
+    queue->clear();
+    return ms;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de operaciones como primer argumento.
+ */
+int main(int argc, char** argv) {
+    int operationsCount = argc > 1 ? atoi(argv[1]) : 4000000;
+    int sizes[] = { 1000, 100000, 1000000 };
+    std::mt19937 rng(5);
+    std::vector<int> operations(operationsCount);
+    for (int i = 0; i < operationsCount; i++)
+        operations[i] = (int)(rng() % 4);
+
+    cout << "FIFO: n inserciones al final y n extracciones del frente" << endl;
+    for (int n : sizes) {
+        ChunkedDeque<int> chunked;
+        LinkedQueue<int> linked;
+        report("ChunkedDeque", n, fifo(&chunked, n), 2LL * n);
+        report("LinkedQueue", n, fifo(&linked, n), 2LL * n);
+    }
+
+    cout << endl << "Deque: operaciones aleatorias en ambos extremos" << endl;
+    for (int n : sizes) {
+        ChunkedDeque<int> chunked;
+        LinkedQueue<int> linked;
+        report("ChunkedDeque", n, churn(&chunked, n, operations), operationsCount);
+        report("LinkedQueue", n, churn(&linked, n, operations), operationsCount);
+    }
+
+    cout << endl << "Recorrido de todos los elementos" << endl;
+    for (int n : sizes) {
+        ChunkedDeque<int> chunked;
+        for (int i = 0; i < n; i++)
+            chunked.enqueue(i);
+        long long sum = 0;
+        double ms = measure([&]() {
+            chunked.forEachChunk([&](const int* data, int count) {
+                for (int i = 0; i < count; i++)
+                    sum += data[i];
+            });
+        });
+        doNotOptimize(sum);
+        reportRate("ChunkedDeque forEachChunk", n, ms, n);
+        ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                sum += chunked.get(i);
+        });
+        doNotOptimize(sum);
+        reportRate("ChunkedDeque get(i)", n, ms, n);
+    }
+    return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file DictionaryEnumerationBenchmark.cpp
+ * @brief Compara las formas de recorrer todos los pares de un diccionario.
+ *
+ * Para cada diccionario se suman todas las claves y valores de cuatro maneras:
+ * getKeys() y getValues(), que construyen dos listas nuevas; forEach() sobre el tipo
+ * concreto; forEach() a través de la interfaz Dictionary, que pasa por accept(); y los
+ * iteradores keys() y values() con un for de rango. Sólo las listas reservan memoria.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Dictionaries/SplayDictionary.h"
+
+/**
+ * @brief Mide las cuatro formas de recorrer un diccionario ya lleno.
+ */
+template <typename D>
+void benchmarkEnumeration(const string& name, D& dictionary, int n) {
+    double ms = measure([&]() {
+        List<int>* keys = dictionary.getKeys();
+        List<int>* values = dictionary.getValues();
+        long long sum = 0;
+        for (keys->goToStart(); !keys->atEnd(); keys->next())
+            sum += keys->getElement();
+        for (values->goToStart(); !values->atEnd(); values->next())
+            sum += values->getElement();
+        doNotOptimize(sum);
+        delete keys;
+        delete values;
+    });
+    report(name + " getKeys + getValues", n, ms, n);
+    settleHeap();
+
+    ms = measure([&]() {
+        long long sum = 0;
+        dictionary.forEach([&sum](const int& key, int& value) { sum += key + value; });
+        doNotOptimize(sum);
+    });
+    report(name + " forEach", n, ms, n);
+
+    Dictionary<int, int>& base = dictionary;
+    ms = measure([&]() {
+        long long sum = 0;
+        base.forEach([&sum](const int& key, int& value) { sum += key + value; });
+        doNotOptimize(sum);
+    });
+    report(name + " forEach (interfaz)", n, ms, n);
+
+    ms = measure([&]() {
+        long long sum = 0;
+        for (const int& key : dictionary.keys())
+            sum += key;
+        for (int& value : dictionary.values())
+            sum += value;
+        doNotOptimize(sum);
+    });
+    report(name + " keys + values", n, ms, n);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de pares como primer argumento (por defecto 1000000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++)
+        keys[i] = i;
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+
+    {
+        HashTable<int, int> dictionary;
+        for (int i = 0; i < n; i++)
+            dictionary.insert(keys[i], i);
+        benchmarkEnumeration("HashTable", dictionary, n);
+    }
+    settleHeap();
+    {
+        AVLDictionary<int, int> dictionary;
+        for (int i = 0; i < n; i++)
+            dictionary.insert(keys[i], i);
+        benchmarkEnumeration("AVLDictionary", dictionary, n);
+    }
+    settleHeap();
+    {
+        SplayDictionary<int, int> dictionary;
+        for (int i = 0; i < n; i++)
+            dictionary.insert(keys[i], i);
+        benchmarkEnumeration("SplayDictionary", dictionary, n);
+    }
+    settleHeap();
+    {
+        SortedArrayDictionary<int, int> dictionary;
+        for (int i = 0; i < n; i++)
+            dictionary.insert(i, keys[i]);
+        benchmarkEnumeration("SortedArrayDictionary", dictionary, n);
+    }
+    return 0;
+}
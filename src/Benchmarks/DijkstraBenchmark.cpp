@@ -0,0 +1,153 @@
+/**
+ * @file DijkstraBenchmark.cpp
+ * @brief Compara las colas de prioridad en el algoritmo de Dijkstra sobre un grafo grande.
+ *
+ * HeapPriorityQueue no permite reducir prioridades, así que se usa con inserciones
+ * repetidas y se descartan las entradas obsoletas. IndexedHeapPriorityQueue y
+ * PairingHeapPriorityQueue usan decreaseKey() con un handle por nodo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <climits>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/IndexedHeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/PairingHeapPriorityQueue.h"
+
+const int DEGREE = 4;       ///< Aristas aleatorias por nodo (además de la arista al siguiente nodo).
+const int MAX_WEIGHT = 1000; ///< Peso máximo de una arista.
+
+/**
+ * @brief Grafo dirigido en formato de listas de adyacencia comprimidas.
+ */
+struct Graph {
+    int nodes;                 ///< Cantidad de nodos.
+    std::vector<int> offsets;  ///< Inicio de las aristas de cada nodo en targets.
+    std::vector<int> targets;  ///< Destino de cada arista.
+    std::vector<int> weights;  ///< Peso de cada arista.
+};
+
+/**
+ * @brief Genera un grafo aleatorio con n nodos.
+ */
+Graph makeGraph(int n, std::mt19937& rng) {
+    Graph graph;
+    graph.nodes = n;
+    graph.offsets.push_back(0);
+    for (int u = 0; u < n; u++) {
+        graph.targets.push_back((u + 1) % n);
+        graph.weights.push_back((int)(rng() % MAX_WEIGHT) + 1);
+        for (int e = 0; e < DEGREE; e++) {
+            graph.targets.push_back((int)(rng() % n));
+            graph.weights.push_back((int)(rng() % MAX_WEIGHT) + 1);
+        }
+        graph.offsets.push_back((int)graph.targets.size());
+    }
+    return graph;
+}
+
+/**
+ * @brief Dijkstra con HeapPriorityQueue e inserciones repetidas.
+ */
+std::vector<int> lazyDijkstra(const Graph& graph) {
+    std::vector<int> distance(graph.nodes, INT_MAX);
+    HeapPriorityQueue<int> queue((int)graph.targets.size() + 1);
+    std::vector<bool> done(graph.nodes, false);
+    distance[0] = 0;
+    queue.insert(0, 0);
+    while (!queue.isEmpty()) {
+        int u = queue.removeMin();
+        if (done[u])
+            continue;
+        done[u] = true;
+        for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+            int v = graph.targets[e];
+            int candidate = distance[u] + graph.weights[e];
+            if (candidate < distance[v]) {
+                distance[v] = candidate;
+                queue.insert(v, candidate);
+            }
+        }
+    }
+    return distance;
+}
+
+/**
+ * @brief Dijkstra con una cola direccionable y decreaseKey().
+ *
+ * @tparam Q Tipo de la cola.
+ * @tparam H Tipo de los handles de la cola.
+ */
+template <typename Q, typename H>
+std::vector<int> decreaseKeyDijkstra(const Graph& graph, Q& queue) {
+    std::vector<int> distance(graph.nodes, INT_MAX);
+    std::vector<H> handles(graph.nodes);
+    std::vector<char> state(graph.nodes, 0); // 0: sin visitar, 1: en la cola, 2: terminado
+    distance[0] = 0;
+    handles[0] = queue.push(0, 0);
+    state[0] = 1;
+    while (!queue.isEmpty()) {
+        int u = queue.removeMin();
+        state[u] = 2;
+        for (int e = graph.offsets[u]; e < graph.offsets[u + 1]; e++) {
+            int v = graph.targets[e];
+            int candidate = distance[u] + graph.weights[e];
+            if (state[v] == 2 || candidate >= distance[v])
+                continue;
+            distance[v] = candidate;
+            if (state[v] == 0) {
+                handles[v] = queue.push(v, candidate);
+                state[v] = 1;
+            } else {
+                queue.decreaseKey(handles[v], candidate);
+            }
+        }
+    }
+    return distance;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de nodos como primer argumento.
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    std::mt19937 rng(13);
+    Graph graph = makeGraph(n, rng);
+    long long edges = (long long)graph.targets.size();
+    cout << "Dijkstra sobre " << n << " nodos y " << edges << " aristas" << endl;
+
+    std::vector<int> expected;
+    double ms = measure([&]() { expected = lazyDijkstra(graph); });
+    report("HeapPriorityQueue (inserción repetida)", n, ms, edges);
+
+    std::vector<int> result;
+    {
+        IndexedHeapPriorityQueue<int, 2> queue(n);
+        ms = measure([&]() { result = decreaseKeyDijkstra<IndexedHeapPriorityQueue<int, 2>, int>(graph, queue); });
+        report("IndexedHeapPriorityQueue<int, 2>", n, ms, edges);
+        if (result != expected)
+            cout << "Error: distancias distintas" << endl;
+    }
+    {
+        IndexedHeapPriorityQueue<int, 4> queue(n);
+        ms = measure([&]() { result = decreaseKeyDijkstra<IndexedHeapPriorityQueue<int, 4>, int>(graph, queue); });
+        report("IndexedHeapPriorityQueue<int, 4>", n, ms, edges);
+        if (result != expected)
+            cout << "Error: distancias distintas" << endl;
+    }
+    {
+        PairingHeapPriorityQueue<int> queue;
+        typedef PairingHeapPriorityQueue<int>::Handle Handle;
+        ms = measure([&]() { result = decreaseKeyDijkstra<PairingHeapPriorityQueue<int>, Handle>(graph, queue); });
+        report("PairingHeapPriorityQueue", n, ms, edges);
+        if (result != expected)
+            cout << "Error: distancias distintas" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file GrowableBenchmark.cpp
+ * @brief Compara ArrayStack y ArrayQueue en modo creciente con sus variantes enlazadas.
+ *
+ * Las estructuras basadas en arreglo empiezan con capacidad 16 y crecen según sea
+ * necesario; se mide llenar y vaciar n elementos, y una carga en estado estable.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/ArrayQueue.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+#include "Structures/Implementations/Stacks/ArrayStack.h"
+#include "Structures/Implementations/Stacks/LinkedStack.h"
+
+const int INITIAL_CAPACITY = 16; ///< Capacidad inicial de las estructuras crecientes.
+
+/**
+ * @brief Inserta n elementos en la pila y luego los extrae.
+ */
+double fillStack(Stack<int>* stack, int n) {
+    settleHeap();
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            stack->push(i);
+        for (int i = 0; i < n; i++)
+            sum += stack->pop();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Inserta n elementos en la cola y luego los extrae.
+ */
+double fillQueue(Queue<int>* queue, int n) {
+    settleHeap();
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            queue->enqueue(i);
+        for (int i = 0; i < n; i++)
+            sum += queue->dequeue();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Mantiene n elementos en la cola y alterna una inserción con una extracción.
+ */
+double steadyQueue(Queue<int>* queue, int n, int operations) {
+    for (int i = 0; i < n; i++)
+        queue->enqueue(i);
+    settleHeap();
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int i = 0; i < operations; i++) {
+            queue->enqueue(i);
+            sum += queue->dequeue();
+        }
+    });
+    doNotOptimize(sum);
+    queue->clear();
+    return ms;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de operaciones en estado estable como primer argumento.
+ */
+int main(int argc, char** argv) {
+    int operations = argc > 1 ? atoi(argv[1]) : 4000000;
+    int sizes[] = { 1000, 100000, 10000000 };
+
+    cout << "Pilas: n push seguidos de n pop" << endl;
+    for (int n : sizes) {
+        ArrayStack<int> array(INITIAL_CAPACITY, true);
+        LinkedStack<int> linked;
+        report("ArrayStack (creciente)", n, fillStack(&array, n), 2LL * n);
+        report("LinkedStack", n, fillStack(&linked, n), 2LL * n);
+    }
+
+    cout << endl << "Colas: n enqueue seguidos de n dequeue" << endl;
+    for (int n : sizes) {
+        ArrayQueue<int> array(INITIAL_CAPACITY, true);
+        LinkedQueue<int> linked;
+        report("ArrayQueue (creciente)", n, fillQueue(&array, n), 2LL * n);
+        report("LinkedQueue", n, fillQueue(&linked, n), 2LL * n);
+    }
+
+    cout << endl << "Colas en estado estable: enqueue + dequeue con n elementos" << endl;
+    for (int n : sizes) {
+        ArrayQueue<int> array(INITIAL_CAPACITY, true);
+        LinkedQueue<int> linked;
+        report("ArrayQueue (creciente)", n, steadyQueue(&array, n, operations), 2LL * operations);
+        report("LinkedQueue", n, steadyQueue(&linked, n, operations), 2LL * operations);
+    }
+    return 0;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file HeapArityBenchmark.cpp
+ * @brief Compara MinHeap con distintas aridades para varios tamaños.
+ *
+ * Para cada tamaño mide la construcción con inserciones sucesivas, la construcción
+ * con heapify (Floyd) y una carga en estado estable de removeFirst + insert.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/MinHeap.h"
+
+const int OPERATIONS = 1000000; ///< Pares removeFirst + insert en estado estable.
+
+/**
+ * @brief Mide un heap de aridad D con los valores dados.
+ */
+template <int D>
+void run(const std::vector<int>& values, const std::vector<int>& incoming) {
+    int n = (int)values.size();
+    string name = "MinHeap<int, " + std::to_string(D) + ">";
+    MinHeap<int, D> heap(n);
+
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            heap.insert(values[i]);
+    });
+    report(name + " insert", n, ms, n);
+
+    heap.clear();
+    ms = measure([&]() {
+        heap.heapify(values.data(), n);
+    });
+    report(name + " heapify", n, ms, n);
+
+    long long sum = 0;
+    ms = measure([&]() {
+        for (int i = 0; i < OPERATIONS; i++) {
+            sum += heap.removeFirst();
+            heap.insert(incoming[i]);
+        }
+    });
+    doNotOptimize(sum);
+    report(name + " removeFirst+insert", n, ms, OPERATIONS);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente el tamaño máximo como primer argumento (por defecto 1e7; 1e8
+ * requiere unos 400 MB por heap).
+ */
+int main(int argc, char** argv) {
+    long long largest = argc > 1 ? atoll(argv[1]) : 10000000;
+    std::mt19937 rng(9);
+    std::vector<int> incoming(OPERATIONS);
+    for (int i = 0; i < OPERATIONS; i++)
+        incoming[i] = (int)(rng() & 0x7FFFFFFF);
+
+    for (long long n = 1000; n <= largest; n *= 10) {
+        std::vector<int> values((size_t)n);
+        for (long long i = 0; i < n; i++)
+            values[(size_t)i] = (int)(rng() & 0x7FFFFFFF);
+        run<2>(values, incoming);
+        run<4>(values, incoming);
+        run<8>(values, incoming);
+        cout << endl;
+    }
+    return 0;
+}
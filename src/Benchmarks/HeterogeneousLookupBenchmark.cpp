@@ -0,0 +1,130 @@
+/**
+ * @file HeterogeneousLookupBenchmark.cpp
+ * @brief Mide las búsquedas con claves string y las reservas de memoria que hacen.
+ *
+ * Las claves miden más de 15 caracteres, de modo que cada string construido reserva
+ * memoria. Para cada diccionario se busca de tres formas:
+ *
+ * - string: la clave ya existe como string.
+ * - string(const char*): la clave llega como cadena de C y se convierte, como era
+ *   necesario antes de la búsqueda heterogénea.
+ * - const char*: búsqueda heterogénea (ver TransparentKey), sin construir un string.
+ *
+ * Se reemplaza el operator new global para contar las reservas durante cada medición.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Dictionaries/SplayDictionary.h"
+
+static long long allocations = 0; ///< Reservas hechas con operator new.
+
+void* operator new(std::size_t size) {
+    allocations++;
+    void* memory = malloc(size);
+    if (memory == nullptr)
+        throw std::bad_alloc();
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    free(memory);
+}
+
+const int LOOKUPS = 1000000; ///< Búsquedas por caso.
+
+/**
+ * @brief Imprime una fila de resultados con el costo y las reservas por búsqueda.
+ */
+void reportLookups(const string& name, int n, double ms, long long reserved) {
+    cout << std::left << std::setw(44) << name
+         << std::right << std::setw(10) << n
+         << std::setw(12) << std::fixed << std::setprecision(2) << (ms * 1e6 / LOOKUPS) << " ns/op"
+         << std::setw(10) << std::setprecision(2) << ((double)reserved / LOOKUPS) << " reservas/op" << endl;
+}
+
+/**
+ * @brief Mide las tres formas de búsqueda sobre un diccionario ya lleno.
+ */
+template <typename D>
+void benchmarkLookups(const string& name, D& dictionary, int n, const std::vector<string>& keys,
+                      const std::vector<int>& probes) {
+    long long reserved = allocations;
+    double ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            sum += dictionary.getValue(keys[probes[i]]);
+        doNotOptimize(sum);
+    });
+    reportLookups(name + " string", n, ms, allocations - reserved);
+
+    reserved = allocations;
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            sum += dictionary.getValue(string(keys[probes[i]].c_str()));
+        doNotOptimize(sum);
+    });
+    reportLookups(name + " string(const char*)", n, ms, allocations - reserved);
+
+    reserved = allocations;
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            sum += dictionary.getValue(keys[probes[i]].c_str());
+        doNotOptimize(sum);
+    });
+    reportLookups(name + " const char*", n, ms, allocations - reserved);
+}
+
+/**
+ * @brief Llena un diccionario y mide sus búsquedas.
+ */
+template <typename D>
+void run(const string& name, int n, const std::vector<string>& keys, const std::vector<int>& probes) {
+    D dictionary;
+    for (int i = 0; i < n; i++)
+        dictionary.insert(keys[i], i);
+    benchmarkLookups(name, dictionary, n, keys, probes);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de claves como primer argumento (por defecto 100000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    std::vector<string> keys(n);
+    char buffer[64];
+    for (int i = 0; i < n; i++) {
+        snprintf(buffer, sizeof(buffer), "session:%010d:user", i * 7919);
+        keys[i] = buffer;
+    }
+    std::mt19937 rng(42);
+    std::vector<int> probes(LOOKUPS);
+    for (int i = 0; i < LOOKUPS; i++)
+        probes[i] = (int)(rng() % n);
+
+    run<HashTable<string, int>>("HashTable", n, keys, probes);
+    settleHeap();
+    run<AVLDictionary<string, int>>("AVLDictionary", n, keys, probes);
+    settleHeap();
+    run<SplayDictionary<string, int>>("SplayDictionary", n, keys, probes);
+    settleHeap();
+    run<SortedArrayDictionary<string, int>>("SortedArrayDictionary", n, keys, probes);
+    return 0;
+}
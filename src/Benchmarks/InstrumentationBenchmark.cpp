@@ -0,0 +1,121 @@
+/**
+ * @file InstrumentationBenchmark.cpp
+ * @brief Mide los contenedores instrumentados y muestra sus mediciones en JSON.
+ *
+ * Compilado normalmente, la instrumentación está vacía: los tiempos son los de los
+ * contenedores sin instrumentar y stats() retorna instantáneas deshabilitadas. Compilado
+ * con -DSTRUCTURES_INSTRUMENTATION=ON en CMake, se imprime además la instantánea de cada
+ * contenedor (sondeos de HashTable, rotaciones de AVLTree, profundidad de splay,
+ * desplazamientos de ArrayList y niveles de MinHeap) y la diferencia de tiempos entre
+ * ambas compilaciones es el costo de la instrumentación.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Queues/MinHeap.h"
+#include "Structures/Implementations/Trees/AVLTree.h"
+#include "Structures/Implementations/Trees/SplayTree.h"
+
+/**
+ * @brief Imprime la instantánea de un contenedor si la instrumentación está compilada.
+ */
+void printStats(const string& name, const Stats& stats) {
+    if (stats.enabled)
+        cout << "  " << name << ": " << stats.toJson() << endl;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de elementos como primer argumento (por defecto 100000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++)
+        keys[i] = i;
+    std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+#if defined(STRUCTURES_INSTRUMENTATION)
+    cout << "Instrumentación activa" << endl;
+#else
+    cout << "Instrumentación deshabilitada" << endl;
+#endif
+
+    {
+        HashTable<int, int> table;
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                table.insert(keys[i], i);
+            long long sum = 0;
+            for (int i = 0; i < n; i++)
+                sum += table.getValue(keys[i]);
+            doNotOptimize(sum);
+        });
+        report("HashTable insert + getValue", n, ms, 2LL * n);
+        printStats("HashTable", table.stats());
+    }
+    {
+        AVLTree<int> tree;
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                tree.insert(keys[i]);
+            for (int i = 0; i < n; i += 2)
+                tree.remove(keys[i]);
+        });
+        report("AVLTree insert + remove", n, ms, n + n / 2);
+        printStats("AVLTree", tree.stats());
+    }
+    {
+        SplayTree<int> tree;
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> hot(0, n / 100 > 0 ? n / 100 : 0);
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                tree.insert(keys[i]);
+            int found = 0;
+            for (int i = 0; i < n; i++)
+                found += tree.contains(keys[hot(rng)]);
+            doNotOptimize(found);
+        });
+        report("SplayTree insert + contains (1% caliente)", n, ms, 2LL * n);
+        printStats("SplayTree", tree.stats());
+    }
+    {
+        ArrayList<int> list;
+        int count = n < 20000 ? n : 20000;
+        double ms = measure([&]() {
+            for (int i = 0; i < count; i++) {
+                list.goToPos(list.getSize() / 2);
+                list.insert(keys[i]);
+            }
+            list.goToStart();
+            for (int i = 0; i < count / 2; i++)
+                list.remove();
+        });
+        report("ArrayList insert al medio + remove al inicio", count, ms, count + count / 2);
+        printStats("ArrayList", list.stats());
+    }
+    {
+        MinHeap<int> heap(1024, true);
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                heap.insert(keys[i]);
+            for (int i = 0; i < n; i++)
+                heap.replaceTop(keys[i]);
+            long long sum = 0;
+            while (!heap.isEmpty())
+                sum += heap.removeFirst();
+            doNotOptimize(sum);
+        });
+        report("MinHeap insert + replaceTop + removeFirst", n, ms, 3LL * n);
+        printStats("MinHeap", heap.stats());
+    }
+    return 0;
+}
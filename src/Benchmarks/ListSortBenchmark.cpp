@@ -0,0 +1,80 @@
+/**
+ * @file ListSortBenchmark.cpp
+ * @brief Mide el ordenamiento de listas y su escalabilidad con la cantidad de hilos.
+ *
+ * Mide ArrayList::sort() y ArrayList::stableSort() con claves enteras (radix sort) y
+ * reales (introsort / merge sort) variando los hilos, y el merge sort por reenlace de
+ * DLinkedList y LinkedList. Como referencia se incluye std::sort sobre un std::vector.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Lists/DLinkedList.h"
+#include "Structures/Implementations/Lists/LinkedList.h"
+
+/**
+ * @brief Mide el ordenamiento de un ArrayList lleno con los valores indicados.
+ *
+ * @param name Nombre del caso.
+ * @param values Valores a ordenar.
+ * @param stable Indica si se usa stableSort().
+ * @param threads Cantidad de hilos.
+ */
+template <typename E>
+void runArray(const string& name, const std::vector<E>& values, bool stable, int threads) {
+    int n = (int)values.size();
+    ArrayList<E> list(n);
+    for (int i = 0; i < n; i++)
+        list.append(values[i]);
+    double ms = measure([&]() {
+        if (stable)
+            list.stableSort(threads);
+        else
+            list.sort(threads);
+    });
+    report(name + " hilos=" + std::to_string(threads), n, ms);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Cantidad opcional de elementos.
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 4000000;
+    int maxThreads = std::max(8, (int)std::thread::hardware_concurrency());
+    std::mt19937 rng(3);
+
+    std::vector<int> ints(n);
+    std::vector<double> doubles(n);
+    for (int i = 0; i < n; i++) {
+        ints[i] = (int)rng();
+        doubles[i] = (double)rng() / 7.0;
+    }
+
+    std::vector<int> reference(ints);
+    report("std::sort (vector<int>)", n, measure([&]() { std::sort(reference.begin(), reference.end()); }));
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        runArray("ArrayList<int>::sort", ints, false, threads);
+        runArray("ArrayList<double>::sort", doubles, false, threads);
+        runArray("ArrayList<double>::stableSort", doubles, true, threads);
+    }
+
+    int linkedSize = n / 4;
+    DLinkedList<int> dlist;
+    LinkedList<int> slist;
+    for (int i = 0; i < linkedSize; i++) {
+        dlist.append(ints[i]);
+        slist.append(ints[i]);
+    }
+    report("DLinkedList<int>::sort", linkedSize, measure([&]() { dlist.sort(); }));
+    report("LinkedList<int>::sort", linkedSize, measure([&]() { slist.sort(); }));
+    return 0;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file MPMCQueueBenchmark.cpp
+ * @brief Mide cómo escalan las colas concurrentes con varios productores y consumidores.
+ *
+ * Compara LockFreeQueue (Michael-Scott) y MPMCQueue (acotada, de Vyukov) con una
+ * LinkedQueue protegida por un mutex, usando de 1 a 32 productores y la misma cantidad
+ * de consumidores (de 2 a 64 hilos en total).
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+#include "Structures/Implementations/Queues/LockFreeQueue.h"
+#include "Structures/Implementations/Queues/MPMCQueue.h"
+
+/**
+ * @brief LinkedQueue protegida por un mutex, como punto de comparación.
+ */
+class LockedQueue {
+private:
+    LinkedQueue<long> queue; ///< Cola protegida.
+    std::mutex mutex;        ///< Mutex que protege la cola.
+
+public:
+    void enqueue(long element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(element);
+    }
+
+    bool tryDequeue(long& element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isEmpty())
+            return false;
+        element = queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * @brief Pasa n mensajes por la cola con la cantidad indicada de productores y consumidores.
+ *
+ * @return Tiempo total en milisegundos.
+ */
+template <typename Q>
+double run(Q& queue, int pairs, long n) {
+    long perProducer = n / pairs;
+    long total = perProducer * pairs;
+    std::atomic<long> consumed(0);
+    std::atomic<long> sum(0);
+    double ms = measure([&]() {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < pairs; p++)
+            threads.push_back(std::thread([&, p]() {
+                for (long i = 0; i < perProducer; i++)
+                    queue.enqueue(p * perProducer + i);
+            }));
+        for (int c = 0; c < pairs; c++)
+            threads.push_back(std::thread([&]() {
+                long element;
+                long local = 0;
+                int attempt = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    if (queue.tryDequeue(element)) {
+                        local += element;
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                        attempt = 0;
+                    } else {
+                        spinWait(attempt++);
+                    }
+                }
+                sum.fetch_add(local);
+            }));
+        for (size_t t = 0; t < threads.size(); t++)
+            threads[t].join();
+    });
+    if (sum.load() != total * (total - 1) / 2)
+        cout << "Error: suma incorrecta" << endl;
+    return ms;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de mensajes como primer argumento.
+ */
+int main(int argc, char** argv) {
+    long n = argc > 1 ? atol(argv[1]) : 2000000;
+    int pairCounts[] = { 1, 2, 4, 8, 16, 32 };
+
+    cout << "Mensajes por segundo según la cantidad de productores/consumidores" << endl;
+    for (int pairs : pairCounts) {
+        cout << pairs << " productores, " << pairs << " consumidores" << endl;
+        {
+            LockedQueue queue;
+            reportRate("  LinkedQueue + mutex", n, run(queue, pairs, n), n);
+        }
+        {
+            LockFreeQueue<long> queue;
+            reportRate("  LockFreeQueue", n, run(queue, pairs, n), n);
+        }
+        {
+            MPMCQueue<long> queue(4096);
+            reportRate("  MPMCQueue", n, run(queue, pairs, n), n);
+        }
+    }
+    return 0;
+}
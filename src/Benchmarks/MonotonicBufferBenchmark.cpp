@@ -0,0 +1,109 @@
+/**
+ * @file MonotonicBufferBenchmark.cpp
+ * @brief Compara diccionarios de vida corta con el recurso por defecto y con MonotonicBuffer.
+ *
+ * Cada "petición" crea un diccionario, inserta k pares, hace k búsquedas y lo destruye,
+ * como un diccionario temporal que vive lo que dura una petición. Se mide la misma carga
+ * con tres recursos de memoria (ver MemoryResource.h):
+ *
+ * - new/delete: el recurso por defecto; cada nodo y arreglo es una reserva del montículo.
+ * - MonotonicBuffer: un recurso por petición que pide bloques crecientes al montículo y
+ *   los devuelve todos juntos al terminar; liberar un nodo no cuesta nada.
+ * - MonotonicBuffer sobre arreglo: igual, pero sobre un arreglo reservado una sola vez,
+ *   de modo que una petición que cabe en él no toca el montículo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Common/MemoryResource.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+
+const int REQUESTS = 5000;               ///< Peticiones por caso.
+const std::size_t ARENA_SIZE = 1 << 20;  ///< Tamaño del arreglo del tercer caso.
+
+alignas(std::max_align_t) static char arena[ARENA_SIZE]; ///< Arreglo reutilizado por todas las peticiones.
+
+/**
+ * @brief Atiende una petición: llena un diccionario con el recurso indicado y lo consulta.
+ *
+ * @return La suma de los valores encontrados.
+ */
+template <typename D>
+long long serve(MemoryResource* resource, const std::vector<int>& keys) {
+    D dictionary(resource);
+    for (size_t i = 0; i < keys.size(); i++)
+        dictionary.insert(keys[i], (int)i);
+    long long sum = 0;
+    int value;
+    for (size_t i = 0; i < keys.size(); i++)
+        if (dictionary.tryGet(keys[i], value))
+            sum += value;
+    return sum;
+}
+
+/**
+ * @brief Mide la misma serie de peticiones con los tres recursos.
+ */
+template <typename D>
+void run(const string& name, const std::vector<std::vector<int>>& requests) {
+    int k = (int)requests[0].size();
+    long long ops = (long long)REQUESTS * k * 2;
+
+    double ms = measure([&]() {
+        long long sum = 0;
+        for (int r = 0; r < REQUESTS; r++)
+            sum += serve<D>(defaultResource(), requests[r]);
+        doNotOptimize(sum);
+    });
+    report(name + " new/delete", k, ms, ops);
+    settleHeap();
+
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int r = 0; r < REQUESTS; r++) {
+            MonotonicBuffer buffer(64 * 1024);
+            sum += serve<D>(&buffer, requests[r]);
+        }
+        doNotOptimize(sum);
+    });
+    report(name + " monotonic", k, ms, ops);
+    settleHeap();
+
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int r = 0; r < REQUESTS; r++) {
+            MonotonicBuffer buffer(arena, ARENA_SIZE);
+            sum += serve<D>(&buffer, requests[r]);
+        }
+        doNotOptimize(sum);
+    });
+    report(name + " monotonic (arreglo)", k, ms, ops);
+    settleHeap();
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de pares por petición como primer argumento (por
+ * defecto 200).
+ */
+int main(int argc, char** argv) {
+    int k = argc > 1 ? atoi(argv[1]) : 200;
+    std::mt19937 rng(42);
+    std::vector<std::vector<int>> requests(REQUESTS, std::vector<int>(k));
+    for (int r = 0; r < REQUESTS; r++)
+        for (int i = 0; i < k; i++)
+            requests[r][i] = (int)(rng() % 1000) * k + i;
+
+    run<HashTable<int, int>>("HashTable", requests);
+    run<AVLDictionary<int, int>>("AVLDictionary", requests);
+    run<SortedArrayDictionary<int, int>>("SortedArrayDictionary", requests);
+    return 0;
+}
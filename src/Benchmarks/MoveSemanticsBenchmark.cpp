@@ -0,0 +1,222 @@
+/**
+ * @file MoveSemanticsBenchmark.cpp
+ * @brief Cuenta las copias de un valor grande al insertarlo y consultarlo en los contenedores.
+ *
+ * El tipo Payload guarda un bloque de memoria dinámica y cuenta cuántas veces se copia y
+ * cuántas se mueve. Para cada contenedor se compara la inserción por copia con la inserción
+ * por movimiento (o emplace), y la consulta por valor (getValue) con las consultas por
+ * referencia (at y find). Cada fila muestra el tiempo y las copias por operación.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+
+/**
+ * @brief Valor de tamaño considerable que cuenta sus copias y movimientos.
+ */
+struct Payload {
+    static const int SIZE = 256; ///< Cantidad de bytes del bloque.
+    static long long copies;     ///< Copias realizadas desde el último reinicio.
+    static long long moves;      ///< Movimientos realizados desde el último reinicio.
+
+    char* data; ///< Bloque de memoria dinámica; nullptr después de moverse.
+
+    Payload() : data(nullptr) {}
+
+    explicit Payload(int seed) : data(new char[SIZE]) {
+        memset(data, seed & 0x7F, SIZE);
+    }
+
+    Payload(const Payload& other) : data(other.data == nullptr ? nullptr : new char[SIZE]) {
+        if (data != nullptr)
+            memcpy(data, other.data, SIZE);
+        copies++;
+    }
+
+    Payload(Payload&& other) noexcept : data(other.data) {
+        other.data = nullptr;
+        moves++;
+    }
+
+    Payload& operator=(const Payload& other) {
+        if (this != &other) {
+            Payload copy(other);
+            std::swap(data, copy.data);
+        }
+        return *this;
+    }
+
+    Payload& operator=(Payload&& other) noexcept {
+        std::swap(data, other.data);
+        moves++;
+        return *this;
+    }
+
+    ~Payload() {
+        delete[] data;
+    }
+
+    bool operator==(const Payload& other) const {
+        return data == other.data || (data != nullptr && other.data != nullptr && memcmp(data, other.data, SIZE) == 0);
+    }
+
+    bool operator!=(const Payload& other) const {
+        return !(*this == other);
+    }
+
+    bool operator<(const Payload& other) const {
+        return data != nullptr && other.data != nullptr && data[0] < other.data[0];
+    }
+
+    /**
+     * @brief Reinicia los contadores de copias y movimientos.
+     */
+    static void reset() {
+        copies = 0;
+        moves = 0;
+    }
+};
+
+long long Payload::copies = 0;
+long long Payload::moves = 0;
+
+std::ostream& operator<<(std::ostream& out, const Payload& payload) {
+    return out << (payload.data == nullptr ? '-' : payload.data[0]);
+}
+
+/**
+ * @brief Imprime una fila de resultados junto con las copias por operación.
+ */
+void reportCopies(const string& name, long long n, double ms) {
+    report(name, n, ms, n);
+    cout << "    copias/op: " << std::setprecision(2) << (double)Payload::copies / (double)n
+         << ", movimientos/op: " << (double)Payload::moves / (double)n << endl;
+}
+
+/**
+ * @brief Mide la inserción y la consulta de valores grandes en un diccionario.
+ */
+template <typename D>
+void benchmarkDictionary(const string& name, int n) {
+    {
+        D dictionary;
+        Payload::reset();
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++) {
+                Payload value(i);
+                dictionary.insert(i, value);
+            }
+        });
+        reportCopies(name + " insert (copia)", n, ms);
+    }
+    settleHeap();
+    D dictionary;
+    Payload::reset();
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            dictionary.insert(i, Payload(i));
+    });
+    reportCopies(name + " insert (movimiento)", n, ms);
+
+    Payload::reset();
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < n; i++)
+            sum += dictionary.getValue(i).data[0];
+        doNotOptimize(sum);
+    });
+    reportCopies(name + " getValue", n, ms);
+
+    Payload::reset();
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < n; i++)
+            sum += dictionary.at(i).data[0];
+        doNotOptimize(sum);
+    });
+    reportCopies(name + " at", n, ms);
+
+    Payload::reset();
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < n; i++)
+            sum += dictionary.find(i)->data[0];
+        doNotOptimize(sum);
+    });
+    reportCopies(name + " find", n, ms);
+    settleHeap();
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de elementos como primer argumento (por defecto 100000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+
+    benchmarkDictionary<HashTable<int, Payload>>("HashTable", n);
+    benchmarkDictionary<AVLDictionary<int, Payload>>("AVLDictionary", n);
+    benchmarkDictionary<SortedArrayDictionary<int, Payload>>("SortedArrayDictionary", n < 20000 ? n : 20000);
+
+    {
+        ArrayList<Payload> list;
+        Payload::reset();
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++) {
+                Payload value(i);
+                list.append(value);
+            }
+        });
+        reportCopies("ArrayList append (copia)", n, ms);
+    }
+    settleHeap();
+    {
+        ArrayList<Payload> list;
+        Payload::reset();
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                list.emplaceBack(i);
+        });
+        reportCopies("ArrayList emplaceBack", n, ms);
+    }
+    settleHeap();
+    {
+        LinkedQueue<Payload> queue;
+        Payload::reset();
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                queue.emplace(i);
+            long long sum = 0;
+            while (!queue.isEmpty())
+                sum += queue.dequeue().data[0];
+            doNotOptimize(sum);
+        });
+        reportCopies("LinkedQueue emplace + dequeue", n, ms);
+    }
+    settleHeap();
+    {
+        HeapPriorityQueue<Payload> queue(n);
+        Payload::reset();
+        double ms = measure([&]() {
+            for (int i = 0; i < n; i++)
+                queue.emplace(i % 1000, i);
+            long long sum = 0;
+            while (!queue.isEmpty())
+                sum += queue.removeMin().data[0];
+            doNotOptimize(sum);
+        });
+        reportCopies("HeapPriorityQueue emplace + removeMin", n, ms);
+    }
+    return 0;
+}
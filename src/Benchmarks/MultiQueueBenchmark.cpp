@@ -0,0 +1,206 @@
+/**
+ * @file MultiQueueBenchmark.cpp
+ * @brief Mide el rendimiento y la calidad de MultiQueuePriorityQueue con varios hilos.
+ *
+ * Rendimiento: cada hilo alterna insert + removeMin sobre una cola precargada, y se
+ * compara con una HeapPriorityQueue protegida por un mutex. Calidad: varios hilos extraen
+ * una parte de una cola precargada con las prioridades 0..n-1 y, para cada extracción,
+ * se calcula su error de rango (cuántos elementos menores seguían en la cola en ese
+ * momento). Una cola estricta tiene error 0, salvo por el desorden entre el instante
+ * de la extracción y el del registro.
+ *
+ * Con más hilos que núcleos, un hilo puede perder el procesador mientras tiene el candado
+ * de un heap; ese heap no se vacía durante todo un turno del planificador y el error de la
+ * cola relajada crece mucho más que con un núcleo por hilo.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/MultiQueuePriorityQueue.h"
+
+const int PREFILL = 100000;       ///< Elementos en la cola durante la medición de rendimiento.
+const int QUALITY_SIZE = 1000000; ///< Elementos precargados para medir la calidad.
+const int QUALITY_REMOVALS = 100000; ///< Extracciones registradas para medir la calidad.
+
+/**
+ * @brief HeapPriorityQueue protegida por un mutex, como punto de comparación.
+ */
+class LockedPriorityQueue {
+private:
+    HeapPriorityQueue<int> queue; ///< Cola protegida.
+    std::mutex mutex;             ///< Mutex que protege la cola.
+
+public:
+    LockedPriorityQueue(int max) : queue(max) {}
+
+    void insert(int element, int priority) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.insert(element, priority);
+    }
+
+    bool tryRemoveMin(int& element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isEmpty())
+            return false;
+        element = queue.removeMin();
+        return true;
+    }
+};
+
+/**
+ * @brief Precarga la cola y ejecuta operations pares insert + tryRemoveMin repartidos entre los hilos.
+ *
+ * @return Tiempo total en milisegundos.
+ */
+template <typename Q>
+double throughput(Q& queue, int threads, int operations) {
+    std::mt19937 rng(38);
+    for (int i = 0; i < PREFILL; i++) {
+        int priority = (int)(rng() & 0xFFFFF);
+        queue.insert(priority, priority);
+    }
+    int perThread = operations / threads;
+    std::atomic<long long> sum(0);
+    double ms = measure([&]() {
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++)
+            workers.push_back(std::thread([&, t]() {
+                std::mt19937 local(t + 1);
+                long long partial = 0;
+                int element;
+                for (int i = 0; i < perThread; i++) {
+                    int priority = (int)(local() & 0xFFFFF);
+                    queue.insert(priority, priority);
+                    if (queue.tryRemoveMin(element))
+                        partial += element;
+                }
+                sum.fetch_add(partial);
+            }));
+        for (size_t t = 0; t < workers.size(); t++)
+            workers[t].join();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Árbol de Fenwick para contar cuántas prioridades menores ya se extrajeron.
+ */
+class Fenwick {
+private:
+    std::vector<int> tree; ///< Sumas parciales.
+
+public:
+    Fenwick(int n) : tree(n + 1, 0) {}
+
+    void add(int position) {
+        for (int i = position + 1; i < (int)tree.size(); i += i & -i)
+            tree[i]++;
+    }
+
+    int prefix(int position) {
+        int total = 0;
+        for (int i = position; i > 0; i -= i & -i)
+            total += tree[i];
+        return total;
+    }
+};
+
+/**
+ * @brief Extrae QUALITY_REMOVALS elementos con varios hilos y calcula el error de rango.
+ *
+ * Cada extracción se registra con un número de orden global tomado justo después de
+ * extraer. El error de rango de la prioridad p es la cantidad de prioridades menores
+ * que p que aún no se habían extraído: p menos las menores ya extraídas.
+ */
+void quality(MultiQueuePriorityQueue<int>& queue, int threads, const string& name) {
+    std::vector<int> priorities(QUALITY_SIZE);
+    for (int i = 0; i < QUALITY_SIZE; i++)
+        priorities[i] = i;
+    std::shuffle(priorities.begin(), priorities.end(), std::mt19937(7));
+    for (int i = 0; i < QUALITY_SIZE; i++)
+        queue.insert(priorities[i], priorities[i]);
+
+    std::vector<int> log(QUALITY_REMOVALS);
+    std::atomic<int> ticket(0);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; t++)
+        workers.push_back(std::thread([&]() {
+            int element;
+            while (ticket.load(std::memory_order_relaxed) < QUALITY_REMOVALS) {
+                if (!queue.tryRemoveMin(element))
+                    break;
+                int position = ticket.fetch_add(1);
+                if (position < QUALITY_REMOVALS)
+                    log[position] = element;
+            }
+        }));
+    for (size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+
+    Fenwick removed(QUALITY_SIZE);
+    long long totalError = 0;
+    int maxError = 0;
+    for (int i = 0; i < QUALITY_REMOVALS; i++) {
+        int error = log[i] - removed.prefix(log[i]);
+        totalError += error;
+        maxError = std::max(maxError, error);
+        removed.add(log[i]);
+    }
+    cout << std::left << std::setw(40) << name
+         << std::right << std::setw(12) << threads
+         << "    error de rango promedio " << std::fixed << std::setprecision(2)
+         << (double)totalError / QUALITY_REMOVALS << ", máximo " << maxError << endl;
+    queue.clear();
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad total de pares insert + removeMin por caso como
+ * primer argumento (por defecto 2e6).
+ */
+int main(int argc, char** argv) {
+    int operations = argc > 1 ? atoi(argv[1]) : 2000000;
+    int counts[] = { 1, 2, 4, 8, 16 };
+
+    cout << "Rendimiento (hilos, pares insert + removeMin)" << endl;
+    for (int threads : counts) {
+        settleHeap();
+        {
+            LockedPriorityQueue queue(PREFILL + operations + 1);
+            double ms = throughput(queue, threads, operations);
+            reportRate("HeapPriorityQueue + mutex", threads, ms, operations);
+        }
+        {
+            MultiQueuePriorityQueue<int> queue(threads);
+            double ms = throughput(queue, threads, operations);
+            reportRate("MultiQueuePriorityQueue relajada", threads, ms, operations);
+        }
+        {
+            MultiQueuePriorityQueue<int> queue(threads, true);
+            double ms = throughput(queue, threads, operations);
+            reportRate("MultiQueuePriorityQueue estricta", threads, ms, operations);
+        }
+        cout << endl;
+    }
+
+    cout << "Calidad (hilos)" << endl;
+    for (int threads : counts) {
+        MultiQueuePriorityQueue<int> relaxed(threads);
+        quality(relaxed, threads, "MultiQueuePriorityQueue relajada");
+        MultiQueuePriorityQueue<int> strict(threads, true);
+        quality(strict, threads, "MultiQueuePriorityQueue estricta");
+    }
+    return 0;
+}
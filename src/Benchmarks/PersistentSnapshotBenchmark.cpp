@@ -0,0 +1,149 @@
+/**
+ * @file PersistentSnapshotBenchmark.cpp
+ * @brief Compara el costo de tomar instantáneas y de modificar las estructuras persistentes.
+ *
+ * Una instantánea de ArrayList o AVLDictionary requiere copiar todos los elementos, mientras
+ * que la de PersistentList o PersistentAVLDictionary es copiar una referencia. A cambio,
+ * cada modificación de las persistentes copia un camino de O(log n) nodos.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/PersistentAVLDictionary.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Lists/PersistentList.h"
+
+const int SNAPSHOTS = 100; ///< Instantáneas tomadas por cada caso.
+const int UPDATES = 200000; ///< Modificaciones realizadas por cada caso.
+const int ARRAY_UPDATES = 2000; ///< Modificaciones de ArrayList, que desplazan O(n) elementos cada una.
+
+/**
+ * @brief Mide las listas de tamaño n.
+ */
+void runLists(int n, std::mt19937& rng) {
+    ArrayList<int> array(n);
+    PersistentList<int> persistent;
+    for (int i = 0; i < n; i++) {
+        array.append(i);
+        persistent = persistent.append(i);
+    }
+
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int s = 0; s < SNAPSHOTS; s++) {
+            ArrayList<int> copy(n);
+            for (array.goToStart(); !array.atEnd(); array.next())
+                copy.append(array.getElement());
+            sum += copy.getSize();
+        }
+    });
+    report("ArrayList snapshot (copy)", n, ms, SNAPSHOTS);
+    ms = measure([&]() {
+        for (int s = 0; s < SNAPSHOTS; s++) {
+            PersistentList<int> copy = persistent;
+            sum += copy.getSize();
+        }
+    });
+    report("PersistentList snapshot", n, ms, SNAPSHOTS);
+
+    std::vector<int> positions(UPDATES);
+    for (int i = 0; i < UPDATES; i++)
+        positions[i] = (int)(rng() % n);
+    ms = measure([&]() {
+        for (int i = 0; i < ARRAY_UPDATES; i++) {
+            array.goToPos(positions[i]);
+            array.remove();
+            array.insert(i);
+        }
+    });
+    report("ArrayList update (remove+insert)", n, ms, ARRAY_UPDATES);
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            persistent = persistent.set(positions[i], i);
+    });
+    report("PersistentList set", n, ms, UPDATES);
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            sum += persistent.get(positions[i]);
+    });
+    report("PersistentList get", n, ms, UPDATES);
+    doNotOptimize(sum);
+}
+
+/**
+ * @brief Mide los diccionarios de tamaño n.
+ */
+void runDictionaries(int n, std::mt19937& rng) {
+    AVLDictionary<int, int> mutableDict;
+    PersistentAVLDictionary<int, int> persistent;
+    std::vector<int> keys(n);
+    for (int i = 0; i < n; i++) {
+        keys[i] = i * 2;
+        mutableDict.insert(keys[i], i);
+        persistent = persistent.insert(keys[i], i);
+    }
+
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int s = 0; s < SNAPSHOTS; s++) {
+            List<int>* snapshotKeys = mutableDict.getKeys();
+            List<int>* snapshotValues = mutableDict.getValues();
+            sum += snapshotKeys->getSize() + snapshotValues->getSize();
+            delete snapshotKeys;
+            delete snapshotValues;
+        }
+    });
+    report("AVLDictionary snapshot (getKeys/Values)", n, ms, SNAPSHOTS);
+    ms = measure([&]() {
+        for (int s = 0; s < SNAPSHOTS; s++) {
+            PersistentAVLDictionary<int, int> copy = persistent;
+            sum += copy.getSize();
+        }
+    });
+    report("PersistentAVLDictionary snapshot", n, ms, SNAPSHOTS);
+
+    std::vector<int> probes(UPDATES);
+    for (int i = 0; i < UPDATES; i++)
+        probes[i] = keys[rng() % n];
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            mutableDict.setValue(probes[i], i);
+    });
+    report("AVLDictionary setValue", n, ms, UPDATES);
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            persistent = persistent.setValue(probes[i], i);
+    });
+    report("PersistentAVLDictionary setValue", n, ms, UPDATES);
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            sum += mutableDict.getValue(probes[i]);
+    });
+    report("AVLDictionary getValue", n, ms, UPDATES);
+    ms = measure([&]() {
+        for (int i = 0; i < UPDATES; i++)
+            sum += persistent.getValue(probes[i]);
+    });
+    report("PersistentAVLDictionary getValue", n, ms, UPDATES);
+    doNotOptimize(sum);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ */
+int main() {
+    int sizes[] = { 1000, 10000, 100000 };
+    std::mt19937 rng(11);
+
+    cout << "Listas: instantáneas y modificaciones" << endl;
+    for (int n : sizes)
+        runLists(n, rng);
+    cout << endl << "Diccionarios: instantáneas y modificaciones" << endl;
+    for (int n : sizes)
+        runDictionaries(n, rng);
+    return 0;
+}
@@ -0,0 +1,175 @@
+/**
+ * @file SPSCQueueBenchmark.cpp
+ * @brief Compara SPSCQueue con una LinkedQueue protegida por un mutex.
+ *
+ * Mide el rendimiento (mensajes por segundo) con un productor y un consumidor,
+ * elemento por elemento y en lotes, y la latencia de ida y vuelta entre dos hilos
+ * que se pasan un mensaje por dos colas.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include "Benchmark.h"
+#include "Structures/Common/Concurrency.h"
+#include "Structures/Implementations/Queues/LinkedQueue.h"
+#include "Structures/Implementations/Queues/SPSCQueue.h"
+
+const int BATCH = 64; ///< Tamaño de los lotes de enqueueN/dequeueN.
+
+/**
+ * @brief LinkedQueue protegida por un mutex, como la usan hoy las etapas del pipeline.
+ */
+class LockedQueue {
+private:
+    LinkedQueue<long> queue; ///< Cola protegida.
+    std::mutex mutex;        ///< Mutex que protege la cola.
+
+public:
+    bool tryEnqueue(long element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.enqueue(element);
+        return true;
+    }
+
+    bool tryDequeue(long& element) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queue.isEmpty())
+            return false;
+        element = queue.dequeue();
+        return true;
+    }
+};
+
+/**
+ * @brief Mide el paso de n mensajes de un productor a un consumidor, uno por uno.
+ */
+template <typename Q>
+double throughput(Q& queue, long n) {
+    long sum = 0;
+    double ms = measure([&]() {
+        std::thread producer([&]() {
+            for (long i = 0; i < n; i++)
+                for (int attempt = 0; !queue.tryEnqueue(i); attempt++)
+                    spinWait(attempt);
+        });
+        long element;
+        for (long i = 0; i < n; i++) {
+            for (int attempt = 0; !queue.tryDequeue(element); attempt++)
+                spinWait(attempt);
+            sum += element;
+        }
+        producer.join();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Mide el paso de n mensajes con enqueueN/dequeueN en lotes de BATCH.
+ */
+double batchThroughput(SPSCQueue<long>& queue, long n) {
+    long sum = 0;
+    double ms = measure([&]() {
+        std::thread producer([&]() {
+            long items[BATCH];
+            for (long sent = 0; sent < n;) {
+                int count = (int)(n - sent < BATCH ? n - sent : BATCH);
+                for (int i = 0; i < count; i++)
+                    items[i] = sent + i;
+                int done = 0;
+                for (int attempt = 0; done < count; attempt++) {
+                    int pushed = queue.enqueueN(items + done, count - done);
+                    done += pushed;
+                    if (pushed == 0)
+                        spinWait(attempt);
+                }
+                sent += count;
+            }
+        });
+        long items[BATCH];
+        int attempt = 0;
+        for (long received = 0; received < n;) {
+            int count = queue.dequeueN(items, BATCH);
+            if (count == 0) {
+                spinWait(attempt++);
+                continue;
+            }
+            attempt = 0;
+            for (int i = 0; i < count; i++)
+                sum += items[i];
+            received += count;
+        }
+        producer.join();
+    });
+    doNotOptimize(sum);
+    return ms;
+}
+
+/**
+ * @brief Mide rounds idas y vueltas de un mensaje entre dos hilos.
+ */
+template <typename Q>
+double pingPong(Q& ping, Q& pong, long rounds) {
+    return measure([&]() {
+        std::thread echo([&]() {
+            long element;
+            for (long i = 0; i < rounds; i++) {
+                for (int attempt = 0; !ping.tryDequeue(element); attempt++)
+                    spinWait(attempt);
+                for (int attempt = 0; !pong.tryEnqueue(element); attempt++)
+                    spinWait(attempt);
+            }
+        });
+        long element;
+        for (long i = 0; i < rounds; i++) {
+            for (int attempt = 0; !ping.tryEnqueue(i); attempt++)
+                spinWait(attempt);
+            for (int attempt = 0; !pong.tryDequeue(element); attempt++)
+                spinWait(attempt);
+        }
+        echo.join();
+    });
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de mensajes como primer argumento.
+ */
+int main(int argc, char** argv) {
+    long n = argc > 1 ? atol(argv[1]) : 4000000;
+    long rounds = n / 40 > 0 ? n / 40 : 1;
+
+    cout << "Rendimiento con un productor y un consumidor" << endl;
+    {
+        LockedQueue locked;
+        double ms = throughput(locked, n);
+        reportRate("LinkedQueue + mutex", n, ms, n);
+    }
+    {
+        SPSCQueue<long> queue(4096);
+        double ms = throughput(queue, n);
+        reportRate("SPSCQueue", n, ms, n);
+    }
+    {
+        SPSCQueue<long> queue(4096);
+        double ms = batchThroughput(queue, n);
+        reportRate("SPSCQueue enqueueN/dequeueN", n, ms, n);
+    }
+
+    cout << endl << "Latencia de ida y vuelta" << endl;
+    {
+        LockedQueue ping, pong;
+        double ms = pingPong(ping, pong, rounds);
+        report("LinkedQueue + mutex", rounds, ms, rounds);
+    }
+    {
+        SPSCQueue<long> ping(64), pong(64);
+        double ms = pingPong(ping, pong, rounds);
+        report("SPSCQueue", rounds, ms, rounds);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file SnapshotBenchmark.cpp
+ * @brief Compara el arranque en frío de un diccionario desde texto, desde una instantánea binaria y con mmap.
+ *
+ * Se guarda un diccionario de n pares en un archivo de texto ("clave valor" por línea) y
+ * en una instantánea binaria con save(). Para cada forma de arranque se mide el tiempo
+ * hasta poder responder la primera búsqueda y el costo de las búsquedas siguientes:
+ *
+ * - texto: leer y convertir cada línea e insertarla en el diccionario.
+ * - binario: load(), que proyecta el archivo y construye el diccionario sin parsear.
+ * - mmap: abrir un MappedDictionary, que consulta el archivo en su lugar.
+ *
+ * Antes de cada caso se pide al sistema que descarte el archivo de su caché de páginas
+ * (posix_fadvise), para aproximar un arranque en frío sin privilegios de administrador.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/MappedDictionary.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+
+const char* const TEXT_PATH = "snapshot-benchmark.txt";     ///< Archivo de texto de prueba.
+const char* const BINARY_PATH = "snapshot-benchmark.snp";   ///< Instantánea de prueba.
+const int LOOKUPS = 1000000;                                ///< Búsquedas medidas después del arranque.
+
+/**
+ * @brief Pide al sistema que descarte un archivo de la caché de páginas.
+ */
+void evict(const char* path) {
+    int descriptor = open(path, O_RDONLY);
+    if (descriptor < 0)
+        return;
+    fdatasync(descriptor);
+    posix_fadvise(descriptor, 0, 0, POSIX_FADV_DONTNEED);
+    close(descriptor);
+}
+
+/**
+ * @brief Mide las búsquedas sobre un diccionario ya listo.
+ */
+template <typename D>
+void benchmarkLookups(const string& name, D& dictionary, int n, const std::vector<int>& probes) {
+    double ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            sum += dictionary.getValue(probes[i]);
+        doNotOptimize(sum);
+    });
+    report(name + " búsquedas", n, ms, LOOKUPS);
+}
+
+/**
+ * @brief Mide el arranque desde texto y desde la instantánea binaria de un diccionario.
+ */
+template <typename D>
+void benchmarkDictionary(const string& name, int n, const std::vector<int>& probes) {
+    settleHeap();
+    evict(TEXT_PATH);
+    {
+        D dictionary;
+        double ms = measure([&]() {
+            FILE* file = fopen(TEXT_PATH, "r");
+            int key, value;
+            while (fscanf(file, "%d %d", &key, &value) == 2)
+                dictionary.insert(key, value);
+            fclose(file);
+        });
+        report(name + " texto", n, ms);
+        benchmarkLookups(name + " texto", dictionary, n, probes);
+    }
+    settleHeap();
+    evict(BINARY_PATH);
+    {
+        D dictionary;
+        double ms = measure([&]() { dictionary.load(BINARY_PATH); });
+        report(name + " binario", n, ms);
+        benchmarkLookups(name + " binario", dictionary, n, probes);
+    }
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de pares como primer argumento (por defecto 1000000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    std::mt19937 rng(42);
+    std::vector<int> probes(LOOKUPS);
+    for (int i = 0; i < LOOKUPS; i++)
+        probes[i] = (int)(rng() % n) * 2;
+
+    {
+        SortedArrayDictionary<int, int> source;
+        for (int i = 0; i < n; i++)
+            source.insert(i * 2, i);
+        double ms = measure([&]() {
+            FILE* file = fopen(TEXT_PATH, "w");
+            source.forEach([file](const int& key, int& value) { fprintf(file, "%d %d\n", key, value); });
+            fclose(file);
+        });
+        report("Escribir texto", n, ms);
+        ms = measure([&]() { source.save(BINARY_PATH); });
+        report("Escribir binario (save)", n, ms);
+    }
+
+    benchmarkDictionary<HashTable<int, int>>("HashTable", n, probes);
+    benchmarkDictionary<AVLDictionary<int, int>>("AVLDictionary", n, probes);
+    benchmarkDictionary<SortedArrayDictionary<int, int>>("SortedArrayDictionary", n, probes);
+
+    settleHeap();
+    evict(BINARY_PATH);
+    {
+        long long first = 0;
+        double ms = measure([&]() {
+            MappedDictionary<int, int> dictionary(BINARY_PATH);
+            first = dictionary.getValue(probes[0]);
+        });
+        doNotOptimize(first);
+        report("MappedDictionary mmap (1 búsqueda)", n, ms);
+    }
+    evict(BINARY_PATH);
+    {
+        MappedDictionary<int, int> dictionary(BINARY_PATH);
+        benchmarkLookups("MappedDictionary mmap", dictionary, n, probes);
+    }
+
+    remove(TEXT_PATH);
+    remove(BINARY_PATH);
+    return 0;
+}
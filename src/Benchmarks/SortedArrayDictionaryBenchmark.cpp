@@ -0,0 +1,71 @@
+/**
+ * @file SortedArrayDictionaryBenchmark.cpp
+ * @brief Compara el tiempo de búsqueda de los diccionarios para distintos tamaños.
+ *
+ * Para cada tamaño se construye cada diccionario con claves aleatorias y se mide
+ * una cantidad fija de consultas getValue() sobre claves existentes.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Dictionaries/UnsortedArrayDictionary.h"
+
+const int LOOKUPS = 1000000; ///< Consultas realizadas por cada caso.
+
+/**
+ * @brief Llena un diccionario y mide las consultas sobre él.
+ *
+ * @param name Nombre del caso.
+ * @param dict Diccionario a medir.
+ * @param keys Claves a insertar.
+ * @param probes Claves a consultar.
+ */
+void run(const string& name, Dictionary<int, int>* dict, const std::vector<int>& keys, const std::vector<int>& probes) {
+    for (size_t i = 0; i < keys.size(); i++)
+        dict->insert(keys[i], (int)i);
+    long long sum = 0;
+    double ms = measure([&]() {
+        for (int probe : probes)
+            sum += dict->getValue(probe);
+    });
+    doNotOptimize(sum);
+    report(name, (long long)keys.size(), ms, (long long)probes.size());
+    delete dict;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ */
+int main() {
+    int sizes[] = { 8, 16, 64, 256, 1024, 4096 };
+    std::mt19937 rng(7);
+
+    cout << "Búsquedas exitosas (getValue) según el tamaño del diccionario" << endl;
+    for (int n : sizes) {
+        std::vector<int> keys;
+        SortedArrayDictionary<int, int> unique;
+        while ((int)keys.size() < n) {
+            int key = (int)(rng() % 1000000);
+            if (!unique.contains(key)) {
+                unique.insert(key, 0);
+                keys.push_back(key);
+            }
+        }
+        std::vector<int> probes(LOOKUPS);
+        for (int i = 0; i < LOOKUPS; i++)
+            probes[i] = keys[rng() % n];
+
+        run("SortedArrayDictionary", new SortedArrayDictionary<int, int>(), keys, probes);
+        run("HashTable", new HashTable<int, int>(), keys, probes);
+        run("AVLDictionary", new AVLDictionary<int, int>(), keys, probes);
+        if (n <= 1024)
+            run("UnsortedArrayDictionary", new UnsortedArrayDictionary<int, int>(), keys, probes);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file SortedListBenchmark.cpp
+ * @brief Compara las estrategias para construir una lista ordenada.
+ *
+ * Mide el recorrido lineal con cursor (estrategia anterior), la inserción con
+ * búsqueda binaria de SortedArrayList y OrderedArrayList, y la mezcla en lote
+ * con insertSorted().
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Lists/ArrayList.h"
+#include "Structures/Implementations/Lists/OrderedArrayList.h"
+#include "Structures/Implementations/Lists/SortedArrayList.h"
+
+/**
+ * @brief Inserta un elemento recorriendo la lista con el cursor, como se hacía antes.
+ *
+ * @param list Lista en la que se inserta.
+ * @param element Elemento a insertar.
+ */
+void linearInsert(List<int>* list, int element) {
+    list->goToStart();
+    while (!list->atEnd() && element >= list->getElement())
+        list->next();
+    list->insert(element);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * @param argc Cantidad de argumentos.
+ * @param argv Tamaño máximo opcional para la inserción elemento por elemento.
+ */
+int main(int argc, char** argv) {
+    int maxSingle = argc > 1 ? atoi(argv[1]) : 100000;
+    int sizes[] = { 10000, 100000, 1000000 };
+    std::mt19937 rng(42);
+
+    cout << "Construcción de una lista ordenada con claves aleatorias" << endl;
+    for (int n : sizes) {
+        std::vector<int> keys(n);
+        for (int i = 0; i < n; i++)
+            keys[i] = (int)rng();
+
+        if (n <= maxSingle / 2) {
+            report("Recorrido lineal (anterior)", n, measure([&]() {
+                ArrayList<int> list(n);
+                for (int key : keys)
+                    linearInsert(&list, key);
+                doNotOptimize(list.getSize());
+            }));
+        }
+        if (n <= maxSingle) {
+            report("SortedArrayList::insert", n, measure([&]() {
+                SortedArrayList<int> list(n);
+                for (int key : keys)
+                    list.insert(key);
+                doNotOptimize(list.getSize());
+            }));
+            report("OrderedArrayList::insert", n, measure([&]() {
+                OrderedArrayList<int> list(n);
+                for (int key : keys)
+                    list.insert(key);
+                doNotOptimize(list.getSize());
+            }));
+        }
+        report("SortedArrayList::insertSorted", n, measure([&]() {
+            std::vector<int> batch(keys);
+            std::sort(batch.begin(), batch.end());
+            SortedArrayList<int> list;
+            list.insertSorted(batch.data(), n);
+            doNotOptimize(list.getSize());
+        }));
+        report("OrderedArrayList::insertSorted", n, measure([&]() {
+            std::vector<int> batch(keys);
+            std::sort(batch.begin(), batch.end());
+            OrderedArrayList<int> list;
+            list.insertSorted(batch.data(), n);
+            doNotOptimize(list.getSize());
+        }));
+
+        SortedArrayList<int> list;
+        std::vector<int> batch(keys);
+        std::sort(batch.begin(), batch.end());
+        list.insertSorted(batch.data(), n);
+        long long found = 0;
+        report("SortedArrayList::contains", n, measure([&]() {
+            for (int key : keys)
+                found += list.contains(key);
+            doNotOptimize(found);
+        }));
+    }
+    return 0;
+}
@@ -0,0 +1,78 @@
+/**
+ * @file ThreeWayCompareBenchmark.cpp
+ * @brief Mide las búsquedas e inserciones de un AVLDictionary con claves string.
+ *
+ * Las claves comparten un prefijo largo ("session:" y diez dígitos), de modo que cada
+ * comparación recorre varios caracteres antes de decidir. El árbol hace una sola
+ * comparación de tres vías por nodo visitado (ver Compare.h); antes comparaba con == y
+ * luego con <, es decir, dos o tres comparaciones de string por nivel.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+
+const int LOOKUPS = 1000000; ///< Búsquedas medidas por tamaño.
+
+/**
+ * @brief Llena un AVLDictionary con n claves en orden aleatorio y mide sus operaciones.
+ */
+void run(int n) {
+    std::vector<string> keys(n);
+    char buffer[64];
+    for (int i = 0; i < n; i++) {
+        snprintf(buffer, sizeof(buffer), "session:%010d:user", i * 7919);
+        keys[i] = buffer;
+    }
+    std::mt19937 rng(42);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+    std::vector<int> probes(LOOKUPS);
+    for (int i = 0; i < LOOKUPS; i++)
+        probes[i] = (int)(rng() % n);
+
+    AVLDictionary<string, int> dictionary;
+    double ms = measure([&]() {
+        for (int i = 0; i < n; i++)
+            dictionary.insert(keys[order[i]], order[i]);
+    });
+    report("AVLDictionary<string> insert", n, ms, n);
+
+    ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            sum += dictionary.getValue(keys[probes[i]]);
+        doNotOptimize(sum);
+    });
+    report("AVLDictionary<string> getValue", n, ms, LOOKUPS);
+
+    ms = measure([&]() {
+        long long hits = 0;
+        for (int i = 0; i < LOOKUPS; i++)
+            hits += dictionary.contains(keys[probes[i]]);
+        doNotOptimize(hits);
+    });
+    report("AVLDictionary<string> contains", n, ms, LOOKUPS);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Mide un diccionario que cabe en la caché (5000 claves), donde pesa el costo de las
+ * comparaciones, y uno más grande cuyo tamaño se recibe opcionalmente como primer
+ * argumento (por defecto 100000), donde pesan los fallos de caché.
+ */
+int main(int argc, char** argv) {
+    run(5000);
+    settleHeap();
+    run(argc > 1 ? atoi(argv[1]) : 100000);
+    return 0;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file TimingWheelBenchmark.cpp
+ * @brief Compara TimingWheel con colas de prioridad para manejar temporizadores.
+ *
+ * Se programan n temporizadores con vencimientos aleatorios, se cancela el 90 % y luego
+ * se avanza el reloj tick por tick, como en un ciclo de eventos, hasta vencer el resto.
+ * HeapPriorityQueue no permite cancelar, así que los temporizadores cancelados se marcan
+ * y se descartan al salir de la cola; IndexedHeapPriorityQueue los elimina con erase().
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Queues/HeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/IndexedHeapPriorityQueue.h"
+#include "Structures/Implementations/Queues/TimingWheel.h"
+
+const int SPAN = 1 << 20;        ///< Vencimiento máximo, en ticks.
+const int CANCEL_PERCENT = 90;   ///< Porcentaje de temporizadores cancelados.
+
+/**
+ * @brief Datos comunes a todos los casos.
+ */
+struct Workload {
+    std::vector<int> delays;     ///< Ticks hasta el vencimiento de cada temporizador.
+    std::vector<int> cancelled;  ///< Temporizadores a cancelar, en el orden en que se cancelan.
+};
+
+/**
+ * @brief Imprime el tiempo de cada fase y el total.
+ */
+void reportPhases(const string& name, int n, double scheduleMs, double cancelMs, double expireMs) {
+    report(name + " programar", n, scheduleMs, n);
+    report(name + " cancelar", n, cancelMs, (long long)n * CANCEL_PERCENT / 100);
+    report(name + " avanzar", n, expireMs, SPAN);
+    report(name + " total", n, scheduleMs + cancelMs + expireMs, n);
+}
+
+/**
+ * @brief Mide TimingWheel.
+ *
+ * @return Cantidad de temporizadores vencidos.
+ */
+long long runWheel(const Workload& work) {
+    int n = (int)work.delays.size();
+    TimingWheel<int> wheel;
+    std::vector<TimingWheel<int>::Handle> handles(n);
+    long long expired = 0;
+
+    double scheduleMs = measure([&]() {
+        for (int i = 0; i < n; i++)
+            handles[i] = wheel.schedule(i, work.delays[i]);
+    });
+    double cancelMs = measure([&]() {
+        for (size_t i = 0; i < work.cancelled.size(); i++)
+            wheel.cancel(handles[work.cancelled[i]]);
+    });
+    double expireMs = measure([&]() {
+        for (int tick = 0; tick < SPAN; tick++)
+            expired += wheel.advance(1, [](int id) { doNotOptimize(id); });
+    });
+    reportPhases("TimingWheel", n, scheduleMs, cancelMs, expireMs);
+    return expired;
+}
+
+/**
+ * @brief Mide HeapPriorityQueue con cancelación perezosa.
+ *
+ * @return Cantidad de temporizadores vencidos.
+ */
+long long runLazyHeap(const Workload& work) {
+    int n = (int)work.delays.size();
+    HeapPriorityQueue<int> queue(n + 1);
+    std::vector<bool> dead(n, false);
+    long long expired = 0;
+
+    double scheduleMs = measure([&]() {
+        for (int i = 0; i < n; i++)
+            queue.insert(i, work.delays[i]);
+    });
+    double cancelMs = measure([&]() {
+        for (size_t i = 0; i < work.cancelled.size(); i++)
+            dead[work.cancelled[i]] = true;
+    });
+    double expireMs = measure([&]() {
+        for (int tick = 1; tick <= SPAN; tick++) {
+            while (!queue.isEmpty() && work.delays[queue.min()] <= tick) {
+                int id = queue.removeMin();
+                if (!dead[id])
+                    expired++;
+            }
+        }
+    });
+    reportPhases("HeapPriorityQueue", n, scheduleMs, cancelMs, expireMs);
+    return expired;
+}
+
+/**
+ * @brief Mide IndexedHeapPriorityQueue con cancelación por handle.
+ *
+ * @return Cantidad de temporizadores vencidos.
+ */
+long long runIndexedHeap(const Workload& work) {
+    int n = (int)work.delays.size();
+    IndexedHeapPriorityQueue<int> queue(n);
+    std::vector<int> handles(n);
+    long long expired = 0;
+
+    double scheduleMs = measure([&]() {
+        for (int i = 0; i < n; i++)
+            handles[i] = queue.push(i, work.delays[i]);
+    });
+    double cancelMs = measure([&]() {
+        for (size_t i = 0; i < work.cancelled.size(); i++)
+            queue.erase(handles[work.cancelled[i]]);
+    });
+    double expireMs = measure([&]() {
+        for (int tick = 1; tick <= SPAN; tick++) {
+            while (!queue.isEmpty() && queue.minPriority() <= tick) {
+                queue.removeMin();
+                expired++;
+            }
+        }
+    });
+    reportPhases("IndexedHeapPriorityQueue", n, scheduleMs, cancelMs, expireMs);
+    return expired;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de temporizadores como primer argumento (por defecto 1e6).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 1000000;
+    std::mt19937 rng(39);
+    Workload work;
+    work.delays.resize(n);
+    for (int i = 0; i < n; i++)
+        work.delays[i] = 1 + (int)(rng() % SPAN);
+    std::vector<int> order(n);
+    for (int i = 0; i < n; i++)
+        order[i] = i;
+    std::shuffle(order.begin(), order.end(), rng);
+    work.cancelled.assign(order.begin(), order.begin() + (long long)n * CANCEL_PERCENT / 100);
+
+    cout << n << " temporizadores, " << CANCEL_PERCENT << " % cancelados, " << SPAN << " ticks" << endl;
+    long long expected = runWheel(work);
+    cout << endl;
+    settleHeap();
+    if (runLazyHeap(work) != expected)
+        cout << "Error: cantidad de vencidos distinta" << endl;
+    cout << endl;
+    settleHeap();
+    if (runIndexedHeap(work) != expected)
+        cout << "Error: cantidad de vencidos distinta" << endl;
+    return 0;
+}
@@ -0,0 +1,153 @@
+/**
+ * @file TopKBenchmark.cpp
+ * @brief Compara formas de obtener los k mayores de una secuencia larga con MinHeap.
+ *
+ * Los elementos se generan sobre la marcha con xorshift, así que la secuencia no ocupa
+ * memoria. Se compara insertar cada elemento y luego quitar el mínimo, comparar con el
+ * mínimo antes de hacer removeFirst + insert, y topK() con pushPop(). También se mide
+ * insertBatch() contra inserciones sucesivas.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Common/TopK.h"
+#include "Structures/Implementations/Queues/MinHeap.h"
+
+const int K = 1000; ///< Cantidad de elementos a seleccionar.
+
+/**
+ * @brief Secuencia de n enteros pseudoaleatorios que se genera al recorrerla.
+ */
+class RandomStream {
+private:
+    long long n; ///< Cantidad de elementos.
+
+public:
+    /**
+     * @brief Iterador que genera el siguiente valor al avanzar.
+     */
+    class Iterator {
+    private:
+        uint64_t state;   ///< Estado del generador xorshift.
+        long long index;  ///< Posición actual.
+
+    public:
+        Iterator(long long index) : state(88172645463325252ULL), index(index) {}
+
+        int operator*() const {
+            return (int)(state >> 33);
+        }
+
+        Iterator& operator++() {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            index++;
+            return *this;
+        }
+
+        bool operator!=(const Iterator& other) const {
+            return index != other.index;
+        }
+    };
+
+    RandomStream(long long n) : n(n) {}
+
+    Iterator begin() const {
+        return Iterator(0);
+    }
+
+    Iterator end() const {
+        return Iterator(n);
+    }
+};
+
+/**
+ * @brief Suma los elementos seleccionados, para comparar los resultados.
+ */
+long long sumHeap(MinHeap<int>& heap) {
+    long long sum = 0;
+    while (!heap.isEmpty())
+        sum += heap.removeFirst();
+    return sum;
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de elementos como primer argumento (por defecto 1e8).
+ */
+int main(int argc, char** argv) {
+    long long n = argc > 1 ? atoll(argv[1]) : 100000000;
+    RandomStream stream(n);
+    long long expected = 0;
+    long long sum = 0;
+    cout << "Los " << K << " mayores de " << n << " elementos" << endl;
+
+    double ms = measure([&]() {
+        MinHeap<int> heap(K + 1);
+        for (int value : stream) {
+            heap.insert(value);
+            if (heap.getSize() > K)
+                heap.removeFirst();
+        }
+        expected = sumHeap(heap);
+    });
+    report("insert + removeFirst", n, ms, n);
+
+    ms = measure([&]() {
+        MinHeap<int> heap(K);
+        for (int value : stream) {
+            if (heap.getSize() < K) {
+                heap.insert(value);
+            } else if (heap.first() < value) {
+                heap.removeFirst();
+                heap.insert(value);
+            }
+        }
+        sum = sumHeap(heap);
+    });
+    report("comparar + removeFirst + insert", n, ms, n);
+    if (sum != expected)
+        cout << "Error: resultados distintos" << endl;
+
+    ms = measure([&]() {
+        std::vector<int> out(K);
+        int count = topK<int>(stream, K, out.data());
+        sum = 0;
+        for (int i = 0; i < count; i++)
+            sum += out[i];
+    });
+    report("topK (pushPop)", n, ms, n);
+    if (sum != expected)
+        cout << "Error: resultados distintos" << endl;
+    cout << endl;
+
+    int batch = n < 10000000 ? (int)n : 10000000;
+    std::vector<int> values;
+    values.reserve(batch);
+    for (int value : RandomStream(batch))
+        values.push_back(value);
+    settleHeap();
+    {
+        MinHeap<int> heap(batch);
+        ms = measure([&]() {
+            for (int i = 0; i < batch; i++)
+                heap.insert(values[i]);
+        });
+        report("insert uno por uno", batch, ms, batch);
+    }
+    {
+        MinHeap<int> heap(batch);
+        ms = measure([&]() { heap.insertBatch(values.data(), batch); });
+        report("insertBatch", batch, ms, batch);
+        std::vector<int> out(K);
+        ms = measure([&]() { heap.popN(K, out.data()); });
+        report("popN", K, ms, K);
+    }
+    return 0;
+}
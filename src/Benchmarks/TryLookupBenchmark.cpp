@@ -0,0 +1,85 @@
+/**
+ * @file TryLookupBenchmark.cpp
+ * @brief Compara búsquedas con excepciones y sin ellas en una carga con 50% de fallos.
+ *
+ * Cada diccionario guarda n claves pares y recibe búsquedas de claves al azar, la mitad
+ * pares (aciertos) y la mitad impares (fallos). Se mide la misma carga de dos formas:
+ *
+ * - getValue + catch: la forma disponible antes de tryGet; cada fallo lanza y captura
+ *   un runtime_error.
+ * - tryGet: informa el fallo con su valor de retorno, sin excepciones.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "Benchmark.h"
+#include "Structures/Implementations/Dictionaries/AVLDictionary.h"
+#include "Structures/Implementations/Dictionaries/HashTable.h"
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+#include "Structures/Implementations/Dictionaries/SplayDictionary.h"
+
+const int LOOKUPS = 1000000; ///< Búsquedas por caso.
+
+/**
+ * @brief Llena un diccionario y mide la carga de búsquedas de las dos formas.
+ */
+template <typename D>
+void run(const string& name, int n, const std::vector<int>& probes) {
+    D dictionary;
+    for (int i = 0; i < n; i++)
+        dictionary.insert(i * 2, i);
+
+    long long misses = 0;
+    double ms = measure([&]() {
+        long long sum = 0;
+        for (int i = 0; i < LOOKUPS; i++) {
+            try {
+                sum += dictionary.getValue(probes[i]);
+            } catch (runtime_error&) {
+                misses++;
+            }
+        }
+        doNotOptimize(sum);
+    });
+    report(name + " getValue + catch", n, ms, LOOKUPS);
+
+    ms = measure([&]() {
+        long long sum = 0;
+        int value;
+        for (int i = 0; i < LOOKUPS; i++) {
+            if (dictionary.tryGet(probes[i], value))
+                sum += value;
+            else
+                misses++;
+        }
+        doNotOptimize(sum);
+    });
+    report(name + " tryGet", n, ms, LOOKUPS);
+    doNotOptimize(misses);
+}
+
+/**
+ * @brief Función principal del benchmark.
+ *
+ * Recibe opcionalmente la cantidad de claves como primer argumento (por defecto 100000).
+ */
+int main(int argc, char** argv) {
+    int n = argc > 1 ? atoi(argv[1]) : 100000;
+    std::mt19937 rng(42);
+    std::vector<int> probes(LOOKUPS);
+    for (int i = 0; i < LOOKUPS; i++)
+        probes[i] = (int)(rng() % (2 * n));
+
+    run<HashTable<int, int>>("HashTable", n, probes);
+    settleHeap();
+    run<AVLDictionary<int, int>>("AVLDictionary", n, probes);
+    settleHeap();
+    run<SplayDictionary<int, int>>("SplayDictionary", n, probes);
+    settleHeap();
+    run<SortedArrayDictionary<int, int>>("SortedArrayDictionary", n, probes);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file SnapshotTest.cpp
+ * @brief Pruebas de save() y load() de las instantáneas binarias y de la liberación de pares.
+ *
+ * Cuenta las reservas vivas de ::operator new para comprobar que load() libera los
+ * elementos que quedan fuera del contenido cargado.
+ *
+ * @author Mauricio González Prendas
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include "Structures/Implementations/Dictionaries/SortedArrayDictionary.h"
+
+using std::string;
+
+static long liveAllocations = 0; ///< Reservas de ::operator new aún no liberadas.
+
+void* operator new(std::size_t bytes) {
+    void* pointer = std::malloc(bytes > 0 ? bytes : 1);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    liveAllocations++;
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept {
+    if (pointer == nullptr)
+        return;
+    liveAllocations--;
+    std::free(pointer);
+}
+
+const char* const LARGE_PATH = "snapshot-test-large.snp"; ///< Instantánea de 100 pares.
+const char* const SMALL_PATH = "snapshot-test-small.snp"; ///< Instantánea de 10 pares.
+
+static int failures = 0; ///< Comprobaciones fallidas.
+
+/**
+ * @brief Registra una comprobación e informa si falla.
+ */
+void check(bool condition, const string& description) {
+    if (!condition) {
+        std::cerr << "FALLO: " << description << std::endl;
+        failures++;
+    }
+}
+
+/**
+ * @brief Clave de prueba, lo bastante larga para ocupar memoria del montículo.
+ */
+string testKey(int i) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "clave de prueba número %04d", i);
+    return buffer;
+}
+
+/**
+ * @brief Valor de prueba, lo bastante largo para ocupar memoria del montículo.
+ */
+string testValue(int i) {
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "valor de prueba número %04d", i);
+    return buffer;
+}
+
+/**
+ * @brief Guarda un diccionario con los pares 0..count-1.
+ */
+void saveDictionary(const char* path, int count) {
+    SortedArrayDictionary<string, string> dictionary;
+    for (int i = 0; i < count; i++)
+        dictionary.insert(testKey(i), testValue(i));
+    dictionary.save(path);
+}
+
+/**
+ * @brief Cargar una instantánea menor sobre un diccionario mayor con claves string
+ * deja sólo los pares cargados y libera los que quedan después de ellos.
+ */
+void testLoadSmallerOverLarger() {
+    long before = liveAllocations;
+    long expected;
+    {
+        SortedArrayDictionary<string, string> fresh;
+        fresh.load(SMALL_PATH);
+        expected = liveAllocations - before;
+    }
+
+    before = liveAllocations;
+    SortedArrayDictionary<string, string> dictionary;
+    dictionary.load(LARGE_PATH);
+    check(dictionary.getSize() == 100, "el diccionario mayor tiene 100 pares");
+    dictionary.load(SMALL_PATH);
+    check(dictionary.getSize() == 10, "la instantánea menor deja 10 pares");
+    for (int i = 0; i < 10; i++)
+        check(dictionary.contains(testKey(i)) && dictionary.getValue(testKey(i)) == testValue(i),
+              "el par " + testKey(i) + " se cargó");
+    for (int i = 10; i < 100; i++)
+        check(!dictionary.contains(testKey(i)), "el par " + testKey(i) + " ya no está");
+    long held = liveAllocations - before;
+    check(held == expected, "las claves y valores fuera de los 10 pares cargados se liberaron");
+}
+
+/**
+ * @brief clear() y remove() liberan las claves y valores string que dejan de usarse.
+ */
+void testClearAndRemoveRelease() {
+    SortedArrayDictionary<string, string> dictionary;
+    dictionary.load(LARGE_PATH);
+    long loaded = liveAllocations;
+    dictionary.remove(testKey(50));
+    long afterRemove = liveAllocations;
+    check(afterRemove == loaded - 2, "remove() libera la clave y el valor eliminados");
+    dictionary.clear();
+    long afterClear = liveAllocations;
+    check(afterClear == loaded - 200, "clear() libera todas las claves y valores");
+}
+
+/**
+ * @brief Función principal de las pruebas.
+ *
+ * @return 0 si todas las comprobaciones pasan, 1 en caso contrario.
+ */
+int main() {
+    saveDictionary(LARGE_PATH, 100);
+    saveDictionary(SMALL_PATH, 10);
+    testLoadSmallerOverLarger();
+    testClearAndRemoveRelease();
+    remove(LARGE_PATH);
+    remove(SMALL_PATH);
+    if (failures > 0) {
+        std::cerr << failures << " comprobaciones fallidas" << std::endl;
+        return 1;
+    }
+    std::cout << "Todas las pruebas pasaron" << std::endl;
+    return 0;
+}